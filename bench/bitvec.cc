@@ -0,0 +1,84 @@
+#include <catch.hpp>
+
+#include "static_bitvec.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("Bitvec Occupancy Mask", "[bitvec]") {
+    /* About one bit in eight set */
+    static_bitvec<4096> bits{};
+    static_bitvec<4096> other{};
+    statvec<bool, 4096> bools{};
+    statvec<bool, 4096> other_bools{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < 4096u; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        bits.push_back(state % 8u == 0u);
+        bools.push_back(state % 8u == 0u);
+        other.push_back(state % 3u == 0u);
+        other_bools.push_back(state % 3u == 0u);
+    }
+
+    BENCHMARK("static_bitvec count") {
+        return bits.count();
+    };
+
+    BENCHMARK("statvec<bool> count") {
+        return std::count(bools.begin(), bools.end(), true);
+    };
+
+    BENCHMARK("static_bitvec find set bits") {
+        std::size_t sum = 0u;
+        for(auto i = bits.find_first(); i != bits.size(); i = bits.find_next(i)) {
+            sum += i;
+        }
+        return sum;
+    };
+
+    BENCHMARK("static_bitvec for_each_set") {
+        std::size_t sum = 0u;
+        bits.for_each_set([&sum](std::size_t i) {
+            sum += i;
+        });
+        return sum;
+    };
+
+    BENCHMARK("statvec<bool> find set bits") {
+        std::size_t sum = 0u;
+        for(auto it = std::find(bools.begin(), bools.end(), true); it != bools.end(); it = std::find(it + 1, bools.end(), true)) {
+            sum += static_cast<std::size_t>(it - bools.begin());
+        }
+        return sum;
+    };
+
+    BENCHMARK("static_bitvec and") {
+        return (bits & other).count();
+    };
+
+    BENCHMARK("statvec<bool> and") {
+        auto result = bools;
+        for(std::size_t i = 0u; i < result.size(); i++) {
+            result[i] = result[i] && other_bools[i];
+        }
+        return std::count(result.begin(), result.end(), true);
+    };
+
+    BENCHMARK("static_bitvec insert front") {
+        auto copy = bits;
+        copy.erase(copy.cbegin());
+        copy.insert(copy.cbegin(), true);
+        return copy.count();
+    };
+
+    BENCHMARK("statvec<bool> insert front") {
+        auto copy = bools;
+        copy.erase(copy.cbegin());
+        copy.insert(copy.cbegin(), true);
+        return std::count(copy.begin(), copy.end(), true);
+    };
+}
@@ -0,0 +1,148 @@
+#include <catch.hpp>
+
+#include "static_btree_map.h"
+#include "static_flat_map.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <std::size_t Count>
+statvec<std::uint32_t, Count> random_keys(std::uint32_t range) {
+    statvec<std::uint32_t, Count> keys{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < keys.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        keys.push_back(state % range);
+    }
+    return keys;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("B+Tree Map Lookup", "[btree_map]", ((std::size_t N), N), 4096, 65536) {
+    /* Every other key is present, so that half of the lookups miss */
+    auto const keys = random_keys<4096>(2u * N);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> values{};
+    for(std::uint32_t i = 0u; i < N; i++) {
+        values.emplace_back(2u * i, i);
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    auto btree = std::make_unique<static_btree_map<std::uint32_t, std::uint32_t, N>>();
+    btree->assign_sorted(values.begin(), values.end());
+    BENCHMARK(name("static_btree_map find")) {
+        std::uint64_t sum = 0u;
+        for(auto key : keys) {
+            if(auto const it = btree->find(key); it != btree->end()) {
+                sum += it->second;
+            }
+        }
+        return sum;
+    };
+
+    auto flat = std::make_unique<static_flat_map<std::uint32_t, std::uint32_t, N>>();
+    flat->insert_sorted_range(values.begin(), values.end());
+    BENCHMARK(name("static_flat_map find")) {
+        std::uint64_t sum = 0u;
+        for(auto key : keys) {
+            if(auto const it = flat->find(key); it != flat->end()) {
+                sum += it->second;
+            }
+        }
+        return sum;
+    };
+
+    std::map<std::uint32_t, std::uint32_t> map(values.begin(), values.end());
+    BENCHMARK(name("std::map find")) {
+        std::uint64_t sum = 0u;
+        for(auto key : keys) {
+            if(auto const it = map.find(key); it != map.end()) {
+                sum += it->second;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("static_btree_map range scan")) {
+        std::uint64_t sum = 0u;
+        for(std::size_t i = 0u; i < 256u; i++) {
+            auto it = btree->lower_bound(keys[i]);
+            for(std::size_t k = 0u; k < 64u && it != btree->end(); k++, ++it) {
+                sum += it->second;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("std::map range scan")) {
+        std::uint64_t sum = 0u;
+        for(std::size_t i = 0u; i < 256u; i++) {
+            auto it = map.lower_bound(keys[i]);
+            for(std::size_t k = 0u; k < 64u && it != map.end(); k++, ++it) {
+                sum += it->second;
+            }
+        }
+        return sum;
+    };
+}
+
+TEMPLATE_TEST_CASE_SIG("B+Tree Map Insert Erase", "[btree_map]", ((std::size_t N), N), 4096, 65536) {
+    /* Each key is inserted if absent and erased if present, keeping the maps about half full */
+    auto const keys = random_keys<4096>(static_cast<std::uint32_t>(N));
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    auto btree = std::make_unique<static_btree_map<std::uint32_t, std::uint32_t, N>>();
+    for(std::uint32_t i = 0u; i < N; i += 2u) {
+        btree->try_emplace(i, i);
+    }
+    BENCHMARK(name("static_btree_map")) {
+        for(auto key : keys) {
+            if(!btree->erase(key)) {
+                btree->try_emplace(key, key);
+            }
+        }
+        return btree->size();
+    };
+
+    auto flat = std::make_unique<static_flat_map<std::uint32_t, std::uint32_t, N>>();
+    for(std::uint32_t i = 0u; i < N; i += 2u) {
+        flat->try_emplace(i, i);
+    }
+    BENCHMARK(name("static_flat_map")) {
+        for(auto key : keys) {
+            if(!flat->erase(key)) {
+                flat->try_emplace(key, key);
+            }
+        }
+        return flat->size();
+    };
+
+    std::map<std::uint32_t, std::uint32_t> map{};
+    for(std::uint32_t i = 0u; i < N; i += 2u) {
+        map.try_emplace(i, i);
+    }
+    BENCHMARK(name("std::map")) {
+        for(auto key : keys) {
+            if(!map.erase(key)) {
+                map.try_emplace(key, key);
+            }
+        }
+        return map.size();
+    };
+}
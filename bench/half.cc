@@ -0,0 +1,82 @@
+#include <catch.hpp>
+
+#include "half_statvec.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+
+namespace {
+
+template <std::size_t Count>
+statvec<float, Count> random_floats() {
+    statvec<float, Count> values{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < values.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        values.push_back(static_cast<float>(state >> 8) / 16777216.f - 0.5f);
+    }
+    return values;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Half Statvec", "[half]", ((half_format Format), Format), half_format::fp16, half_format::bf16) {
+    /* 4096 feature vectors of 256 elements each, scored against one query */
+    std::size_t constexpr size = 1u << 20;
+    auto const name = [](char const* what) {
+        return std::string{what} + (Format == half_format::fp16 ? " fp16" : " bf16");
+    };
+
+    auto values = std::make_unique<statvec<float, size>>(random_floats<size>());
+    auto query = std::make_unique<statvec<float, size>>(random_floats<size>());
+    auto half = std::make_unique<half_statvec<Format, size>>();
+    auto out = std::make_unique<statvec<float, size>>();
+
+    BENCHMARK(name("half_statvec pack")) {
+        half->pack(*values);
+        return half->back();
+    };
+
+    BENCHMARK(name("half_statvec push_back")) {
+        half->clear();
+        for(auto value : *values) {
+            half->push_back(value);
+        }
+        return half->back();
+    };
+
+    BENCHMARK(name("half_statvec unpack")) {
+        half->unpack(*out);
+        return out->back();
+    };
+
+    BENCHMARK(name("half_statvec operator[] unpack")) {
+        out->clear();
+        for(std::size_t i = 0u; i < half->size(); i++) {
+            out->push_back((*half)[i]);
+        }
+        return out->back();
+    };
+
+    BENCHMARK(name("half_statvec dot")) {
+        return half->dot(*query);
+    };
+
+    BENCHMARK(name("half_statvec operator[] dot")) {
+        float dot = 0.f;
+        for(std::size_t i = 0u; i < half->size(); i++) {
+            dot += (*half)[i] * (*query)[i];
+        }
+        return dot;
+    };
+
+    BENCHMARK(name("statvec<float> inner_product")) {
+        return std::inner_product(values->data(), values->data() + size, query->data(), 0.f);
+    };
+}
@@ -0,0 +1,92 @@
+#include <catch.hpp>
+
+#include "static_jagged.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+/* Adjacency lists of 4096 vertices with 0 to 15 neighbours each, 64 at most */
+std::size_t constexpr vertices = 4096u;
+std::size_t constexpr max_degree = 64u;
+
+template <typename F>
+void for_each_list(F&& f) {
+    std::uint32_t state = 2463534242u;
+    statvec<std::uint32_t, max_degree> list{};
+    for(std::size_t v = 0u; v < vertices; v++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        list.clear();
+        for(std::uint32_t k = 0u; k < state % 16u; k++) {
+            list.push_back((state >> 4) + k);
+        }
+        f(list);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Jagged", "[jagged]") {
+    using nested_type = statvec<statvec<std::uint32_t, max_degree>, vertices>;
+    using jagged_type = static_jagged<std::uint32_t, 16u * vertices, vertices>;
+    auto const name = [](char const* what, std::size_t bytes) {
+        return std::string{what} + " (" + std::to_string(bytes / 1024u) + " KiB)";
+    };
+
+    auto nested = std::make_unique<nested_type>();
+    auto jagged = std::make_unique<jagged_type>();
+    for_each_list([&](auto const& list) {
+        nested->push_back(list);
+        jagged->push_row(list.begin(), list.end());
+    });
+
+    BENCHMARK(name("statvec<statvec> sweep", sizeof(nested_type))) {
+        std::uint64_t sum = 0u;
+        for(auto const& list : *nested) {
+            for(auto v : list) {
+                sum += v;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("static_jagged rows sweep", sizeof(jagged_type))) {
+        std::uint64_t sum = 0u;
+        for(auto row : *jagged) {
+            for(auto v : row) {
+                sum += v;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("static_jagged elements sweep", sizeof(jagged_type))) {
+        std::uint64_t sum = 0u;
+        for(auto v : jagged->elements()) {
+            sum += v;
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("statvec<statvec> build", sizeof(nested_type))) {
+        nested->clear();
+        for_each_list([&](auto const& list) {
+            nested->push_back(list);
+        });
+        return nested->size();
+    };
+
+    BENCHMARK(name("static_jagged build", sizeof(jagged_type))) {
+        jagged->clear();
+        for_each_list([&](auto const& list) {
+            jagged->push_row(list.begin(), list.end());
+        });
+        return jagged->size();
+    };
+}
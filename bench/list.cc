@@ -0,0 +1,55 @@
+#include <catch.hpp>
+
+#include "static_list.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+
+TEST_CASE("List Traversal", "[list]") {
+    constexpr std::size_t size = 1u << 16;
+    /* Inserting at pseudo-random positions scatters traversal order across the node array */
+    auto scattered = std::make_unique<static_list<std::uint32_t, size>>();
+    std::list<std::uint32_t> ref{};
+    auto it = scattered->begin();
+    auto ref_it = ref.begin();
+    std::uint32_t state = 2463534242u;
+    for(std::uint32_t i = 0u; i < size; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if(state & 1u) {
+            it = scattered->begin();
+            ref_it = ref.begin();
+        }
+        it = scattered->insert(it, i);
+        ref_it = ref.insert(ref_it, i);
+        ++it;
+        ++ref_it;
+    }
+    auto compacted = std::make_unique<static_list<std::uint32_t, size>>(*scattered);
+    compacted->compact();
+
+    BENCHMARK("static_list scattered") {
+        std::uint32_t sum = 0u;
+        for(auto value : *scattered) {
+            sum += value;
+        }
+        return sum;
+    };
+    BENCHMARK("static_list compacted") {
+        std::uint32_t sum = 0u;
+        for(auto value : *compacted) {
+            sum += value;
+        }
+        return sum;
+    };
+    BENCHMARK("std::list") {
+        std::uint32_t sum = 0u;
+        for(auto value : ref) {
+            sum += value;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,64 @@
+#include <catch.hpp>
+
+#include "static_lru_cache.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+TEMPLATE_TEST_CASE_SIG("LRU Cache Get Or Put", "[lru_cache]", ((std::size_t N), N), 64, 1024) {
+    /* Keys drawn from twice the capacity, so that about half of the lookups miss and evict */
+    statvec<std::uint32_t, 4096> keys{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < keys.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        keys.push_back(state % (2u * N));
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    auto cache = std::make_unique<static_lru_cache<std::uint32_t, std::uint64_t, N>>();
+    BENCHMARK(name("static_lru_cache")) {
+        std::uint64_t sum = 0u;
+        for(auto key : keys) {
+            if(auto const value = cache->get(key)) {
+                sum += *value;
+            }
+            else {
+                cache->put(key, key);
+            }
+        }
+        return sum;
+    };
+
+    using list_type = std::list<std::pair<std::uint32_t, std::uint64_t>>;
+    list_type order{};
+    std::unordered_map<std::uint32_t, list_type::iterator> index{};
+    BENCHMARK(name("std::list + std::unordered_map")) {
+        std::uint64_t sum = 0u;
+        for(auto key : keys) {
+            if(auto const it = index.find(key); it != index.end()) {
+                order.splice(order.begin(), order, it->second);
+                sum += it->second->second;
+            }
+            else {
+                if(order.size() == N) {
+                    index.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(key, key);
+                index.emplace(key, order.begin());
+            }
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,88 @@
+#include <catch.hpp>
+
+#include "packed_statvec.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+template <std::size_t Count>
+statvec<std::uint16_t, Count> random_values(std::uint32_t range) {
+    statvec<std::uint16_t, Count> values{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < values.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        values.push_back(static_cast<std::uint16_t>(state % range));
+    }
+    return values;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Packed Statvec", "[packed]", ((std::size_t Bits), Bits), 5, 12) {
+    std::size_t constexpr size = 65536u;
+    auto const name = [](char const* what) {
+        return std::string{what} + " Bits=" + std::to_string(Bits);
+    };
+
+    auto values = std::make_unique<statvec<std::uint16_t, size>>(random_values<size>(1u << Bits));
+    auto packed = std::make_unique<packed_statvec<Bits, size>>();
+    auto out = std::make_unique<statvec<std::uint16_t, size>>();
+
+    BENCHMARK(name("packed_statvec pack")) {
+        packed->pack(*values);
+        return packed->back();
+    };
+
+    BENCHMARK(name("packed_statvec push_back")) {
+        packed->clear();
+        for(auto value : *values) {
+            packed->push_back(value);
+        }
+        return packed->back();
+    };
+
+    BENCHMARK(name("packed_statvec unpack")) {
+        packed->unpack(*out);
+        return out->back();
+    };
+
+    BENCHMARK(name("packed_statvec operator[] unpack")) {
+        out->clear();
+        for(std::size_t i = 0u; i < packed->size(); i++) {
+            out->push_back((*packed)[i]);
+        }
+        return out->back();
+    };
+
+    BENCHMARK(name("packed_statvec decoder sum")) {
+        std::uint64_t sum = 0u;
+        auto decoder = packed->decode();
+        for(std::size_t i = 0u; i < packed->size(); i++) {
+            sum += decoder.next();
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("packed_statvec operator[] sum")) {
+        std::uint64_t sum = 0u;
+        for(std::size_t i = 0u; i < packed->size(); i++) {
+            sum += (*packed)[i];
+        }
+        return sum;
+    };
+
+    BENCHMARK(name("statvec<uint16_t> sum")) {
+        std::uint64_t sum = 0u;
+        for(auto value : *values) {
+            sum += value;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,79 @@
+#include <catch.hpp>
+
+#include "static_hash_map.h"
+#include "static_perfect_hash_map.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+using namespace std::string_view_literals;
+
+namespace {
+
+constexpr statvec keyword_entries{
+    std::pair{"alignas"sv, 0}, std::pair{"alignof"sv, 1}, std::pair{"auto"sv, 2}, std::pair{"bool"sv, 3},
+    std::pair{"break"sv, 4}, std::pair{"case"sv, 5}, std::pair{"catch"sv, 6}, std::pair{"char"sv, 7},
+    std::pair{"class"sv, 8}, std::pair{"const"sv, 9}, std::pair{"constexpr"sv, 10}, std::pair{"continue"sv, 11},
+    std::pair{"decltype"sv, 12}, std::pair{"default"sv, 13}, std::pair{"delete"sv, 14}, std::pair{"do"sv, 15},
+    std::pair{"double"sv, 16}, std::pair{"else"sv, 17}, std::pair{"enum"sv, 18}, std::pair{"explicit"sv, 19},
+    std::pair{"extern"sv, 20}, std::pair{"false"sv, 21}, std::pair{"float"sv, 22}, std::pair{"for"sv, 23},
+    std::pair{"friend"sv, 24}, std::pair{"goto"sv, 25}, std::pair{"if"sv, 26}, std::pair{"inline"sv, 27},
+    std::pair{"int"sv, 28}, std::pair{"long"sv, 29}, std::pair{"mutable"sv, 30}, std::pair{"namespace"sv, 31},
+    std::pair{"new"sv, 32}, std::pair{"noexcept"sv, 33}, std::pair{"nullptr"sv, 34}, std::pair{"operator"sv, 35},
+    std::pair{"private"sv, 36}, std::pair{"protected"sv, 37}, std::pair{"public"sv, 38}, std::pair{"return"sv, 39},
+    std::pair{"short"sv, 40}, std::pair{"signed"sv, 41}, std::pair{"sizeof"sv, 42}, std::pair{"static"sv, 43},
+    std::pair{"struct"sv, 44}, std::pair{"switch"sv, 45}, std::pair{"template"sv, 46}, std::pair{"this"sv, 47},
+    std::pair{"throw"sv, 48}, std::pair{"true"sv, 49}, std::pair{"try"sv, 50}, std::pair{"typedef"sv, 51},
+    std::pair{"typename"sv, 52}, std::pair{"union"sv, 53}, std::pair{"unsigned"sv, 54}, std::pair{"using"sv, 55},
+    std::pair{"virtual"sv, 56}, std::pair{"void"sv, 57}, std::pair{"volatile"sv, 58}, std::pair{"while"sv, 59}
+};
+
+constexpr static_perfect_hash_map keywords{keyword_entries};
+
+} // namespace
+
+TEST_CASE("Perfect Hash Map Keyword Lookup", "[perfect_hash_map]") {
+    static_hash_map<std::string_view, int, keyword_entries.size()> table{};
+    std::unordered_map<std::string_view, int> hashed{};
+    for(auto const& [key, value] : keyword_entries) {
+        table.insert_or_assign(key, value);
+        hashed.insert_or_assign(key, value);
+    }
+
+    /* Identifiers of a typical source file, every other one is not a keyword */
+    statvec<std::string_view, 512> queries{};
+    constexpr std::string_view identifiers[] = {"size"sv, "value"sv, "it"sv, "begin"sv, "index"sv, "other"sv};
+    std::size_t state = 2463534242u;
+    for(std::size_t i = 0u; i < queries.capacity(); i++) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        queries.push_back(i & 1u ? identifiers[(state >> 33) % 6u] : keyword_entries[(state >> 33) % keyword_entries.size()].first);
+    }
+
+    BENCHMARK("static_perfect_hash_map::find") {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const value = keywords.find(key);
+            sum += value ? *value : 0;
+        }
+        return sum;
+    };
+    BENCHMARK("static_hash_map::find") {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = table.find(key);
+            sum += it != table.end() ? it->second : 0;
+        }
+        return sum;
+    };
+    BENCHMARK("std::unordered_map::find") {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = hashed.find(key);
+            sum += it != hashed.end() ? it->second : 0;
+        }
+        return sum;
+    };
+}
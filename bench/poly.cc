@@ -0,0 +1,175 @@
+#include <catch.hpp>
+
+#include "poly_statvec.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct command {
+    virtual ~command() = default;
+    virtual std::uint32_t run(std::uint32_t acc) const noexcept = 0;
+};
+
+struct add final : command {
+    std::uint32_t value;
+    explicit add(std::uint32_t v) noexcept : value{v} { }
+    std::uint32_t run(std::uint32_t acc) const noexcept override { return acc + value; }
+};
+
+struct mul final : command {
+    std::uint32_t value;
+    explicit mul(std::uint32_t v) noexcept : value{v | 1u} { }
+    std::uint32_t run(std::uint32_t acc) const noexcept override { return acc * value; }
+};
+
+struct rotate final : command {
+    std::uint32_t shift;
+    std::uint32_t pad[3]{};
+    explicit rotate(std::uint32_t s) noexcept : shift{s % 31u + 1u} { }
+    std::uint32_t run(std::uint32_t acc) const noexcept override { return acc << shift | acc >> (32u - shift); }
+};
+
+struct mix final : command {
+    std::uint32_t a, b;
+    std::uint64_t pad[2]{};
+    mix(std::uint32_t x, std::uint32_t y) noexcept : a{x}, b{y} { }
+    std::uint32_t run(std::uint32_t acc) const noexcept override { return (acc ^ a) + b; }
+};
+
+/* 1024 commands of four types in random order */
+std::size_t constexpr commands = 1024u;
+
+template <typename F>
+void for_each_command(F&& f) {
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < commands; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        f(state % 4u, state >> 8);
+    }
+}
+
+template <typename Vec>
+std::uint32_t run_all(Vec const& vec) {
+    std::uint32_t acc = 1u;
+    for(auto const& cmd : vec) {
+        acc = cmd.run(acc);
+    }
+    return acc;
+}
+
+} // namespace
+
+TEST_CASE("Poly Statvec", "[poly]") {
+    using poly_type = poly_statvec<command, commands * 32u, commands>;
+
+    /* Interleave the heap objects with unrelated allocations, as in a long-running program */
+    std::vector<std::unique_ptr<std::uint64_t[]>> noise{};
+    auto pointers = std::make_unique<statvec<std::unique_ptr<command>, commands>>();
+    auto poly = std::make_unique<poly_type>();
+    auto sorted = std::make_unique<poly_type>();
+    for_each_command([&](std::uint32_t type, std::uint32_t value) {
+        noise.push_back(std::make_unique<std::uint64_t[]>(value % 16u + 1u));
+        switch(type) {
+            case 0u:
+                pointers->push_back(std::make_unique<add>(value));
+                poly->emplace_back<add>(value);
+                break;
+            case 1u:
+                pointers->push_back(std::make_unique<mul>(value));
+                poly->emplace_back<mul>(value);
+                break;
+            case 2u:
+                pointers->push_back(std::make_unique<rotate>(value));
+                poly->emplace_back<rotate>(value);
+                break;
+            default:
+                pointers->push_back(std::make_unique<mix>(value, value >> 3));
+                poly->emplace_back<mix>(value, value >> 3);
+        }
+    });
+    for_each_command([&](std::uint32_t type, std::uint32_t value) {
+        switch(type) {
+            case 0u:
+                sorted->emplace_back<add>(value);
+                break;
+            case 1u:
+                sorted->emplace_back<mul>(value);
+                break;
+            case 2u:
+                sorted->emplace_back<rotate>(value);
+                break;
+            default:
+                sorted->emplace_back<mix>(value, value >> 3);
+        }
+    });
+    sorted->sort_by_type();
+
+    BENCHMARK("statvec<unique_ptr> run") {
+        std::uint32_t acc = 1u;
+        for(auto const& cmd : *pointers) {
+            acc = cmd->run(acc);
+        }
+        return acc;
+    };
+
+    BENCHMARK("poly_statvec run") {
+        return run_all(*poly);
+    };
+
+    BENCHMARK("poly_statvec sorted by type run") {
+        return run_all(*sorted);
+    };
+
+    BENCHMARK("statvec<unique_ptr> build") {
+        pointers->clear();
+        for_each_command([&](std::uint32_t type, std::uint32_t value) {
+            switch(type) {
+                case 0u:
+                    pointers->push_back(std::make_unique<add>(value));
+                    break;
+                case 1u:
+                    pointers->push_back(std::make_unique<mul>(value));
+                    break;
+                case 2u:
+                    pointers->push_back(std::make_unique<rotate>(value));
+                    break;
+                default:
+                    pointers->push_back(std::make_unique<mix>(value, value >> 3));
+            }
+        });
+        return pointers->size();
+    };
+
+    BENCHMARK("poly_statvec build") {
+        poly->clear();
+        for_each_command([&](std::uint32_t type, std::uint32_t value) {
+            switch(type) {
+                case 0u:
+                    poly->emplace_back<add>(value);
+                    break;
+                case 1u:
+                    poly->emplace_back<mul>(value);
+                    break;
+                case 2u:
+                    poly->emplace_back<rotate>(value);
+                    break;
+                default:
+                    poly->emplace_back<mix>(value, value >> 3);
+            }
+        });
+        return poly->size();
+    };
+
+    /* Sorting costs the same whether or not the table is already grouped */
+    BENCHMARK("poly_statvec sort_by_type") {
+        poly->sort_by_type();
+        return poly->size();
+    };
+}
@@ -0,0 +1,86 @@
+#include <catch.hpp>
+
+#include "static_priority_queue.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("Priority Queue Top-K", "[priority_queue]", ((std::size_t K), K), 16, 256, 4096) {
+    std::vector<std::uint32_t> values(65536u);
+    std::uint32_t state = 2463534242u;
+    for(auto& value : values) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = state;
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " K=" + std::to_string(K);
+    };
+
+    BENCHMARK(name("sorted statvec insert")) {
+        statvec<std::uint32_t, K + 1u> best{};
+        for(auto value : values) {
+            if(best.size() == K && value <= best.back()) {
+                continue;
+            }
+            best.insert(std::upper_bound(best.cbegin(), best.cend(), value, std::greater<std::uint32_t>{}), value);
+            if(best.size() > K) {
+                best.pop_back();
+            }
+        }
+        return best.front();
+    };
+    BENCHMARK(name("static_priority_queue<2>::offer")) {
+        static_priority_queue<std::uint32_t, K, std::greater<std::uint32_t>, 2u> best{};
+        for(auto value : values) {
+            best.offer(value);
+        }
+        return best.top();
+    };
+    BENCHMARK(name("static_priority_queue<4>::offer")) {
+        static_priority_queue<std::uint32_t, K, std::greater<std::uint32_t>, 4u> best{};
+        for(auto value : values) {
+            best.offer(value);
+        }
+        return best.top();
+    };
+}
+
+TEMPLATE_TEST_CASE_SIG("Priority Queue Drain", "[priority_queue]", ((std::size_t N), N), 256, 16384) {
+    statvec<std::uint32_t, N> values{};
+    std::uint32_t state = 2463534242u;
+    while(values.size() < values.capacity()) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        values.push_back(state);
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    BENCHMARK(name("static_priority_queue<2> heapify and pop")) {
+        static_priority_queue<std::uint32_t, N, std::less<std::uint32_t>, 2u> queue{values};
+        std::uint32_t sum = 0u;
+        while(!queue.empty()) {
+            sum += queue.pop();
+        }
+        return sum;
+    };
+    BENCHMARK(name("static_priority_queue<4> heapify and pop")) {
+        static_priority_queue<std::uint32_t, N, std::less<std::uint32_t>, 4u> queue{values};
+        std::uint32_t sum = 0u;
+        while(!queue.empty()) {
+            sum += queue.pop();
+        }
+        return sum;
+    };
+}
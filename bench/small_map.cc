@@ -0,0 +1,61 @@
+#include <catch.hpp>
+
+#include "static_flat_map.h"
+#include "static_small_map.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+TEMPLATE_TEST_CASE_SIG("Small Map Lookup", "[small_map]", ((std::size_t N), N), 8, 16, 32, 64) {
+    static_small_map<std::uint32_t, int, N> small{};
+    static_flat_map<std::uint32_t, int, N> flat{};
+    std::unordered_map<std::uint32_t, int> hashed{};
+    for(std::size_t i = 0u; i < N; i++) {
+        auto const key = static_cast<std::uint32_t>(i * 2654435761u);
+        small.insert_or_assign(key, static_cast<int>(i));
+        flat.insert_or_assign(key, static_cast<int>(i));
+        hashed.insert_or_assign(key, static_cast<int>(i));
+    }
+
+    /* Every other query misses */
+    statvec<std::uint32_t, 256> queries{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < queries.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        queries.push_back(static_cast<std::uint32_t>((state % N) * 2654435761u) + (i & 1u));
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    BENCHMARK(name("static_small_map::find")) {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const value = small.find(key);
+            sum += value ? *value : 0;
+        }
+        return sum;
+    };
+    BENCHMARK(name("static_flat_map::find")) {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = flat.find(key);
+            sum += it != flat.end() ? it->second : 0;
+        }
+        return sum;
+    };
+    BENCHMARK(name("std::unordered_map::find")) {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = hashed.find(key);
+            sum += it != hashed.end() ? it->second : 0;
+        }
+        return sum;
+    };
+}
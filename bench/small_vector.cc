@@ -0,0 +1,64 @@
+#include <catch.hpp>
+
+#include "small_vector.h"
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/* Per-request scratch lists: mostly a handful of entries, with a rare burst of a few hundred */
+std::size_t constexpr requests = 256u;
+
+std::size_t burst_size(std::size_t request) noexcept {
+    return request % 64u == 63u ? 300u : 3u + request % 5u;
+}
+
+} // namespace
+
+TEST_CASE("Small Vector", "[small_vector]") {
+    BENCHMARK("std::vector bursty lists") {
+        std::uint64_t total = 0u;
+        for(std::size_t r = 0u; r < requests; r++) {
+            std::vector<std::uint64_t> list{};
+            for(std::size_t i = 0u; i < burst_size(r); i++) {
+                list.push_back(i * r);
+            }
+            for(auto const value : list) {
+                total += value;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("statvec sized for the burst") {
+        std::uint64_t total = 0u;
+        for(std::size_t r = 0u; r < requests; r++) {
+            auto list = std::make_unique<statvec<std::uint64_t, 512>>();
+            for(std::size_t i = 0u; i < burst_size(r); i++) {
+                list->push_back(i * r);
+            }
+            for(auto const value : *list) {
+                total += value;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("small_vector bursty lists") {
+        std::uint64_t total = 0u;
+        for(std::size_t r = 0u; r < requests; r++) {
+            small_vector<std::uint64_t, 8> list{};
+            for(std::size_t i = 0u; i < burst_size(r); i++) {
+                list.push_back(i * r);
+            }
+            for(auto const value : list) {
+                total += value;
+            }
+        }
+        return total;
+    };
+}
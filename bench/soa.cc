@@ -0,0 +1,129 @@
+#include <catch.hpp>
+
+#include "statvec.h"
+#include "statvec_soa.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+
+namespace {
+
+struct particle {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass;
+    std::uint32_t id;
+};
+
+std::size_t constexpr particles = 1u << 16;
+
+using particle_soa = statvec_soa<particles, float, float, float, float, float, float, float, std::uint32_t>;
+using particle_aosoa = statvec_aosoa<particles, 16, float, float, float, float, float, float, float, std::uint32_t>;
+
+template <typename Vec>
+void fill(Vec& vec) {
+    for(std::uint32_t i = 0u; i < particles; i++) {
+        auto const f = static_cast<float>(i);
+        vec.push_back(f, f, f, 1.f, 2.f, 3.f, f * 0.5f, i);
+    }
+}
+
+} // namespace
+
+TEST_CASE("SoA Statvec", "[soa]") {
+    float constexpr dt = 0.01f;
+
+    auto aos = std::make_unique<statvec<particle, particles>>();
+    for(std::uint32_t i = 0u; i < particles; i++) {
+        auto const f = static_cast<float>(i);
+        aos->push_back(particle{f, f, f, 1.f, 2.f, 3.f, f * 0.5f, i});
+    }
+    auto soa = std::make_unique<particle_soa>();
+    fill(*soa);
+    auto aosoa = std::make_unique<particle_aosoa>();
+    fill(*aosoa);
+
+    BENCHMARK("statvec<particle> advance x") {
+        for(auto& p : *aos) {
+            p.x += p.vx * dt;
+        }
+        return aos->back().x;
+    };
+
+    BENCHMARK("statvec_soa advance x") {
+        auto const x = soa->field<0>();
+        auto const vx = soa->field<3>();
+        for(std::size_t i = 0u; i < x.size(); i++) {
+            x[i] += vx[i] * dt;
+        }
+        return x[x.size() - 1u];
+    };
+
+    BENCHMARK("statvec_aosoa advance x") {
+        for(std::size_t block = 0u; block < aosoa->block_count(); block++) {
+            auto const x = aosoa->field<0>(block);
+            auto const vx = aosoa->field<3>(block);
+            for(std::size_t i = 0u; i < x.size(); i++) {
+                x[i] += vx[i] * dt;
+            }
+        }
+        return aosoa->get<0>(particles - 1u);
+    };
+
+    BENCHMARK("statvec_aosoa lanes advance x") {
+        for(std::size_t block = 0u; block < aosoa->block_count(); block++) {
+            auto& x = aosoa->lanes<0>(block);
+            auto const& vx = aosoa->lanes<3>(block);
+            for(std::size_t i = 0u; i < particle_aosoa::block_size; i++) {
+                x[i] += vx[i] * dt;
+            }
+        }
+        return aosoa->get<0>(particles - 1u);
+    };
+
+    BENCHMARK("statvec_soa zip iterator advance x") {
+        for(auto row : *soa) {
+            std::get<0>(row) += std::get<3>(row) * dt;
+        }
+        return soa->get<0>(particles - 1u);
+    };
+
+    BENCHMARK("statvec<particle> id checksum") {
+        std::uint32_t sum = 0u;
+        for(auto const& p : *aos) {
+            sum += p.id;
+        }
+        return sum;
+    };
+
+    BENCHMARK("statvec_soa id checksum") {
+        std::uint32_t sum = 0u;
+        for(auto id : soa->field<7>()) {
+            sum += id;
+        }
+        return sum;
+    };
+
+    BENCHMARK("statvec_aosoa lanes id checksum") {
+        std::uint32_t sum = 0u;
+        for(std::size_t block = 0u; block < aosoa->block_count(); block++) {
+            auto const& ids = aosoa->lanes<7>(block);
+            for(std::size_t i = 0u; i < particle_aosoa::block_size; i++) {
+                sum += ids[i];
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("statvec_aosoa id checksum") {
+        std::uint32_t sum = 0u;
+        for(std::size_t block = 0u; block < aosoa->block_count(); block++) {
+            for(auto id : aosoa->field<7>(block)) {
+                sum += id;
+            }
+        }
+        return sum;
+    };
+}
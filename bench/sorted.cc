@@ -0,0 +1,99 @@
+#include <catch.hpp>
+
+#include "sorted_statvec.h"
+#include "static_flat_map.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+
+namespace {
+
+/* Pseudo-random mix of hits and misses, the keys stored are the even numbers below 2 * N. The queries must not
+ * follow a pattern the branch predictor could pick up on */
+template <std::size_t N>
+statvec<int, 256> make_queries() {
+    statvec<int, 256> queries{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < queries.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        queries.push_back(static_cast<int>(state % (2u * N)));
+    }
+    return queries;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Sorted Lookup", "[sorted]", ((std::size_t N), N), 8, 64, 512, 4096) {
+    auto const queries = make_queries<N>();
+
+    static_flat_set<int, N> flat_set{};
+    statvec<int, N> vec{};
+    std::set<int> set{};
+    static_flat_map<int, int, N> flat_map{};
+    std::map<int, int> map{};
+    for(std::size_t i = 0u; i < N; i++) {
+        int const key = static_cast<int>(2u * i);
+        flat_set.insert(key);
+        vec.push_back(key);
+        set.insert(key);
+        flat_map.try_emplace(key, key);
+        map.emplace(key, key);
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    BENCHMARK(name("static_flat_set::find")) {
+        std::size_t hits = 0u;
+        for(auto key : queries) {
+            hits += flat_set.find(key) != flat_set.end();
+        }
+        return hits;
+    };
+    BENCHMARK(name("std::set::find")) {
+        std::size_t hits = 0u;
+        for(auto key : queries) {
+            hits += set.find(key) != set.end();
+        }
+        return hits;
+    };
+    BENCHMARK(name("std::lower_bound")) {
+        std::size_t hits = 0u;
+        for(auto key : queries) {
+            auto const it = std::lower_bound(vec.begin(), vec.end(), key);
+            hits += it != vec.end() && *it == key;
+        }
+        return hits;
+    };
+    BENCHMARK(name("linear scan")) {
+        std::size_t hits = 0u;
+        for(auto key : queries) {
+            hits += std::find(vec.begin(), vec.end(), key) != vec.end();
+        }
+        return hits;
+    };
+    BENCHMARK(name("static_flat_map::find")) {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = flat_map.find(key);
+            sum += it != flat_map.end() ? it->second : 0;
+        }
+        return sum;
+    };
+    BENCHMARK(name("std::map::find")) {
+        int sum = 0;
+        for(auto key : queries) {
+            auto const it = map.find(key);
+            sum += it != map.end() ? it->second : 0;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,51 @@
+#include <catch.hpp>
+
+#include "static_sparse_set.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+TEMPLATE_TEST_CASE_SIG("Sparse Set Membership", "[sparse_set]", ((std::size_t N), N), 64, 1024, 16384) {
+    static_sparse_set<N> set{};
+    statvec<std::uint32_t, N> ids{};
+    statvec<std::uint32_t, 1024> queries{};
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < N; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        /* About half of the universe is active */
+        if(state & 1u) {
+            set.insert(i);
+            ids.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    for(std::size_t i = 0u; i < queries.capacity(); i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        queries.push_back(static_cast<std::uint32_t>(state % N));
+    }
+
+    auto const name = [](char const* what) {
+        return std::string{what} + " N=" + std::to_string(N);
+    };
+
+    BENCHMARK(name("static_sparse_set::contains")) {
+        std::size_t hits = 0u;
+        for(auto id : queries) {
+            hits += set.contains(id);
+        }
+        return hits;
+    };
+    BENCHMARK(name("statvec std::find")) {
+        std::size_t hits = 0u;
+        for(auto id : queries) {
+            hits += std::find(ids.begin(), ids.end(), id) != ids.end();
+        }
+        return hits;
+    };
+}
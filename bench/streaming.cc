@@ -0,0 +1,176 @@
+#include <catch.hpp>
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using staging_vec = statvec<float, 1u << 20>;
+
+/* Sized to fit in a typical L2 cache, standing in for the working set of whatever
+ * runs in between bulk writes to the staging buffers */
+std::vector<float> hot_set(std::size_t size = (256u << 10) / sizeof(float)) {
+    std::vector<float> hot(size);
+    std::iota(hot.begin(), hot.end(), 0.f);
+    return hot;
+}
+
+float touch(std::vector<float> const& hot) {
+    return std::accumulate(hot.begin(), hot.end(), 0.f);
+}
+
+/* Repeats write on a second thread for as long as it is alive */
+template <typename Write>
+class background_writer {
+    public:
+        explicit background_writer(Write write)
+            : thread_{[this, write]() mutable {
+                  while(!stop_.load(std::memory_order_relaxed)) {
+                      write();
+                  }
+              }} { }
+
+        ~background_writer() {
+            stop_.store(true, std::memory_order_relaxed);
+            thread_.join();
+        }
+
+    private:
+        std::atomic<bool> stop_{false};
+        std::thread thread_;
+};
+
+template <typename Write>
+background_writer(Write) -> background_writer<Write>;
+
+} // namespace
+
+TEST_CASE("Bulk Fill", "[streaming]") {
+    static_assert(detail::is_streamable_v<float, 1u << 20>);
+    auto vec = std::make_unique<staging_vec>();
+    auto const hot = hot_set();
+
+    BENCHMARK("regular fill") {
+        std::fill_n(vec->data(), vec->capacity(), 1.f);
+        Catch::Benchmark::keep_memory(vec.get());
+    };
+    BENCHMARK("streaming fill") {
+        return vec->assign(vec->capacity(), 1.f);
+    };
+    BENCHMARK("regular fill, then hot set") {
+        std::fill_n(vec->data(), vec->capacity(), 1.f);
+        Catch::Benchmark::keep_memory(vec.get());
+        return touch(hot);
+    };
+    BENCHMARK("streaming fill, then hot set") {
+        vec->assign(vec->capacity(), 1.f);
+        return touch(hot);
+    };
+    BENCHMARK("hot set alone") {
+        return touch(hot);
+    };
+}
+
+TEST_CASE("Bulk Copy", "[streaming]") {
+    auto src = std::make_unique<staging_vec>();
+    auto dst = std::make_unique<staging_vec>();
+    src->assign(src->capacity(), 2.f);
+    auto const hot = hot_set();
+
+    BENCHMARK("regular copy") {
+        std::copy(src->begin(), src->end(), dst->begin());
+        Catch::Benchmark::keep_memory(dst.get());
+    };
+    BENCHMARK("streaming copy") {
+        *dst = *src;
+        Catch::Benchmark::keep_memory(dst.get());
+    };
+    BENCHMARK("regular copy, then hot set") {
+        std::copy(src->begin(), src->end(), dst->begin());
+        Catch::Benchmark::keep_memory(dst.get());
+        return touch(hot);
+    };
+    BENCHMARK("streaming copy, then hot set") {
+        *dst = *src;
+        Catch::Benchmark::keep_memory(dst.get());
+        return touch(hot);
+    };
+}
+
+/* The hot set is timed while a second thread keeps filling or copying, so the measurement captures
+ * interference while the stores are in flight rather than the cost of refilling the caches afterwards.
+ * The threads run on separate cores, sharing only the last-level cache and memory bandwidth, so the
+ * hot set is sized past L2. Needs at least two hardware threads to be meaningful */
+TEST_CASE("Concurrent Hot Set", "[streaming]") {
+    auto src = std::make_unique<staging_vec>();
+    auto dst = std::make_unique<staging_vec>();
+    src->assign(src->capacity(), 2.f);
+    auto const hot = hot_set((4u << 20) / sizeof(float));
+
+    BENCHMARK("hot set alone") {
+        return touch(hot);
+    };
+    {
+        background_writer writer{[&] {
+            std::fill_n(dst->data(), dst->capacity(), 1.f);
+            Catch::Benchmark::keep_memory(dst.get());
+        }};
+        BENCHMARK("hot set during regular fill") {
+            return touch(hot);
+        };
+    }
+    {
+        background_writer writer{[&] {
+            dst->assign(dst->capacity(), 1.f);
+            Catch::Benchmark::keep_memory(dst.get());
+        }};
+        BENCHMARK("hot set during streaming fill") {
+            return touch(hot);
+        };
+    }
+    {
+        background_writer writer{[&] {
+            std::copy(src->begin(), src->end(), dst->begin());
+            Catch::Benchmark::keep_memory(dst.get());
+        }};
+        BENCHMARK("hot set during regular copy") {
+            return touch(hot);
+        };
+    }
+    {
+        background_writer writer{[&] {
+            *dst = *src;
+            Catch::Benchmark::keep_memory(dst.get());
+        }};
+        BENCHMARK("hot set during streaming copy") {
+            return touch(hot);
+        };
+    }
+}
+
+/* Fills of either kind followed by a pass over the hot set, around the default
+ * STATVEC_STREAMING_THRESHOLD of 1 MiB */
+TEMPLATE_TEST_CASE_SIG("Streaming Threshold", "[streaming]", ((std::size_t KiB), KiB), 256, 512, 1024, 2048, 4096) {
+    std::vector<float> buf((KiB << 10) / sizeof(float));
+    auto const hot = hot_set();
+    auto const size = std::to_string(KiB) + " KiB";
+
+    BENCHMARK("regular fill " + size + ", then hot set") {
+        std::fill_n(buf.data(), buf.size(), 1.f);
+        Catch::Benchmark::keep_memory(buf.data());
+        return touch(hot);
+    };
+    BENCHMARK("streaming fill " + size + ", then hot set") {
+        detail::stream_fill(buf.data(), buf.size(), 1.f);
+        Catch::Benchmark::keep_memory(buf.data());
+        return touch(hot);
+    };
+}
@@ -0,0 +1,64 @@
+#include <catch.hpp>
+
+#include "static_string.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace {
+
+/* Log-like text over a small alphabet, so that first characters of the needle match often */
+template <typename String>
+void fill_text(String& text, std::size_t size) {
+    std::uint32_t state = 2463534242u;
+    for(std::size_t i = 0u; i < size; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        text.push_back("eeeettaaoinsrhl ="[state % 17u]);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Static String", "[string]") {
+    std::size_t constexpr text_size = 4000u;
+    auto text = std::make_unique<static_string<4096>>();
+    fill_text(*text, text_size);
+    std::string const ref{text->view()};
+
+    BENCHMARK("std::string find absent 6 chars") {
+        return ref.find("status");
+    };
+
+    BENCHMARK("static_string find absent 6 chars") {
+        return text->find("status");
+    };
+
+    BENCHMARK("std::string build 256 keys") {
+        std::size_t total = 0u;
+        for(std::uint32_t i = 0u; i < 256u; i++) {
+            std::string key{"session/"};
+            key += "user_profile_cache_entry/";
+            key += std::to_string(i * 2654435761u);
+            key += "/attributes";
+            total += key.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("static_string build 256 keys") {
+        std::size_t total = 0u;
+        for(std::uint32_t i = 0u; i < 256u; i++) {
+            static_string<64> key{"session/"};
+            key.append("user_profile_cache_entry/");
+            key.append_number(i * 2654435761u);
+            key.append("/attributes");
+            total += key.size();
+        }
+        return total;
+    };
+}
@@ -0,0 +1,64 @@
+#include <catch.hpp>
+
+#include "static_task_queue.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/* One event loop turn of 256 deferred callbacks */
+std::size_t constexpr tasks = 256u;
+
+} // namespace
+
+TEST_CASE("Task Queue", "[task_queue]") {
+    std::uint64_t sink = 0u;
+    std::vector<std::function<void()>> functions{};
+    functions.reserve(tasks);
+    auto queue = std::make_unique<static_task_queue<tasks * 96u>>();
+
+    BENCHMARK("std::vector<std::function> 48 byte captures") {
+        for(std::size_t i = 0u; i < tasks; i++) {
+            std::array<std::uint64_t, 5> const payload{i, i + 1u, i + 2u, i + 3u, i + 4u};
+            functions.emplace_back([&sink, payload] { sink += payload[0] ^ payload[4]; });
+        }
+        for(auto& f : functions) {
+            f();
+        }
+        functions.clear();
+        return sink;
+    };
+
+    BENCHMARK("static_task_queue 48 byte captures") {
+        for(std::size_t i = 0u; i < tasks; i++) {
+            std::array<std::uint64_t, 5> const payload{i, i + 1u, i + 2u, i + 3u, i + 4u};
+            queue->emplace([&sink, payload] { sink += payload[0] ^ payload[4]; });
+        }
+        queue->run_all();
+        return sink;
+    };
+
+    BENCHMARK("std::vector<std::function> 16 byte captures") {
+        for(std::size_t i = 0u; i < tasks; i++) {
+            functions.emplace_back([&sink, i] { sink += i; });
+        }
+        for(auto& f : functions) {
+            f();
+        }
+        functions.clear();
+        return sink;
+    };
+
+    BENCHMARK("static_task_queue 16 byte captures") {
+        for(std::size_t i = 0u; i < tasks; i++) {
+            queue->emplace([&sink, i] { sink += i; });
+        }
+        queue->run_all();
+        return sink;
+    };
+}
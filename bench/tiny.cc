@@ -0,0 +1,144 @@
+#include <catch.hpp>
+
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/* Same layout as int but not trivially copyable, forcing the generic element-wise code paths. It serves as the
+ * baseline the tiny kernels are compared against */
+struct boxed {
+    boxed() noexcept = default;
+    boxed(int i) noexcept : value{i} { }
+    boxed(boxed const&) noexcept = default;
+    boxed& operator=(boxed const& other) & noexcept {
+        value = other.value;
+        return *this;
+    }
+
+    friend bool operator==(boxed lhs, boxed rhs) noexcept { return lhs.value == rhs.value; }
+    friend bool operator!=(boxed lhs, boxed rhs) noexcept { return lhs.value != rhs.value; }
+    friend bool operator<(boxed lhs, boxed rhs) noexcept { return lhs.value < rhs.value; }
+
+    int value{};
+};
+
+template <typename T, std::size_t N>
+statvec<T, N> make_vec(std::size_t size) {
+    statvec<T, N> vec{};
+    for(std::size_t i = 0u; i < size; i++) {
+        vec.push_back(static_cast<int>(i));
+    }
+    return vec;
+}
+
+struct event_counts {
+    double instructions;
+    double branches;
+};
+
+#ifdef __linux__
+int open_counter(std::uint64_t config, int group) {
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+}
+#endif
+
+/* Retired user-space instructions and branches per call of kernel, read from the hardware performance counters.
+ * Empty where these are unavailable, e.g. on virtual machines without a virtualized PMU */
+template <typename Kernel>
+std::optional<event_counts> count_events(Kernel&& kernel, std::size_t calls = 1u << 16) {
+#ifdef __linux__
+    int const instructions = open_counter(PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if(instructions < 0) {
+        return std::nullopt;
+    }
+    int const branches = open_counter(PERF_COUNT_HW_BRANCH_INSTRUCTIONS, instructions);
+    if(branches < 0) {
+        close(instructions);
+        return std::nullopt;
+    }
+
+    ioctl(instructions, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(instructions, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    for(std::size_t i = 0u; i < calls; i++) {
+        kernel();
+    }
+    ioctl(instructions, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    std::uint64_t counts[2]{};
+    bool const read_all = read(instructions, &counts[0], sizeof(counts[0])) == sizeof(counts[0]) &&
+                          read(branches, &counts[1], sizeof(counts[1])) == sizeof(counts[1]);
+    close(branches);
+    close(instructions);
+    if(!read_all) {
+        return std::nullopt;
+    }
+    return event_counts{static_cast<double>(counts[0]) / calls, static_cast<double>(counts[1]) / calls};
+#else
+    static_cast<void>(kernel);
+    static_cast<void>(calls);
+    return std::nullopt;
+#endif
+}
+
+template <typename Kernel>
+void measure(std::string const& name, Kernel kernel) {
+    BENCHMARK(std::string{name}) {
+        return kernel();
+    };
+    if(auto const counts = count_events(kernel)) {
+        std::cout << name << ": " << counts->instructions << " instructions, "
+                  << counts->branches << " branches per call\n";
+    }
+}
+
+template <typename T, std::size_t N>
+void run_kernels(std::string const& path) {
+    auto const src = make_vec<T, N>(N / 2u);
+    auto dst = make_vec<T, N>(N / 2u);
+    auto const cmp = make_vec<T, N>(N / 2u);
+
+    measure(path + " copy", [&] {
+        dst = src;
+        Catch::Benchmark::keep_memory(&dst);
+    });
+    measure(path + " compare", [&] {
+        return (src == cmp) + (src < cmp);
+    });
+    measure(path + " insert/erase", [&] {
+        dst.insert(dst.cbegin() + 1, T{7});
+        dst.erase(dst.cbegin());
+        Catch::Benchmark::keep_memory(&dst);
+    });
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Tiny Whole-Buffer Kernels", "[tiny]", ((std::size_t N), N), 2, 4, 8, 16) {
+    static_assert(detail::is_tiny_v<int, N>);
+    static_assert(!detail::is_tiny_v<boxed, N>);
+    if(!count_events([] { })) {
+        WARN("Hardware performance counters unavailable, reporting time only");
+    }
+    run_kernels<int, N>("tiny N=" + std::to_string(N));
+    run_kernels<boxed, N>("generic N=" + std::to_string(N));
+}
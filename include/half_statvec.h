@@ -0,0 +1,830 @@
+#ifndef HALF_STATVEC_H
+#define HALF_STATVEC_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/* Storage formats of half_statvec. fp16 is IEEE 754 binary16, with 5 exponent and 10 mantissa bits. bf16 is the
+ * upper half of a float, with 8 exponent and 7 mantissa bits */
+enum class half_format { fp16, bf16 };
+
+template <half_format Format, std::size_t N>
+class half_statvec;
+
+namespace detail {
+
+constexpr std::uint32_t float_bits(float value) noexcept;
+constexpr float bits_float(std::uint32_t bits) noexcept;
+
+/* Conversions rounding to nearest even, keeping infinities and quieting NaNs */
+template <half_format Format>
+constexpr std::uint16_t to_half(float value) noexcept;
+template <half_format Format>
+constexpr float from_half(std::uint16_t bits) noexcept;
+
+/* Whether eight elements at a time are converted in registers, with F16C for fp16 and integer shifts for bf16 */
+template <half_format Format>
+inline bool constexpr is_simd_half_v =
+#if defined(__AVX2__) && defined(__F16C__)
+    true;
+#elif defined(__AVX2__)
+    Format == half_format::bf16;
+#else
+    false;
+#endif
+
+inline std::size_t constexpr simd_half_width = 8u;
+
+#ifdef __AVX2__
+template <half_format Format>
+inline __m256 simd_load_half(std::uint16_t const* bits) noexcept;
+template <half_format Format>
+inline void simd_store_half(std::uint16_t* bits, __m256 values) noexcept;
+inline float simd_reduce(__m256 values) noexcept;
+#endif
+
+template <half_format Format>
+class half_reference {
+    public:
+        constexpr half_reference(half_reference const& other) noexcept = default;
+
+        constexpr half_reference& operator=(float value) noexcept;
+        constexpr half_reference& operator=(half_reference const& other) noexcept;
+
+        constexpr operator float() const noexcept;
+
+    private:
+        std::uint16_t* bits_;
+
+        constexpr explicit half_reference(std::uint16_t* bits) noexcept;
+
+        template <half_format, typename>
+        friend class half_iterator;
+        template <half_format, std::size_t>
+        friend class ::half_statvec;
+};
+
+template <half_format Format, typename Bits>
+class half_iterator {
+    public:
+        using value_type        = float;
+        using reference         = std::conditional_t<std::is_const_v<Bits>, float, half_reference<Format>>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr half_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Bits> && !std::is_same_v<U, Bits>>>
+        constexpr half_iterator(half_iterator<Format, U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr half_iterator& operator++() noexcept;
+        constexpr half_iterator operator++(int) noexcept;
+
+        constexpr half_iterator& operator--() noexcept;
+        constexpr half_iterator operator--(int) noexcept;
+
+        constexpr half_iterator& operator+=(difference_type n) noexcept;
+        constexpr half_iterator& operator-=(difference_type n) noexcept;
+
+        template <half_format F, typename U>
+        friend constexpr bool operator==(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+        template <half_format F, typename U>
+        friend constexpr bool operator!=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+        template <half_format F, typename U>
+        friend constexpr bool operator<=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+        template <half_format F, typename U>
+        friend constexpr bool operator>=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+        template <half_format F, typename U>
+        friend constexpr bool operator<(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+        template <half_format F, typename U>
+        friend constexpr bool operator>(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept;
+
+        template <half_format F, typename U>
+        friend constexpr half_iterator<F, U> operator+(half_iterator<F, U> const& it, typename half_iterator<F, U>::difference_type n) noexcept;
+        template <half_format F, typename U>
+        friend constexpr half_iterator<F, U> operator+(typename half_iterator<F, U>::difference_type n, half_iterator<F, U> const& it) noexcept;
+        template <half_format F, typename U>
+        friend constexpr half_iterator<F, U> operator-(half_iterator<F, U> const& it, typename half_iterator<F, U>::difference_type n) noexcept;
+        template <half_format F, typename U>
+        friend constexpr typename half_iterator<F, U>::difference_type operator-(half_iterator<F, U> const& lhs,
+                                                                                 half_iterator<F, U> const& rhs) noexcept;
+
+    private:
+        Bits* bits_{};
+
+        constexpr explicit half_iterator(Bits* bits) noexcept;
+
+        template <half_format, typename>
+        friend class half_iterator;
+        template <half_format, std::size_t>
+        friend class ::half_statvec;
+};
+
+} // namespace detail
+
+/* Fixed-capacity vector of floats stored at 16 bits each, in fp16 or bf16. Stored values are rounded to the nearest
+ * representable one. Bulk conversion and the sum and dot product kernels convert eight elements per instruction where
+ * the target supports it */
+template <half_format Format, std::size_t N>
+class half_statvec {
+    public:
+        using value_type             = float;
+        using reference              = detail::half_reference<Format>;
+        using const_reference        = float;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = detail::half_iterator<Format, std::uint16_t>;
+        using const_iterator         = detail::half_iterator<Format, std::uint16_t const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static half_format constexpr format = Format;
+
+        constexpr half_statvec() noexcept = default;
+
+        constexpr bool assign(size_type count, float value) noexcept;
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool assign(It first, It last) noexcept(noexcept(static_cast<float>(*first)));
+
+        template <std::size_t M>
+        constexpr bool pack(statvec<float, M> const& values) noexcept;
+        template <std::size_t M>
+        constexpr bool unpack(statvec<float, M>& values) const noexcept;
+
+        constexpr float sum() const noexcept;
+        template <std::size_t M>
+        constexpr float dot(statvec<float, M> const& other) const noexcept;
+        template <std::size_t M>
+        constexpr float dot(half_statvec<Format, M> const& other) const noexcept;
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr std::uint16_t* data() noexcept;
+        constexpr std::uint16_t const* data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(half_statvec& other) noexcept;
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size, float value = 0.f) noexcept;
+
+        constexpr bool push_back(float value) noexcept;
+        constexpr float pop_back() noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<std::uint16_t, N> bits_{};
+        size_type size_{};
+
+        template <typename Other>
+        constexpr float dot(Other const* other, size_type size) const noexcept;
+};
+
+template <std::size_t N>
+using fp16_statvec = half_statvec<half_format::fp16, N>;
+template <std::size_t N>
+using bf16_statvec = half_statvec<half_format::bf16, N>;
+
+/* Compares the stored bits, so equal NaNs compare equal and zeros of opposite sign do not */
+template <half_format Format, std::size_t N>
+constexpr bool operator==(half_statvec<Format, N> const& lhs, half_statvec<Format, N> const& rhs) noexcept;
+template <half_format Format, std::size_t N>
+constexpr bool operator!=(half_statvec<Format, N> const& lhs, half_statvec<Format, N> const& rhs) noexcept;
+
+namespace detail {
+
+constexpr std::uint32_t float_bits(float value) noexcept {
+    return __builtin_bit_cast(std::uint32_t, value);
+}
+
+constexpr float bits_float(std::uint32_t bits) noexcept {
+    return __builtin_bit_cast(float, bits);
+}
+
+template <half_format Format>
+constexpr std::uint16_t to_half(float value) noexcept {
+    auto const bits = float_bits(value);
+    if constexpr(Format == half_format::bf16) {
+        if((bits & 0x7fffffffu) > 0x7f800000u) {
+            return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+        }
+        return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+    }
+    else {
+        auto const sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+        auto const magnitude = bits & 0x7fffffffu;
+        if(magnitude > 0x7f800000u) {
+            return static_cast<std::uint16_t>(sign | 0x7e00u | ((magnitude >> 13) & 0x3ffu));
+        }
+        if(magnitude >= 0x47800000u) {
+            /* At least 2^16, past the largest finite value even before rounding */
+            return static_cast<std::uint16_t>(sign | 0x7c00u);
+        }
+        if(magnitude >= 0x38800000u) {
+            /* Normal, rebias the exponent from 127 to 15. Rounding up may carry into the exponent, up to infinity */
+            auto half = (magnitude - 0x38000000u) >> 13;
+            auto const rest = magnitude & 0x1fffu;
+            half += rest > 0x1000u || (rest == 0x1000u && (half & 1u));
+            return static_cast<std::uint16_t>(sign | half);
+        }
+        if(magnitude < 0x33000000u) {
+            /* At most 2^-25, which rounds to zero */
+            return sign;
+        }
+        /* Subnormal, the mantissa with its implicit bit scaled to units of 2^-24 */
+        auto const mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+        auto const shift = 126u - (magnitude >> 23);
+        auto half = mantissa >> shift;
+        auto const rest = mantissa & ((1u << shift) - 1u);
+        auto const tie = 1u << (shift - 1u);
+        half += rest > tie || (rest == tie && (half & 1u));
+        return static_cast<std::uint16_t>(sign | half);
+    }
+}
+
+template <half_format Format>
+constexpr float from_half(std::uint16_t bits) noexcept {
+    if constexpr(Format == half_format::bf16) {
+        return bits_float(static_cast<std::uint32_t>(bits) << 16);
+    }
+    else {
+        auto const sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+        auto const exponent = (bits >> 10) & 0x1fu;
+        auto const mantissa = static_cast<std::uint32_t>(bits & 0x3ffu);
+        if(exponent == 0x1fu) {
+            return bits_float(sign | 0x7f800000u | (mantissa << 13));
+        }
+        if(!exponent) {
+            /* Zero or subnormal, in units of 2^-24 */
+            auto const magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+            return sign ? -magnitude : magnitude;
+        }
+        return bits_float(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+    }
+}
+
+#ifdef __AVX2__
+template <half_format Format>
+inline __m256 simd_load_half(std::uint16_t const* bits) noexcept {
+    auto const halves = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bits));
+    if constexpr(Format == half_format::bf16) {
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(halves), 16));
+    }
+    else {
+#ifdef __F16C__
+        return _mm256_cvtph_ps(halves);
+#endif
+    }
+}
+
+template <half_format Format>
+inline void simd_store_half(std::uint16_t* bits, __m256 values) noexcept {
+    __m128i halves;
+    if constexpr(Format == half_format::bf16) {
+        /* Same rounding as to_half, setting the quiet bit of NaNs first so that they cannot round to infinity */
+        auto const nan = _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q));
+        auto words = _mm256_or_si256(_mm256_castps_si256(values), _mm256_and_si256(nan, _mm256_set1_epi32(0x400000)));
+        auto const odd = _mm256_and_si256(_mm256_srli_epi32(words, 16), _mm256_set1_epi32(1));
+        words = _mm256_srli_epi32(_mm256_add_epi32(words, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7fff))), 16);
+        /* Packing works within 128-bit lanes, gather the low quarter of each lane */
+        auto const packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(words, words), 0x08);
+        halves = _mm256_castsi256_si128(packed);
+    }
+    else {
+#ifdef __F16C__
+        halves = _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#endif
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bits), halves);
+}
+
+inline float simd_reduce(__m256 values) noexcept {
+    auto sum = _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+template <half_format Format>
+constexpr half_reference<Format>::half_reference(std::uint16_t* bits) noexcept : bits_{bits} { }
+
+template <half_format Format>
+constexpr half_reference<Format>& half_reference<Format>::operator=(float value) noexcept {
+    *bits_ = to_half<Format>(value);
+    return *this;
+}
+
+template <half_format Format>
+constexpr half_reference<Format>& half_reference<Format>::operator=(half_reference const& other) noexcept {
+    *bits_ = *other.bits_;
+    return *this;
+}
+
+template <half_format Format>
+constexpr half_reference<Format>::operator float() const noexcept {
+    return from_half<Format>(*bits_);
+}
+
+template <half_format Format, typename Bits>
+template <typename U, typename>
+constexpr half_iterator<Format, Bits>::half_iterator(half_iterator<Format, U> const& other) noexcept : bits_{other.bits_} { }
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits>::half_iterator(Bits* bits) noexcept : bits_{bits} { }
+
+template <half_format Format, typename Bits>
+constexpr typename half_iterator<Format, Bits>::reference half_iterator<Format, Bits>::operator*() const noexcept {
+    if constexpr(std::is_const_v<Bits>) {
+        return from_half<Format>(*bits_);
+    }
+    else {
+        return half_reference<Format>{bits_};
+    }
+}
+
+template <half_format Format, typename Bits>
+constexpr typename half_iterator<Format, Bits>::reference half_iterator<Format, Bits>::operator[](difference_type i) const noexcept {
+    return *(*this + i);
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits>& half_iterator<Format, Bits>::operator++() noexcept {
+    ++bits_;
+    return *this;
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits> half_iterator<Format, Bits>::operator++(int) noexcept {
+    auto const it = *this;
+    ++bits_;
+    return it;
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits>& half_iterator<Format, Bits>::operator--() noexcept {
+    --bits_;
+    return *this;
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits> half_iterator<Format, Bits>::operator--(int) noexcept {
+    auto const it = *this;
+    --bits_;
+    return it;
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits>& half_iterator<Format, Bits>::operator+=(difference_type n) noexcept {
+    bits_ += n;
+    return *this;
+}
+
+template <half_format Format, typename Bits>
+constexpr half_iterator<Format, Bits>& half_iterator<Format, Bits>::operator-=(difference_type n) noexcept {
+    bits_ -= n;
+    return *this;
+}
+
+template <half_format F, typename U>
+constexpr bool operator==(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ == rhs.bits_;
+}
+
+template <half_format F, typename U>
+constexpr bool operator!=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <half_format F, typename U>
+constexpr bool operator<=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ <= rhs.bits_;
+}
+
+template <half_format F, typename U>
+constexpr bool operator>=(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ >= rhs.bits_;
+}
+
+template <half_format F, typename U>
+constexpr bool operator<(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ < rhs.bits_;
+}
+
+template <half_format F, typename U>
+constexpr bool operator>(half_iterator<F, U> const& lhs, half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ > rhs.bits_;
+}
+
+template <half_format F, typename U>
+constexpr half_iterator<F, U> operator+(half_iterator<F, U> const& it, typename half_iterator<F, U>::difference_type n) noexcept {
+    return half_iterator<F, U>{it.bits_ + n};
+}
+
+template <half_format F, typename U>
+constexpr half_iterator<F, U> operator+(typename half_iterator<F, U>::difference_type n, half_iterator<F, U> const& it) noexcept {
+    return it + n;
+}
+
+template <half_format F, typename U>
+constexpr half_iterator<F, U> operator-(half_iterator<F, U> const& it, typename half_iterator<F, U>::difference_type n) noexcept {
+    return half_iterator<F, U>{it.bits_ - n};
+}
+
+template <half_format F, typename U>
+constexpr typename half_iterator<F, U>::difference_type operator-(half_iterator<F, U> const& lhs,
+                                                                  half_iterator<F, U> const& rhs) noexcept {
+    return lhs.bits_ - rhs.bits_;
+}
+
+} // namespace detail
+
+/* Returns false if count exceeds the capacity, in which case the vector is filled to capacity */
+template <half_format Format, std::size_t N>
+constexpr bool half_statvec<Format, N>::assign(size_type count, float value) noexcept {
+    clear();
+    return resize(count, value);
+}
+
+template <half_format Format, std::size_t N>
+template <typename It, typename>
+constexpr bool half_statvec<Format, N>::assign(It first, It last) noexcept(noexcept(static_cast<float>(*first))) {
+    clear();
+    for(; first != last; ++first) {
+        if(!push_back(static_cast<float>(*first))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Replaces the contents with values. Returns false if values holds more than N elements, in which case the first N
+ * are stored */
+template <half_format Format, std::size_t N>
+template <std::size_t M>
+constexpr bool half_statvec<Format, N>::pack(statvec<float, M> const& values) noexcept {
+    size_ = values.size() < N ? values.size() : N;
+    size_type i = 0u;
+#ifdef __AVX2__
+    if constexpr(detail::is_simd_half_v<Format>) {
+        if(!__builtin_is_constant_evaluated()) {
+            for(; i + detail::simd_half_width <= size_; i += detail::simd_half_width) {
+                detail::simd_store_half<Format>(bits_.data() + i, _mm256_loadu_ps(values.data() + i));
+            }
+        }
+    }
+#endif
+    for(; i < size_; i++) {
+        bits_[i] = detail::to_half<Format>(values[i]);
+    }
+    return values.size() <= N;
+}
+
+/* Replaces the contents of values with the elements. Returns false if values cannot hold all of them, in which case
+ * it receives as many as fit */
+template <half_format Format, std::size_t N>
+template <std::size_t M>
+constexpr bool half_statvec<Format, N>::unpack(statvec<float, M>& values) const noexcept {
+    auto const fits = values.resize(size_);
+    auto const size = values.size();
+    size_type i = 0u;
+#ifdef __AVX2__
+    if constexpr(detail::is_simd_half_v<Format>) {
+        if(!__builtin_is_constant_evaluated()) {
+            for(; i + detail::simd_half_width <= size; i += detail::simd_half_width) {
+                _mm256_storeu_ps(values.data() + i, detail::simd_load_half<Format>(bits_.data() + i));
+            }
+        }
+    }
+#endif
+    for(; i < size; i++) {
+        values[i] = detail::from_half<Format>(bits_[i]);
+    }
+    return fits;
+}
+
+/* The kernels accumulate in float, eight partial sums at a time where vectorized, so their rounding differs from a
+ * sequential loop */
+template <half_format Format, std::size_t N>
+constexpr float half_statvec<Format, N>::sum() const noexcept {
+    return dot(static_cast<float const*>(nullptr), size_);
+}
+
+/* Dot product over the first min(size(), other.size()) elements */
+template <half_format Format, std::size_t N>
+template <std::size_t M>
+constexpr float half_statvec<Format, N>::dot(statvec<float, M> const& other) const noexcept {
+    return dot(other.data(), size_ < other.size() ? size_ : other.size());
+}
+
+template <half_format Format, std::size_t N>
+template <std::size_t M>
+constexpr float half_statvec<Format, N>::dot(half_statvec<Format, M> const& other) const noexcept {
+    return dot(other.data(), size_ < other.size() ? size_ : other.size());
+}
+
+/* Other is float for a statvec, std::uint16_t for another half_statvec, or a null float pointer for a plain sum */
+template <half_format Format, std::size_t N>
+template <typename Other>
+constexpr float half_statvec<Format, N>::dot(Other const* other, size_type size) const noexcept {
+    auto const factor = [other](size_type i) {
+        if constexpr(std::is_same_v<Other, float>) {
+            return other ? other[i] : 1.f;
+        }
+        else {
+            return detail::from_half<Format>(other[i]);
+        }
+    };
+
+    float result = 0.f;
+    size_type i = 0u;
+#ifdef __AVX2__
+    if constexpr(detail::is_simd_half_v<Format>) {
+        if(!__builtin_is_constant_evaluated()) {
+            /* Two accumulators hide the latency of the additions */
+            auto lo = _mm256_setzero_ps();
+            auto hi = _mm256_setzero_ps();
+            auto const load = [other](size_type k) {
+                if constexpr(std::is_same_v<Other, float>) {
+                    return other ? _mm256_loadu_ps(other + k) : _mm256_set1_ps(1.f);
+                }
+                else {
+                    return detail::simd_load_half<Format>(other + k);
+                }
+            };
+            auto const madd = [](__m256 lhs, __m256 rhs, __m256 acc) {
+#ifdef __FMA__
+                return _mm256_fmadd_ps(lhs, rhs, acc);
+#else
+                return _mm256_add_ps(_mm256_mul_ps(lhs, rhs), acc);
+#endif
+            };
+            for(; i + 2u * detail::simd_half_width <= size; i += 2u * detail::simd_half_width) {
+                lo = madd(detail::simd_load_half<Format>(bits_.data() + i), load(i), lo);
+                hi = madd(detail::simd_load_half<Format>(bits_.data() + i + detail::simd_half_width),
+                          load(i + detail::simd_half_width), hi);
+            }
+            result = detail::simd_reduce(_mm256_add_ps(lo, hi));
+        }
+    }
+#endif
+    for(; i < size; i++) {
+        result += detail::from_half<Format>(bits_[i]) * factor(i);
+    }
+    return result;
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reference half_statvec<Format, N>::operator[](size_type i) noexcept {
+    return reference{bits_.data() + i};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reference half_statvec<Format, N>::operator[](size_type i) const noexcept {
+    return detail::from_half<Format>(bits_[i]);
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reference half_statvec<Format, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reference half_statvec<Format, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reference half_statvec<Format, N>::front() noexcept {
+    return (*this)[0];
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reference half_statvec<Format, N>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reference half_statvec<Format, N>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reference half_statvec<Format, N>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <half_format Format, std::size_t N>
+constexpr std::uint16_t* half_statvec<Format, N>::data() noexcept {
+    return bits_.data();
+}
+
+template <half_format Format, std::size_t N>
+constexpr std::uint16_t const* half_statvec<Format, N>::data() const noexcept {
+    return bits_.data();
+}
+
+template <half_format Format, std::size_t N>
+constexpr bool half_statvec<Format, N>::empty() const noexcept {
+    return !size_;
+}
+
+template <half_format Format, std::size_t N>
+constexpr bool half_statvec<Format, N>::full() const noexcept {
+    return size_ == N;
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::size_type half_statvec<Format, N>::size() const noexcept {
+    return size_;
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::size_type half_statvec<Format, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::size_type half_statvec<Format, N>::capacity() const noexcept {
+    return N;
+}
+
+template <half_format Format, std::size_t N>
+constexpr void half_statvec<Format, N>::swap(half_statvec& other) noexcept {
+    auto const size = size_ > other.size_ ? size_ : other.size_;
+    for(size_type i = 0u; i < size; i++) {
+        auto const bits = bits_[i];
+        bits_[i] = other.bits_[i];
+        other.bits_[i] = bits;
+    }
+    auto const own = size_;
+    size_ = other.size_;
+    other.size_ = own;
+}
+
+template <half_format Format, std::size_t N>
+constexpr void half_statvec<Format, N>::clear() noexcept {
+    size_ = 0u;
+}
+
+/* Growing sets the new elements to value. Returns false if size exceeds the capacity, in which case the vector is
+ * resized to capacity */
+template <half_format Format, std::size_t N>
+constexpr bool half_statvec<Format, N>::resize(size_type size, float value) noexcept {
+    auto const fits = size <= capacity();
+    size = fits ? size : capacity();
+    auto const bits = detail::to_half<Format>(value);
+    for(auto i = size_; i < size; i++) {
+        bits_[i] = bits;
+    }
+    size_ = size;
+    return fits;
+}
+
+template <half_format Format, std::size_t N>
+constexpr bool half_statvec<Format, N>::push_back(float value) noexcept {
+    if(full()) {
+        return false;
+    }
+    bits_[size_++] = detail::to_half<Format>(value);
+    return true;
+}
+
+template <half_format Format, std::size_t N>
+constexpr float half_statvec<Format, N>::pop_back() noexcept {
+    return detail::from_half<Format>(bits_[--size_]);
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::iterator half_statvec<Format, N>::begin() noexcept {
+    return iterator{bits_.data()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::iterator half_statvec<Format, N>::end() noexcept {
+    return iterator{bits_.data() + size_};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_iterator half_statvec<Format, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_iterator half_statvec<Format, N>::end() const noexcept {
+    return cend();
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_iterator half_statvec<Format, N>::cbegin() const noexcept {
+    return const_iterator{bits_.data()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_iterator half_statvec<Format, N>::cend() const noexcept {
+    return const_iterator{bits_.data() + size_};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reverse_iterator half_statvec<Format, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::reverse_iterator half_statvec<Format, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reverse_iterator half_statvec<Format, N>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reverse_iterator half_statvec<Format, N>::rend() const noexcept {
+    return crend();
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reverse_iterator half_statvec<Format, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr typename half_statvec<Format, N>::const_reverse_iterator half_statvec<Format, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <half_format Format, std::size_t N>
+constexpr bool operator==(half_statvec<Format, N> const& lhs, half_statvec<Format, N> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0u; i < lhs.size(); i++) {
+        if(lhs.data()[i] != rhs.data()[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <half_format Format, std::size_t N>
+constexpr bool operator!=(half_statvec<Format, N> const& lhs, half_statvec<Format, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* HALF_STATVEC_H */
@@ -0,0 +1,730 @@
+#ifndef PACKED_STATVEC_H
+#define PACKED_STATVEC_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <std::size_t Bits, std::size_t N>
+class packed_statvec;
+
+namespace detail {
+
+/* Smallest unsigned type holding Bits bits */
+template <std::size_t Bits>
+using packed_value_t = std::conditional_t<(Bits <= 8u), std::uint8_t,
+                       std::conditional_t<(Bits <= 16u), std::uint16_t, std::uint32_t>>;
+
+template <std::size_t Bits>
+inline std::uint64_t constexpr packed_mask = (std::uint64_t{1} << Bits) - 1u;
+
+/* Elements per block, a block of 64 elements filling exactly Bits words */
+inline std::size_t constexpr packed_block = 64u;
+
+/* The Bits bits at offset shift of word[0], continuing into word[1]. Both words are always read, the second shifted
+ * in two steps so that an offset of zero does not shift by 64 */
+template <std::size_t Bits>
+constexpr std::uint64_t packed_read(std::uint64_t const* word, std::size_t shift) noexcept {
+    return ((word[0] >> shift) | (word[1] << 1u << (63u - shift))) & packed_mask<Bits>;
+}
+
+/* The value of element i. Words hold one word of padding past the last element, so that an element can always be
+ * read from two neighbouring words */
+template <std::size_t Bits>
+constexpr std::uint64_t packed_get(std::uint64_t const* words, std::size_t i) noexcept;
+template <std::size_t Bits>
+constexpr void packed_set(std::uint64_t* words, std::size_t i, std::uint64_t value) noexcept;
+
+/* Unpacking and packing of whole blocks, with the position of every element known at compile time, so that all
+ * shifts are constants and the block can be unrolled and vectorized */
+template <std::size_t Bits, typename T, std::size_t... Js>
+constexpr void unpack_block(std::uint64_t const* words, T* out, std::index_sequence<Js...>) noexcept;
+template <std::size_t Bits, typename T, std::size_t... Js>
+constexpr void pack_block(T const* in, std::uint64_t* words, std::index_sequence<Js...>) noexcept;
+
+template <std::size_t Bits>
+class packed_reference {
+    using value_type = packed_value_t<Bits>;
+
+    public:
+        constexpr packed_reference(packed_reference const& other) noexcept = default;
+
+        constexpr packed_reference& operator=(value_type value) noexcept;
+        constexpr packed_reference& operator=(packed_reference const& other) noexcept;
+
+        constexpr operator value_type() const noexcept;
+
+    private:
+        std::uint64_t* words_;
+        std::size_t index_;
+
+        constexpr packed_reference(std::uint64_t* words, std::size_t index) noexcept;
+
+        template <std::size_t, typename>
+        friend class packed_iterator;
+        template <std::size_t, std::size_t>
+        friend class ::packed_statvec;
+};
+
+template <std::size_t Bits, typename Word>
+class packed_iterator {
+    public:
+        using value_type        = packed_value_t<Bits>;
+        using reference         = std::conditional_t<std::is_const_v<Word>, value_type, packed_reference<Bits>>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr packed_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Word> && !std::is_same_v<U, Word>>>
+        constexpr packed_iterator(packed_iterator<Bits, U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr packed_iterator& operator++() noexcept;
+        constexpr packed_iterator operator++(int) noexcept;
+
+        constexpr packed_iterator& operator--() noexcept;
+        constexpr packed_iterator operator--(int) noexcept;
+
+        constexpr packed_iterator& operator+=(difference_type n) noexcept;
+        constexpr packed_iterator& operator-=(difference_type n) noexcept;
+
+        template <std::size_t B, typename U>
+        friend constexpr bool operator==(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr bool operator!=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr bool operator<=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr bool operator>=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr bool operator<(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr bool operator>(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept;
+
+        template <std::size_t B, typename U>
+        friend constexpr packed_iterator<B, U> operator+(packed_iterator<B, U> const& it, typename packed_iterator<B, U>::difference_type n) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr packed_iterator<B, U> operator+(typename packed_iterator<B, U>::difference_type n, packed_iterator<B, U> const& it) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr packed_iterator<B, U> operator-(packed_iterator<B, U> const& it, typename packed_iterator<B, U>::difference_type n) noexcept;
+        template <std::size_t B, typename U>
+        friend constexpr typename packed_iterator<B, U>::difference_type operator-(packed_iterator<B, U> const& lhs,
+                                                                                   packed_iterator<B, U> const& rhs) noexcept;
+
+    private:
+        Word* words_{};
+        difference_type index_{};
+
+        constexpr packed_iterator(Word* words, difference_type index) noexcept;
+
+        template <std::size_t, typename>
+        friend class packed_iterator;
+        template <std::size_t, std::size_t>
+        friend class ::packed_statvec;
+};
+
+/* Reads elements in order without bounds checks, keeping its position as a word pointer and a bit offset rather than
+ * recomputing both from an index for every element */
+template <std::size_t Bits>
+class packed_decoder {
+    using value_type = packed_value_t<Bits>;
+
+    public:
+        constexpr value_type next() noexcept;
+
+    private:
+        std::uint64_t const* word_;
+        std::size_t offset_;
+
+        constexpr packed_decoder(std::uint64_t const* word, std::size_t offset) noexcept;
+
+        template <std::size_t, std::size_t>
+        friend class ::packed_statvec;
+};
+
+} // namespace detail
+
+/* Fixed-capacity vector of unsigned integers of exactly Bits bits each, packed back to back into 64-bit words. Values
+ * are truncated to their low Bits bits on the way in */
+template <std::size_t Bits, std::size_t N>
+class packed_statvec {
+    static_assert(Bits >= 1u && Bits <= 32u, "Elements must have between 1 and 32 bits");
+
+    static std::size_t constexpr words = (N * Bits + 63u) / 64u + 1u;
+
+    public:
+        using value_type             = detail::packed_value_t<Bits>;
+        using reference              = detail::packed_reference<Bits>;
+        using const_reference        = value_type;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using decoder                = detail::packed_decoder<Bits>;
+
+        using iterator               = detail::packed_iterator<Bits, std::uint64_t>;
+        using const_iterator         = detail::packed_iterator<Bits, std::uint64_t const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr packed_statvec() noexcept = default;
+
+        constexpr bool assign(size_type count, value_type value) noexcept;
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool assign(It first, It last) noexcept(noexcept(static_cast<value_type>(*first)));
+
+        template <typename T, std::size_t M>
+        constexpr bool pack(statvec<T, M> const& values) noexcept;
+        template <typename T, std::size_t M>
+        constexpr bool unpack(statvec<T, M>& values) const noexcept;
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr decoder decode(size_type first = 0u) const noexcept;
+
+        constexpr std::uint64_t const* data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(packed_statvec& other) noexcept;
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size, value_type value = 0u) noexcept;
+
+        constexpr iterator insert(const_iterator pos, value_type value) noexcept;
+        constexpr bool push_back(value_type value) noexcept;
+        constexpr value_type pop_back() noexcept;
+        constexpr iterator erase(const_iterator pos) noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<std::uint64_t, words> words_{};
+        size_type size_{};
+};
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool operator==(packed_statvec<Bits, N> const& lhs, packed_statvec<Bits, N> const& rhs) noexcept;
+template <std::size_t Bits, std::size_t N>
+constexpr bool operator!=(packed_statvec<Bits, N> const& lhs, packed_statvec<Bits, N> const& rhs) noexcept;
+
+namespace detail {
+
+template <std::size_t Bits>
+constexpr std::uint64_t packed_get(std::uint64_t const* words, std::size_t i) noexcept {
+    auto const bit = i * Bits;
+    auto const word = bit / 64u;
+    auto const shift = bit % 64u;
+    return packed_read<Bits>(words + word, shift);
+}
+
+template <std::size_t Bits>
+constexpr void packed_set(std::uint64_t* words, std::size_t i, std::uint64_t value) noexcept {
+    value &= packed_mask<Bits>;
+    auto const bit = i * Bits;
+    auto const word = bit / 64u;
+    auto const shift = bit % 64u;
+    words[word] = (words[word] & ~(packed_mask<Bits> << shift)) | (value << shift);
+    if(shift + Bits > 64u) {
+        words[word + 1u] = (words[word + 1u] & ~(packed_mask<Bits> >> (64u - shift))) | (value >> (64u - shift));
+    }
+}
+
+template <std::size_t Bits, typename T, std::size_t... Js>
+constexpr void unpack_block(std::uint64_t const* words, T* out, std::index_sequence<Js...>) noexcept {
+    ((out[Js] = static_cast<T>(packed_get<Bits>(words, Js))), ...);
+}
+
+template <std::size_t Bits, typename T, std::size_t... Js>
+constexpr void pack_block(T const* in, std::uint64_t* words, std::index_sequence<Js...>) noexcept {
+    std::uint64_t block[Bits + 1u]{};
+    auto const put = [&block](std::size_t j, std::uint64_t value) {
+        auto const bit = j * Bits;
+        block[bit / 64u] |= value << (bit % 64u);
+        if(bit % 64u + Bits > 64u) {
+            block[bit / 64u + 1u] |= value >> (64u - bit % 64u);
+        }
+    };
+    (put(Js, static_cast<std::uint64_t>(in[Js]) & packed_mask<Bits>), ...);
+    for(std::size_t k = 0u; k < Bits; k++) {
+        words[k] = block[k];
+    }
+}
+
+template <std::size_t Bits>
+constexpr packed_reference<Bits>::packed_reference(std::uint64_t* words, std::size_t index) noexcept
+    : words_{words}, index_{index} { }
+
+template <std::size_t Bits>
+constexpr packed_reference<Bits>& packed_reference<Bits>::operator=(value_type value) noexcept {
+    packed_set<Bits>(words_, index_, value);
+    return *this;
+}
+
+template <std::size_t Bits>
+constexpr packed_reference<Bits>& packed_reference<Bits>::operator=(packed_reference const& other) noexcept {
+    return *this = static_cast<value_type>(other);
+}
+
+template <std::size_t Bits>
+constexpr packed_reference<Bits>::operator value_type() const noexcept {
+    return static_cast<value_type>(packed_get<Bits>(words_, index_));
+}
+
+template <std::size_t Bits, typename Word>
+template <typename U, typename>
+constexpr packed_iterator<Bits, Word>::packed_iterator(packed_iterator<Bits, U> const& other) noexcept
+    : words_{other.words_}, index_{other.index_} { }
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word>::packed_iterator(Word* words, difference_type index) noexcept
+    : words_{words}, index_{index} { }
+
+template <std::size_t Bits, typename Word>
+constexpr typename packed_iterator<Bits, Word>::reference packed_iterator<Bits, Word>::operator*() const noexcept {
+    if constexpr(std::is_const_v<Word>) {
+        return static_cast<value_type>(packed_get<Bits>(words_, static_cast<std::size_t>(index_)));
+    }
+    else {
+        return packed_reference<Bits>{words_, static_cast<std::size_t>(index_)};
+    }
+}
+
+template <std::size_t Bits, typename Word>
+constexpr typename packed_iterator<Bits, Word>::reference packed_iterator<Bits, Word>::operator[](difference_type i) const noexcept {
+    return *(*this + i);
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word>& packed_iterator<Bits, Word>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word> packed_iterator<Bits, Word>::operator++(int) noexcept {
+    auto const it = *this;
+    ++index_;
+    return it;
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word>& packed_iterator<Bits, Word>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word> packed_iterator<Bits, Word>::operator--(int) noexcept {
+    auto const it = *this;
+    --index_;
+    return it;
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word>& packed_iterator<Bits, Word>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <std::size_t Bits, typename Word>
+constexpr packed_iterator<Bits, Word>& packed_iterator<Bits, Word>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator==(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator!=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator<=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator>=(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator<(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+}
+
+template <std::size_t B, typename U>
+constexpr bool operator>(packed_iterator<B, U> const& lhs, packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+}
+
+template <std::size_t B, typename U>
+constexpr packed_iterator<B, U> operator+(packed_iterator<B, U> const& it, typename packed_iterator<B, U>::difference_type n) noexcept {
+    return packed_iterator<B, U>{it.words_, it.index_ + n};
+}
+
+template <std::size_t B, typename U>
+constexpr packed_iterator<B, U> operator+(typename packed_iterator<B, U>::difference_type n, packed_iterator<B, U> const& it) noexcept {
+    return it + n;
+}
+
+template <std::size_t B, typename U>
+constexpr packed_iterator<B, U> operator-(packed_iterator<B, U> const& it, typename packed_iterator<B, U>::difference_type n) noexcept {
+    return packed_iterator<B, U>{it.words_, it.index_ - n};
+}
+
+template <std::size_t B, typename U>
+constexpr typename packed_iterator<B, U>::difference_type operator-(packed_iterator<B, U> const& lhs,
+                                                                    packed_iterator<B, U> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+template <std::size_t Bits>
+constexpr packed_decoder<Bits>::packed_decoder(std::uint64_t const* word, std::size_t offset) noexcept
+    : word_{word}, offset_{offset} { }
+
+template <std::size_t Bits>
+constexpr typename packed_decoder<Bits>::value_type packed_decoder<Bits>::next() noexcept {
+    auto const value = packed_read<Bits>(word_, offset_);
+    offset_ += Bits;
+    if(offset_ >= 64u) {
+        offset_ -= 64u;
+        ++word_;
+    }
+    return static_cast<value_type>(value);
+}
+
+} // namespace detail
+
+/* Returns false if count exceeds the capacity, in which case the vector is filled to capacity */
+template <std::size_t Bits, std::size_t N>
+constexpr bool packed_statvec<Bits, N>::assign(size_type count, value_type value) noexcept {
+    clear();
+    return resize(count, value);
+}
+
+template <std::size_t Bits, std::size_t N>
+template <typename It, typename>
+constexpr bool packed_statvec<Bits, N>::assign(It first, It last) noexcept(noexcept(static_cast<value_type>(*first))) {
+    clear();
+    for(; first != last; ++first) {
+        if(!push_back(static_cast<value_type>(*first))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Replaces the contents with values, a block of 64 elements at a time. Returns false if values holds more than N
+ * elements, in which case the first N are packed */
+template <std::size_t Bits, std::size_t N>
+template <typename T, std::size_t M>
+constexpr bool packed_statvec<Bits, N>::pack(statvec<T, M> const& values) noexcept {
+    static_assert(std::is_integral_v<T>);
+    clear();
+    size_ = values.size() < N ? values.size() : N;
+    size_type i = 0u;
+    for(; i + detail::packed_block <= size_; i += detail::packed_block) {
+        detail::pack_block<Bits>(values.data() + i, words_.data() + i / detail::packed_block * Bits,
+                                 std::make_index_sequence<detail::packed_block>{});
+    }
+    for(; i < size_; i++) {
+        detail::packed_set<Bits>(words_.data(), i, static_cast<std::uint64_t>(values[i]));
+    }
+    return values.size() <= N;
+}
+
+/* Replaces the contents of values with the elements, a block of 64 elements at a time. Returns false if values
+ * cannot hold all of them, in which case it receives as many as fit */
+template <std::size_t Bits, std::size_t N>
+template <typename T, std::size_t M>
+constexpr bool packed_statvec<Bits, N>::unpack(statvec<T, M>& values) const noexcept {
+    static_assert(std::is_integral_v<T>);
+    auto const fits = values.resize(size_);
+    auto const size = values.size();
+    size_type i = 0u;
+    for(; i + detail::packed_block <= size; i += detail::packed_block) {
+        detail::unpack_block<Bits>(words_.data() + i / detail::packed_block * Bits, values.data() + i,
+                                   std::make_index_sequence<detail::packed_block>{});
+    }
+    for(; i < size; i++) {
+        values[i] = static_cast<T>(detail::packed_get<Bits>(words_.data(), i));
+    }
+    return fits;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reference packed_statvec<Bits, N>::operator[](size_type i) noexcept {
+    return reference{words_.data(), i};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reference packed_statvec<Bits, N>::operator[](size_type i) const noexcept {
+    return static_cast<value_type>(detail::packed_get<Bits>(words_.data(), i));
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reference packed_statvec<Bits, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reference packed_statvec<Bits, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reference packed_statvec<Bits, N>::front() noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reference packed_statvec<Bits, N>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reference packed_statvec<Bits, N>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reference packed_statvec<Bits, N>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+/* Decoder reading from element first on. It does not know the size, calling next() more than size() - first times
+ * reads past the elements */
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::decoder packed_statvec<Bits, N>::decode(size_type first) const noexcept {
+    return decoder{words_.data() + first * Bits / 64u, first * Bits % 64u};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr std::uint64_t const* packed_statvec<Bits, N>::data() const noexcept {
+    return words_.data();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool packed_statvec<Bits, N>::empty() const noexcept {
+    return !size_;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool packed_statvec<Bits, N>::full() const noexcept {
+    return size_ == N;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::size_type packed_statvec<Bits, N>::size() const noexcept {
+    return size_;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::size_type packed_statvec<Bits, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::size_type packed_statvec<Bits, N>::capacity() const noexcept {
+    return N;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr void packed_statvec<Bits, N>::swap(packed_statvec& other) noexcept {
+    for(size_type w = 0u; w < words; w++) {
+        auto const word = words_[w];
+        words_[w] = other.words_[w];
+        other.words_[w] = word;
+    }
+    auto const size = size_;
+    size_ = other.size_;
+    other.size_ = size;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr void packed_statvec<Bits, N>::clear() noexcept {
+    size_ = 0u;
+}
+
+/* Growing sets the new elements to value. Returns false if size exceeds the capacity, in which case the vector is
+ * resized to capacity */
+template <std::size_t Bits, std::size_t N>
+constexpr bool packed_statvec<Bits, N>::resize(size_type size, value_type value) noexcept {
+    auto const fits = size <= capacity();
+    size = fits ? size : capacity();
+    for(auto i = size_; i < size; i++) {
+        detail::packed_set<Bits>(words_.data(), i, value);
+    }
+    size_ = size;
+    return fits;
+}
+
+/* Returns end() if the vector is full */
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::iterator packed_statvec<Bits, N>::insert(const_iterator pos, value_type value) noexcept {
+    if(full()) {
+        return end();
+    }
+    auto const i = static_cast<size_type>(pos - cbegin());
+    for(auto k = size_; k > i; k--) {
+        detail::packed_set<Bits>(words_.data(), k, detail::packed_get<Bits>(words_.data(), k - 1u));
+    }
+    detail::packed_set<Bits>(words_.data(), i, value);
+    ++size_;
+    return begin() + static_cast<difference_type>(i);
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool packed_statvec<Bits, N>::push_back(value_type value) noexcept {
+    if(full()) {
+        return false;
+    }
+    detail::packed_set<Bits>(words_.data(), size_++, value);
+    return true;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::value_type packed_statvec<Bits, N>::pop_back() noexcept {
+    return static_cast<value_type>(detail::packed_get<Bits>(words_.data(), --size_));
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::iterator packed_statvec<Bits, N>::erase(const_iterator pos) noexcept {
+    auto const i = static_cast<size_type>(pos - cbegin());
+    for(auto k = i + 1u; k < size_; k++) {
+        detail::packed_set<Bits>(words_.data(), k - 1u, detail::packed_get<Bits>(words_.data(), k));
+    }
+    --size_;
+    return begin() + static_cast<difference_type>(i);
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::iterator packed_statvec<Bits, N>::begin() noexcept {
+    return iterator{words_.data(), 0};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::iterator packed_statvec<Bits, N>::end() noexcept {
+    return iterator{words_.data(), static_cast<difference_type>(size_)};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_iterator packed_statvec<Bits, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_iterator packed_statvec<Bits, N>::end() const noexcept {
+    return cend();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_iterator packed_statvec<Bits, N>::cbegin() const noexcept {
+    return const_iterator{words_.data(), 0};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_iterator packed_statvec<Bits, N>::cend() const noexcept {
+    return const_iterator{words_.data(), static_cast<difference_type>(size_)};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reverse_iterator packed_statvec<Bits, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::reverse_iterator packed_statvec<Bits, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reverse_iterator packed_statvec<Bits, N>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reverse_iterator packed_statvec<Bits, N>::rend() const noexcept {
+    return crend();
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reverse_iterator packed_statvec<Bits, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr typename packed_statvec<Bits, N>::const_reverse_iterator packed_statvec<Bits, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool operator==(packed_statvec<Bits, N> const& lhs, packed_statvec<Bits, N> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0u; i < lhs.size(); i++) {
+        if(lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t Bits, std::size_t N>
+constexpr bool operator!=(packed_statvec<Bits, N> const& lhs, packed_statvec<Bits, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* PACKED_STATVEC_H */
@@ -0,0 +1,631 @@
+#ifndef POLY_STATVEC_H
+#define POLY_STATVEC_H
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+class poly_statvec;
+
+namespace detail {
+
+/* Type-erased operations of one concrete type stored in a poly_statvec, the address doubles as the type's identity */
+template <typename Base>
+struct poly_ops {
+    std::size_t size;
+    void (*destroy)(void*) noexcept;
+    Base* (*relocate)(void* dst, void* src) noexcept;
+};
+
+template <typename D>
+void poly_destroy(void* obj) noexcept {
+    std::launder(static_cast<D*>(obj))->~D();
+}
+
+/* Move constructs the object at src into dst and destroys the one at src */
+template <typename Base, typename D>
+Base* poly_relocate(void* dst, void* src) noexcept {
+    auto* const from = std::launder(static_cast<D*>(src));
+    auto* const to = ::new(dst) D(std::move(*from));
+    from->~D();
+    return to;
+}
+
+template <typename Base, typename D>
+inline poly_ops<Base> constexpr poly_ops_for{sizeof(D), &poly_destroy<D>, &poly_relocate<Base, D>};
+
+template <typename Base>
+struct poly_entry {
+    Base* base;
+    poly_ops<Base> const* ops;
+    std::size_t offset;
+};
+
+/* Random access iterator over the objects of a poly_statvec, dereferencing to Base& */
+template <typename Container>
+class poly_iterator {
+    public:
+        using value_type        = std::conditional_t<std::is_const_v<Container>, typename Container::value_type const,
+                                                     typename Container::value_type>;
+        using reference         = value_type&;
+        using pointer           = value_type*;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr poly_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Container> && !std::is_same_v<U, Container>>>
+        constexpr poly_iterator(poly_iterator<U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr poly_iterator& operator++() noexcept;
+        constexpr poly_iterator operator++(int) noexcept;
+
+        constexpr poly_iterator& operator--() noexcept;
+        constexpr poly_iterator operator--(int) noexcept;
+
+        constexpr poly_iterator& operator+=(difference_type n) noexcept;
+        constexpr poly_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U>
+        friend constexpr bool operator==(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator!=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept;
+
+        template <typename U>
+        friend constexpr poly_iterator<U> operator+(poly_iterator<U> const& it, typename poly_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr poly_iterator<U> operator+(typename poly_iterator<U>::difference_type n, poly_iterator<U> const& it) noexcept;
+        template <typename U>
+        friend constexpr poly_iterator<U> operator-(poly_iterator<U> const& it, typename poly_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr typename poly_iterator<U>::difference_type operator-(poly_iterator<U> const& lhs,
+                                                                              poly_iterator<U> const& rhs) noexcept;
+
+    private:
+        Container* container_{};
+        difference_type index_{};
+
+        constexpr poly_iterator(Container* container, difference_type index) noexcept;
+
+        template <typename>
+        friend class poly_iterator;
+        template <typename, std::size_t, std::size_t, std::size_t>
+        friend class ::poly_statvec;
+};
+
+} // namespace detail
+
+/* Fixed-capacity sequence of up to N objects of types derived from Base, constructed in place in one buffer of Bytes
+ * bytes aligned to Align. An offset table records each object's Base pointer and concrete type, so iteration yields
+ * Base& without a heap allocation or pointer chase per element, and objects are destroyed through their own type
+ * whether or not Base has a virtual destructor */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align = alignof(std::max_align_t)>
+class poly_statvec {
+    static_assert(std::is_class_v<Base> && !std::is_const_v<Base> && !std::is_volatile_v<Base>);
+    static_assert(Bytes && N && Align && !(Align & (Align - 1u)));
+
+    public:
+        using value_type             = Base;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = Base&;
+        using const_reference        = Base const&;
+        using pointer                = Base*;
+        using const_pointer          = Base const*;
+
+        using iterator               = detail::poly_iterator<poly_statvec>;
+        using const_iterator         = detail::poly_iterator<poly_statvec const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        poly_statvec() noexcept = default;
+        poly_statvec(poly_statvec const&) = delete;
+        poly_statvec(poly_statvec&& other) noexcept;
+
+        poly_statvec& operator=(poly_statvec const&) = delete;
+        poly_statvec& operator=(poly_statvec&& other) noexcept;
+
+        ~poly_statvec();
+
+        reference operator[](size_type i) noexcept;
+        const_reference operator[](size_type i) const noexcept;
+
+        reference at(size_type i);
+        const_reference at(size_type i) const;
+
+        reference front() noexcept;
+        const_reference front() const noexcept;
+
+        reference back() noexcept;
+        const_reference back() const noexcept;
+
+        template <typename D>
+        bool holds(size_type i) const noexcept;
+
+        bool empty() const noexcept;
+        bool full() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        size_type capacity() const noexcept;
+        size_type bytes_used() const noexcept;
+        size_type byte_capacity() const noexcept;
+
+        void swap(poly_statvec& other) noexcept;
+        void clear() noexcept;
+
+        template <typename D, typename... Ts>
+        bool emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<D, Ts&&...>);
+        template <typename D, typename = std::enable_if_t<std::is_base_of_v<Base, std::decay_t<D>>>>
+        bool push_back(D&& value) noexcept(std::is_nothrow_constructible_v<std::decay_t<D>, D&&>);
+
+        void pop_back() noexcept;
+        iterator erase(const_iterator pos) noexcept;
+
+        void sort_by_type() noexcept;
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        reverse_iterator rbegin() noexcept;
+        reverse_iterator rend() noexcept;
+
+        const_reverse_iterator rbegin() const noexcept;
+        const_reverse_iterator rend() const noexcept;
+
+        const_reverse_iterator crbegin() const noexcept;
+        const_reverse_iterator crend() const noexcept;
+
+    private:
+        alignas(Align) std::array<unsigned char, Bytes> buf_;
+        std::array<detail::poly_entry<Base>, N> entries_;
+        size_type size_{};
+        size_type used_{};
+        /* Whether offsets ascend along the table, so that the last entry is the highest object */
+        bool ordered_{true};
+
+        void relocate_from(poly_statvec& other) noexcept;
+        void reclaim() noexcept;
+};
+
+namespace detail {
+
+template <typename Container>
+template <typename U, typename>
+constexpr poly_iterator<Container>::poly_iterator(poly_iterator<U> const& other) noexcept
+    : container_{other.container_}, index_{other.index_} { }
+
+template <typename Container>
+constexpr poly_iterator<Container>::poly_iterator(Container* container, difference_type index) noexcept
+    : container_{container}, index_{index} { }
+
+template <typename Container>
+constexpr typename poly_iterator<Container>::reference poly_iterator<Container>::operator*() const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_)];
+}
+
+template <typename Container>
+constexpr typename poly_iterator<Container>::pointer poly_iterator<Container>::operator->() const noexcept {
+    return &**this;
+}
+
+template <typename Container>
+constexpr typename poly_iterator<Container>::reference poly_iterator<Container>::operator[](difference_type i) const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_ + i)];
+}
+
+template <typename Container>
+constexpr poly_iterator<Container>& poly_iterator<Container>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr poly_iterator<Container> poly_iterator<Container>::operator++(int) noexcept {
+    auto const it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename Container>
+constexpr poly_iterator<Container>& poly_iterator<Container>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr poly_iterator<Container> poly_iterator<Container>::operator--(int) noexcept {
+    auto const it = *this;
+    --index_;
+    return it;
+}
+
+template <typename Container>
+constexpr poly_iterator<Container>& poly_iterator<Container>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename Container>
+constexpr poly_iterator<Container>& poly_iterator<Container>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename U>
+constexpr bool operator==(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator!=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename U>
+constexpr bool operator<=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>=(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator<(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+}
+
+template <typename U>
+constexpr poly_iterator<U> operator+(poly_iterator<U> const& it, typename poly_iterator<U>::difference_type n) noexcept {
+    return poly_iterator<U>{it.container_, it.index_ + n};
+}
+
+template <typename U>
+constexpr poly_iterator<U> operator+(typename poly_iterator<U>::difference_type n, poly_iterator<U> const& it) noexcept {
+    return it + n;
+}
+
+template <typename U>
+constexpr poly_iterator<U> operator-(poly_iterator<U> const& it, typename poly_iterator<U>::difference_type n) noexcept {
+    return poly_iterator<U>{it.container_, it.index_ - n};
+}
+
+template <typename U>
+constexpr typename poly_iterator<U>::difference_type operator-(poly_iterator<U> const& lhs, poly_iterator<U> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+/* Objects are relocated to the same offsets in this buffer, leaving other empty */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+poly_statvec<Base, Bytes, N, Align>::poly_statvec(poly_statvec&& other) noexcept {
+    relocate_from(other);
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+poly_statvec<Base, Bytes, N, Align>& poly_statvec<Base, Bytes, N, Align>::operator=(poly_statvec&& other) noexcept {
+    if(this != &other) {
+        clear();
+        relocate_from(other);
+    }
+    return *this;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+poly_statvec<Base, Bytes, N, Align>::~poly_statvec() {
+    clear();
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reference poly_statvec<Base, Bytes, N, Align>::operator[](size_type i) noexcept {
+    return *entries_[i].base;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reference poly_statvec<Base, Bytes, N, Align>::operator[](size_type i) const noexcept {
+    return *entries_[i].base;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reference poly_statvec<Base, Bytes, N, Align>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size_) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reference poly_statvec<Base, Bytes, N, Align>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size_) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reference poly_statvec<Base, Bytes, N, Align>::front() noexcept {
+    return (*this)[0];
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reference poly_statvec<Base, Bytes, N, Align>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reference poly_statvec<Base, Bytes, N, Align>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reference poly_statvec<Base, Bytes, N, Align>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+/* True if the object at index i is exactly of type D */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+template <typename D>
+bool poly_statvec<Base, Bytes, N, Align>::holds(size_type i) const noexcept {
+    return entries_[i].ops == &detail::poly_ops_for<Base, std::remove_cv_t<D>>;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+bool poly_statvec<Base, Bytes, N, Align>::empty() const noexcept {
+    return !size_;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+bool poly_statvec<Base, Bytes, N, Align>::full() const noexcept {
+    return size_ == N;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::size_type poly_statvec<Base, Bytes, N, Align>::size() const noexcept {
+    return size_;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::size_type poly_statvec<Base, Bytes, N, Align>::max_size() const noexcept {
+    return N;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::size_type poly_statvec<Base, Bytes, N, Align>::capacity() const noexcept {
+    return N;
+}
+
+/* Offset one past the highest byte occupied by an object, the next object is placed at or after it */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::size_type poly_statvec<Base, Bytes, N, Align>::bytes_used() const noexcept {
+    return used_;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::size_type poly_statvec<Base, Bytes, N, Align>::byte_capacity() const noexcept {
+    return Bytes;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::swap(poly_statvec& other) noexcept {
+    poly_statvec tmp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::clear() noexcept {
+    for(size_type i = 0u; i < size_; i++) {
+        entries_[i].ops->destroy(buf_.data() + entries_[i].offset);
+    }
+    size_ = 0u;
+    used_ = 0u;
+    ordered_ = true;
+}
+
+/* Constructs a D at the next suitably aligned offset. Returns false if there are already N objects or the D would
+ * not fit in the remaining bytes */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+template <typename D, typename... Ts>
+bool poly_statvec<Base, Bytes, N, Align>::emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<D, Ts&&...>) {
+    static_assert(std::is_base_of_v<Base, D> && !std::is_const_v<D> && !std::is_volatile_v<D>);
+    static_assert(alignof(D) <= Align && sizeof(D) <= Bytes);
+    static_assert(std::is_nothrow_move_constructible_v<D>, "objects are relocated by move construction");
+    auto const offset = (used_ + alignof(D) - 1u) & ~(alignof(D) - 1u);
+    if(size_ == N || offset > Bytes - sizeof(D)) {
+        return false;
+    }
+    D* const obj = ::new(static_cast<void*>(buf_.data() + offset)) D(std::forward<Ts>(args)...);
+    entries_[size_++] = detail::poly_entry<Base>{obj, &detail::poly_ops_for<Base, D>, offset};
+    used_ = offset + sizeof(D);
+    return true;
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+template <typename D, typename>
+bool poly_statvec<Base, Bytes, N, Align>::push_back(D&& value) noexcept(std::is_nothrow_constructible_v<std::decay_t<D>, D&&>) {
+    return emplace_back<std::decay_t<D>>(std::forward<D>(value));
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::pop_back() noexcept {
+    auto const& entry = entries_[--size_];
+    entry.ops->destroy(buf_.data() + entry.offset);
+    if(entry.offset + entry.ops->size == used_) {
+        reclaim();
+    }
+}
+
+/* Destroys the object in place and closes the gap in the offset table. Its bytes are reused only once no object
+ * placed after it remains */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::iterator poly_statvec<Base, Bytes, N, Align>::erase(const_iterator pos) noexcept {
+    auto const i = static_cast<size_type>(pos.index_);
+    entries_[i].ops->destroy(buf_.data() + entries_[i].offset);
+    for(size_type k = i + 1u; k < size_; k++) {
+        entries_[k - 1u] = entries_[k];
+    }
+    --size_;
+    reclaim();
+    return iterator{this, pos.index_};
+}
+
+/* Stably groups the objects by concrete type, in order of each type's first occurrence, so that virtual calls made
+ * while iterating hit the same target in long runs. Only the offset table is reordered, objects stay in place */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::sort_by_type() noexcept {
+    /* Counting pass over the distinct types, then a stable scatter, O(N * types) */
+    std::array<detail::poly_ops<Base> const*, N> types;
+    std::array<size_type, N> starts;
+    size_type type_count = 0u;
+    auto const type_of = [&](detail::poly_ops<Base> const* ops) noexcept {
+        size_type t = 0u;
+        while(t < type_count && types[t] != ops) {
+            ++t;
+        }
+        return t;
+    };
+    for(size_type i = 0u; i < size_; i++) {
+        auto const t = type_of(entries_[i].ops);
+        if(t == type_count) {
+            types[type_count] = entries_[i].ops;
+            starts[type_count++] = 0u;
+        }
+        ++starts[t];
+    }
+    for(size_type t = 0u, start = 0u; t < type_count; t++) {
+        start += std::exchange(starts[t], start);
+    }
+
+    std::array<detail::poly_entry<Base>, N> sorted;
+    for(size_type i = 0u; i < size_; i++) {
+        sorted[starts[type_of(entries_[i].ops)]++] = entries_[i];
+    }
+    ordered_ = true;
+    for(size_type i = 0u; i < size_; i++) {
+        entries_[i] = sorted[i];
+        ordered_ = ordered_ && (i == 0u || entries_[i - 1u].offset < entries_[i].offset);
+    }
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::iterator poly_statvec<Base, Bytes, N, Align>::begin() noexcept {
+    return iterator{this, 0};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::iterator poly_statvec<Base, Bytes, N, Align>::end() noexcept {
+    return iterator{this, static_cast<difference_type>(size_)};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_iterator poly_statvec<Base, Bytes, N, Align>::begin() const noexcept {
+    return const_iterator{this, 0};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_iterator poly_statvec<Base, Bytes, N, Align>::end() const noexcept {
+    return const_iterator{this, static_cast<difference_type>(size_)};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_iterator poly_statvec<Base, Bytes, N, Align>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_iterator poly_statvec<Base, Bytes, N, Align>::cend() const noexcept {
+    return end();
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reverse_iterator poly_statvec<Base, Bytes, N, Align>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::reverse_iterator poly_statvec<Base, Bytes, N, Align>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reverse_iterator poly_statvec<Base, Bytes, N, Align>::rbegin() const noexcept {
+    return const_reverse_iterator{end()};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reverse_iterator poly_statvec<Base, Bytes, N, Align>::rend() const noexcept {
+    return const_reverse_iterator{begin()};
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reverse_iterator poly_statvec<Base, Bytes, N, Align>::crbegin() const noexcept {
+    return rbegin();
+}
+
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+typename poly_statvec<Base, Bytes, N, Align>::const_reverse_iterator poly_statvec<Base, Bytes, N, Align>::crend() const noexcept {
+    return rend();
+}
+
+/* Expects this to be empty */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::relocate_from(poly_statvec& other) noexcept {
+    for(size_type i = 0u; i < other.size_; i++) {
+        auto const& entry = other.entries_[i];
+        auto* const base = entry.ops->relocate(buf_.data() + entry.offset, other.buf_.data() + entry.offset);
+        entries_[i] = detail::poly_entry<Base>{base, entry.ops, entry.offset};
+    }
+    size_ = std::exchange(other.size_, 0u);
+    used_ = std::exchange(other.used_, 0u);
+    ordered_ = std::exchange(other.ordered_, true);
+}
+
+/* Lowers used_ to the end of the highest remaining object, which is the last one unless sort_by_type reordered the
+ * table */
+template <typename Base, std::size_t Bytes, std::size_t N, std::size_t Align>
+void poly_statvec<Base, Bytes, N, Align>::reclaim() noexcept {
+    if(ordered_ || !size_) {
+        ordered_ = true;
+        used_ = size_ ? entries_[size_ - 1u].offset + entries_[size_ - 1u].ops->size : 0u;
+        return;
+    }
+    used_ = 0u;
+    for(size_type i = 0u; i < size_; i++) {
+        auto const end = entries_[i].offset + entries_[i].ops->size;
+        used_ = end > used_ ? end : used_;
+    }
+}
+
+#endif /* POLY_STATVEC_H */
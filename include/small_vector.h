@@ -0,0 +1,593 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class small_vector {
+    static_assert(!std::is_reference_v<T>);
+    static_assert(N);
+
+    template <typename U>
+    using remove_cvref_t = detail::remove_cvref_t<U>;
+    template <typename U>
+    using enable_if_input_iterator_t = detail::enable_if_input_iterator_t<U>;
+
+    public:
+        using value_type             = typename std::array<T, N>::value_type;
+        using reference              = typename std::array<T, N>::reference;
+        using const_reference        = typename std::array<T, N>::const_reference;
+        using pointer                = typename std::array<T, N>::pointer;
+        using const_pointer          = typename std::array<T, N>::const_pointer;
+        using size_type              = typename std::array<T, N>::size_type;
+
+        using iterator               = detail::iterator<small_vector<T, N>>;
+        using const_iterator         = detail::const_iterator<small_vector<T, N>>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        small_vector() noexcept = default;
+        small_vector(std::initializer_list<T> init);
+
+        small_vector(small_vector const& other);
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        small_vector& operator=(small_vector const& other) &;
+        small_vector& operator=(small_vector&& other) & noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        bool assign(size_type count, T const& value);
+        template <typename It, typename = enable_if_input_iterator_t<remove_cvref_t<It>>>
+        bool assign(It first, It last);
+
+        reference operator[](size_type i) noexcept;
+        const_reference operator[](size_type i) const noexcept;
+
+        reference at(size_type i);
+        const_reference at(size_type i) const;
+
+        reference front() noexcept;
+        const_reference front() const noexcept;
+
+        reference back() noexcept;
+        const_reference back() const noexcept;
+
+        pointer data() noexcept;
+        const_pointer data() const noexcept;
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        size_type capacity() const noexcept;
+
+        constexpr size_type inline_capacity() const noexcept;
+        bool is_inline() const noexcept;
+        void reserve(size_type capacity);
+        void shrink_to_fit();
+
+        size_type spill_count() const noexcept;
+        size_type peak_size() const noexcept;
+        void reset_stats() noexcept;
+
+        void swap(small_vector& other) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        void clear() noexcept;
+        bool resize(size_type size);
+
+        iterator insert(const_iterator pos, T const& value);
+        iterator insert(const_iterator pos, T&& value);
+        iterator insert(const_iterator pos, size_type count, T const& value);
+        template <typename It, typename = enable_if_input_iterator_t<remove_cvref_t<It>>>
+        iterator insert(const_iterator pos, It first, It last);
+
+        template <typename... Ts>
+        iterator emplace(const_iterator pos, Ts&&... args);
+
+        bool push_back(T const& value);
+        bool push_back(T&& value);
+
+        template <typename... Ts>
+        bool emplace_back(Ts&&... args);
+
+        T pop_back() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        iterator erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>);
+        iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        reverse_iterator rbegin() noexcept;
+        reverse_iterator rend() noexcept;
+
+        const_reverse_iterator rbegin() const noexcept;
+        const_reverse_iterator rend() const noexcept;
+
+        const_reverse_iterator crbegin() const noexcept;
+        const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<T, N> inline_{};
+        std::unique_ptr<T[]> heap_{};
+        size_type size_{};
+        size_type capacity_{N};
+        size_type spills_{};
+        size_type peak_{};
+
+        void reallocate(size_type capacity);
+        void grow(size_type size);
+        size_type open_gap(size_type pos, size_type count);
+        void set_size(size_type size) noexcept;
+};
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(std::initializer_list<T> init) {
+    assign(std::begin(init), std::end(init));
+}
+
+/* A copy starts with fresh counters, and spills only if the source does not fit inline */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector const& other) {
+    if(other.size_ > N) {
+        reallocate(other.size_);
+    }
+    std::copy(other.data(), other.data() + other.size_, data());
+    set_size(other.size_);
+}
+
+/* A move takes over the heap buffer and the counters, and leaves other empty and inline */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector&& other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    *this = std::move(other);
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>& small_vector<T, N>::operator=(small_vector const& other) & {
+    if(this != &other) {
+        if(other.size_ > capacity_) {
+            size_ = 0u;
+            reallocate(other.size_);
+        }
+        std::copy(other.data(), other.data() + other.size_, data());
+        set_size(other.size_);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>& small_vector<T, N>::operator=(small_vector&& other) & noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(this != &other) {
+        if(other.heap_) {
+            heap_ = std::move(other.heap_);
+            capacity_ = std::exchange(other.capacity_, N);
+        }
+        else {
+            std::move(other.data(), other.data() + other.size_, data());
+        }
+        size_ = std::exchange(other.size_, 0u);
+        spills_ = std::exchange(other.spills_, 0u);
+        peak_ = std::exchange(other.peak_, 0u);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::assign(size_type count, T const& value) {
+    T const copy(value);
+    size_ = 0u;
+    grow(count);
+    std::fill_n(data(), count, copy);
+    set_size(count);
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename It, typename>
+bool small_vector<T, N>::assign(It first, It last) {
+    size_ = 0u;
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type const count = std::distance(first, last);
+        grow(count);
+        std::copy(first, last, data());
+        set_size(count);
+    }
+    else {
+        for(; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::operator[](size_type i) noexcept {
+    return data()[i];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::operator[](size_type i) const noexcept {
+    return data()[i];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::front() noexcept {
+    return data()[0];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::front() const noexcept {
+    return data()[0];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::back() noexcept {
+    return data()[size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::back() const noexcept {
+    return data()[size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::pointer small_vector<T, N>::data() noexcept {
+    return heap_ ? heap_.get() : inline_.data();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_pointer small_vector<T, N>::data() const noexcept {
+    return heap_ ? heap_.get() : inline_.data();
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename small_vector<T, N>::size_type small_vector<T, N>::inline_capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::is_inline() const noexcept {
+    return !heap_;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reserve(size_type capacity) {
+    if(capacity > capacity_) {
+        reallocate(capacity);
+    }
+}
+
+/* Moves the elements back into the inline buffer if they fit there, otherwise into a heap buffer of exactly
+ * size() elements */
+template <typename T, std::size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+    if(!heap_) {
+        return;
+    }
+    if(size_ <= N) {
+        std::move(heap_.get(), heap_.get() + size_, inline_.data());
+        heap_.reset();
+        capacity_ = N;
+    }
+    else if(size_ < capacity_) {
+        reallocate(size_);
+    }
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::spill_count() const noexcept {
+    return spills_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::peak_size() const noexcept {
+    return peak_;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reset_stats() noexcept {
+    spills_ = 0u;
+    peak_ = size_;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::swap(small_vector& other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    small_vector tmp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+
+/* Keeps the heap buffer, if any, so that refilling does not allocate again */
+template <typename T, std::size_t N>
+void small_vector<T, N>::clear() noexcept {
+    size_ = 0u;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::resize(size_type size) {
+    grow(size);
+    set_size(size);
+    return true;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(const_iterator pos, T const& value) {
+    return insert(pos, T(value));
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(const_iterator pos, T&& value) {
+    auto const i = open_gap(std::distance(cbegin(), pos), 1u);
+    data()[i] = std::move(value);
+    return begin() + i;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(const_iterator pos, size_type count, T const& value) {
+    T const copy(value);
+    auto const i = open_gap(std::distance(cbegin(), pos), count);
+    std::fill_n(data() + i, count, copy);
+    return begin() + i;
+}
+
+template <typename T, std::size_t N>
+template <typename It, typename>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(const_iterator pos, It first, It last) {
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>) {
+        auto const i = open_gap(std::distance(cbegin(), pos), std::distance(first, last));
+        std::copy(first, last, data() + i);
+        return begin() + i;
+    }
+    else {
+        /* Appends in a single pass and rotates the new elements into place */
+        size_type const i = std::distance(cbegin(), pos);
+        auto const size = size_;
+        for(; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(data() + i, data() + size, data() + size_);
+        return begin() + i;
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace(const_iterator pos, Ts&&... args) {
+    return insert(pos, T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::push_back(T const& value) {
+    if(size_ == capacity_) {
+        return push_back(T(value));
+    }
+    data()[size_] = value;
+    set_size(size_ + 1u);
+    return true;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::push_back(T&& value) {
+    grow(size_ + 1u);
+    data()[size_] = std::move(value);
+    set_size(size_ + 1u);
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+bool small_vector<T, N>::emplace_back(Ts&&... args) {
+    return push_back(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+T small_vector<T, N>::pop_back() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return std::move(data()[--size_]);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return erase(pos, pos + 1);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator
+small_vector<T, N>::erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    size_type const pos = std::distance(cbegin(), first);
+    size_type const count = std::distance(first, last);
+    if(!count) {
+        return begin() + pos;
+    }
+    std::move(data() + pos + count, data() + size_, data() + pos);
+    size_ -= count;
+    return begin() + pos;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::begin() noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::end() noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::begin() const noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::end() const noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::cbegin() const noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::cend() const noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reverse_iterator small_vector<T, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reverse_iterator small_vector<T, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reverse_iterator small_vector<T, N>::rbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reverse_iterator small_vector<T, N>::rend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reverse_iterator small_vector<T, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reverse_iterator small_vector<T, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+/* Moves the elements into a heap buffer of the given capacity, which must be at least size(). Leaving the inline
+ * buffer counts as a spill */
+template <typename T, std::size_t N>
+void small_vector<T, N>::reallocate(size_type capacity) {
+    auto buf = std::make_unique<T[]>(capacity);
+    std::move(data(), data() + size_, buf.get());
+    if(!heap_) {
+        ++spills_;
+    }
+    heap_ = std::move(buf);
+    capacity_ = capacity;
+}
+
+/* Ensures room for size elements, at least doubling the capacity when it has to reallocate so that a sequence of
+ * push_back calls costs amortized constant time */
+template <typename T, std::size_t N>
+void small_vector<T, N>::grow(size_type size) {
+    if(size > capacity_) {
+        reallocate(std::max(size, 2u * capacity_));
+    }
+}
+
+/* Opens a gap of count slots before the element at index pos, growing first if needed. An empty gap moves
+ * nothing, since moving each element onto itself would empty types like std::string. Returns pos */
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::open_gap(size_type pos, size_type count) {
+    if(!count) {
+        return pos;
+    }
+    grow(size_ + count);
+    std::move_backward(data() + pos, data() + size_, data() + size_ + count);
+    set_size(size_ + count);
+    return pos;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::set_size(size_type size) noexcept {
+    size_ = size;
+    peak_ = std::max(peak_, size_);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator==(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator!=(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator<=(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator>=(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator<(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator>(small_vector<T, N> const& lhs, small_vector<T, M> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+#endif /* SMALL_VECTOR_H */
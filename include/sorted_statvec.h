@@ -0,0 +1,621 @@
+#ifndef SORTED_STATVEC_H
+#define SORTED_STATVEC_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace detail {
+
+struct identity {
+    template <typename T>
+    constexpr T const& operator()(T const& value) const noexcept;
+};
+
+/* Number of bytes scanned with SIMD compares once the binary search has narrowed down the range */
+inline std::size_t constexpr simd_search_window = 64u;
+
+template <typename T, typename Key, typename Compare, typename Proj>
+inline bool constexpr is_simd_searchable_v =
+#ifdef __SSE2__
+    std::is_same_v<Proj, identity> && std::is_same_v<T, Key> &&
+   (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>>) &&
+   (std::is_same_v<T, float> || std::is_same_v<T, double> ||
+   (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 4u));
+#else
+    false;
+#endif
+
+template <typename T>
+std::size_t simd_count_less(T const* data, T key) noexcept;
+
+template <typename T, typename Key, typename Compare, typename Proj>
+constexpr std::size_t sorted_lower_bound(T const* data, std::size_t size, Key const& key, Compare const& comp, Proj const& proj) noexcept;
+template <typename T, typename Key, typename Compare, typename Proj>
+constexpr std::size_t sorted_upper_bound(T const* data, std::size_t size, Key const& key, Compare const& comp, Proj const& proj) noexcept;
+
+template <typename It, typename = void>
+struct is_bidirectional_iterator : std::false_type { };
+
+template <typename It>
+struct is_bidirectional_iterator<It, std::enable_if_t<std::is_base_of_v<std::bidirectional_iterator_tag, typename std::iterator_traits<It>::iterator_category>>>
+    : std::true_type { };
+
+template <typename It>
+inline bool constexpr is_bidirectional_iterator_v = is_bidirectional_iterator<It>::value;
+
+template <typename It, typename U = void>
+using enable_if_bidirectional_iterator_t = std::enable_if_t<is_bidirectional_iterator_v<It>, U>;
+
+template <typename Vec, typename It, typename Less>
+constexpr bool sorted_merge(Vec& vec, It first, It last, Less const& less, bool unique);
+
+} // namespace detail
+
+/* Sorted fixed-capacity vector. Allows duplicates if Unique is false, in which case it behaves like a multiset,
+ * otherwise like a set */
+template <typename T, std::size_t N, typename Compare, bool Unique>
+class basic_sorted_statvec {
+    using vector_type = statvec<T, N>;
+
+    template <typename U>
+    using enable_if_bidirectional_iterator_t = detail::enable_if_bidirectional_iterator_t<U>;
+
+    public:
+        using value_type             = T;
+        using key_type               = T;
+        using key_compare            = Compare;
+        using reference              = T const&;
+        using const_reference        = T const&;
+        using pointer                = T const*;
+        using const_pointer          = T const*;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = typename vector_type::const_iterator;
+        using const_iterator         = typename vector_type::const_iterator;
+        using reverse_iterator       = typename vector_type::const_reverse_iterator;
+        using const_reverse_iterator = typename vector_type::const_reverse_iterator;
+
+        using insert_return_type     = std::conditional_t<Unique, std::pair<const_iterator, bool>, const_iterator>;
+
+        constexpr basic_sorted_statvec() noexcept = default;
+        explicit constexpr basic_sorted_statvec(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr const_reference operator[](size_type i) const noexcept;
+        constexpr const_reference at(size_type i) const;
+
+        constexpr const_reference front() const noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr const_pointer data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr key_compare key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr void swap(basic_sorted_statvec& other) noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_swappable_v<Compare>);
+        constexpr void clear() noexcept;
+
+        constexpr const_iterator lower_bound(key_type const& key) const noexcept;
+        constexpr const_iterator upper_bound(key_type const& key) const noexcept;
+        constexpr std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const noexcept;
+        constexpr const_iterator find(key_type const& key) const noexcept;
+        constexpr bool contains(key_type const& key) const noexcept;
+        constexpr size_type count(key_type const& key) const noexcept;
+
+        constexpr insert_return_type insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                     std::is_nothrow_move_assignable_v<T>);
+        constexpr insert_return_type insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr const_iterator insert(const_iterator hint, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                      std::is_nothrow_move_assignable_v<T>);
+        constexpr const_iterator insert(const_iterator hint, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename It, typename = enable_if_bidirectional_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool insert_sorted_range(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                                       std::is_nothrow_move_assignable_v<T>);
+
+        template <typename... Ts>
+        constexpr insert_return_type emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                    std::is_nothrow_move_assignable_v<T>);
+
+        constexpr const_iterator erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr size_type erase(key_type const& key) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        vector_type vec_{};
+        Compare comp_{};
+
+        constexpr bool fits(size_type i, T const& value) const noexcept;
+};
+
+template <typename T, std::size_t N, typename Compare = std::less<T>>
+using sorted_statvec = basic_sorted_statvec<T, N, Compare, false>;
+
+template <typename T, std::size_t N, typename Compare = std::less<T>>
+using static_flat_set = basic_sorted_statvec<T, N, Compare, true>;
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr basic_sorted_statvec<T, N, Compare, Unique>::basic_sorted_statvec(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+    : comp_{comp} { }
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reference
+basic_sorted_statvec<T, N, Compare, Unique>::operator[](size_type i) const noexcept {
+    return vec_[i];
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reference
+basic_sorted_statvec<T, N, Compare, Unique>::at(size_type i) const {
+    return vec_.at(i);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reference
+basic_sorted_statvec<T, N, Compare, Unique>::front() const noexcept {
+    return vec_.front();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reference
+basic_sorted_statvec<T, N, Compare, Unique>::back() const noexcept {
+    return vec_.back();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_pointer
+basic_sorted_statvec<T, N, Compare, Unique>::data() const noexcept {
+    return vec_.data();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr bool basic_sorted_statvec<T, N, Compare, Unique>::empty() const noexcept {
+    return vec_.empty();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::size_type
+basic_sorted_statvec<T, N, Compare, Unique>::size() const noexcept {
+    return vec_.size();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::size_type
+basic_sorted_statvec<T, N, Compare, Unique>::max_size() const noexcept {
+    return vec_.max_size();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::size_type
+basic_sorted_statvec<T, N, Compare, Unique>::capacity() const noexcept {
+    return vec_.capacity();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::key_compare
+basic_sorted_statvec<T, N, Compare, Unique>::key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>) {
+    return comp_;
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr void basic_sorted_statvec<T, N, Compare, Unique>::swap(basic_sorted_statvec& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                                                                      std::is_nothrow_swappable_v<Compare>)
+{
+    using std::swap;
+    vec_.swap(other.vec_);
+    swap(comp_, other.comp_);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr void basic_sorted_statvec<T, N, Compare, Unique>::clear() noexcept {
+    vec_.clear();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::lower_bound(key_type const& key) const noexcept {
+    return cbegin() + detail::sorted_lower_bound(vec_.data(), vec_.size(), key, comp_, detail::identity{});
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::upper_bound(key_type const& key) const noexcept {
+    return cbegin() + detail::sorted_upper_bound(vec_.data(), vec_.size(), key, comp_, detail::identity{});
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr std::pair<typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator,
+                    typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator>
+basic_sorted_statvec<T, N, Compare, Unique>::equal_range(key_type const& key) const noexcept {
+    auto const first = lower_bound(key);
+    if constexpr(Unique) {
+        return {first, first + (first != cend() && !comp_(key, *first))};
+    }
+    else {
+        return {first, upper_bound(key)};
+    }
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::find(key_type const& key) const noexcept {
+    auto const it = lower_bound(key);
+    return it != cend() && !comp_(key, *it) ? it : cend();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr bool basic_sorted_statvec<T, N, Compare, Unique>::contains(key_type const& key) const noexcept {
+    return find(key) != cend();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::size_type
+basic_sorted_statvec<T, N, Compare, Unique>::count(key_type const& key) const noexcept {
+    auto const [first, last] = equal_range(key);
+    return std::distance(first, last);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::insert_return_type
+basic_sorted_statvec<T, N, Compare, Unique>::insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                             std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(T{value});
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::insert_return_type
+basic_sorted_statvec<T, N, Compare, Unique>::insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if constexpr(Unique) {
+        auto const it = lower_bound(value);
+        if(it != cend() && !comp_(value, *it)) {
+            return {it, false};
+        }
+        auto const pos = vec_.insert(it, std::move(value));
+        return {pos, pos != vec_.end()};
+    }
+    else {
+        return vec_.insert(upper_bound(value), std::move(value));
+    }
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::insert(const_iterator hint, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                                  std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(hint, T{value});
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::insert(const_iterator hint, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    size_type const i = std::distance(cbegin(), hint);
+    if(fits(i, value)) {
+        if constexpr(Unique) {
+            if(i && !comp_(vec_[i - 1u], value)) {
+                return hint - 1;
+            }
+            if(i != size() && !comp_(value, vec_[i])) {
+                return hint;
+            }
+        }
+        return vec_.insert(hint, std::move(value));
+    }
+    if constexpr(Unique) {
+        return insert(std::move(value)).first;
+    }
+    else {
+        return insert(std::move(value));
+    }
+}
+
+/* Merges the sorted range into the vector in linear time, working backwards from the end of the buffer so that no
+ * element is moved more than once. Returns false, leaving the vector unchanged, if the merged range does not fit */
+template <typename T, std::size_t N, typename Compare, bool Unique>
+template <typename It, typename>
+constexpr bool basic_sorted_statvec<T, N, Compare, Unique>::insert_sorted_range(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                                                                          std::is_nothrow_move_assignable_v<T>)
+{
+    return detail::sorted_merge(vec_, first, last, comp_, Unique);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+template <typename... Ts>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::insert_return_type
+basic_sorted_statvec<T, N, Compare, Unique>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                            std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return vec_.erase(pos);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return vec_.erase(first, last);
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::size_type
+basic_sorted_statvec<T, N, Compare, Unique>::erase(key_type const& key) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const [first, last] = equal_range(key);
+    size_type const count = std::distance(first, last);
+    vec_.erase(first, last);
+    return count;
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::begin() const noexcept {
+    return vec_.cbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::end() const noexcept {
+    return vec_.cend();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::cbegin() const noexcept {
+    return vec_.cbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::cend() const noexcept {
+    return vec_.cend();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reverse_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::rbegin() const noexcept {
+    return vec_.crbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reverse_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::rend() const noexcept {
+    return vec_.crend();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reverse_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::crbegin() const noexcept {
+    return vec_.crbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr typename basic_sorted_statvec<T, N, Compare, Unique>::const_reverse_iterator
+basic_sorted_statvec<T, N, Compare, Unique>::crend() const noexcept {
+    return vec_.crend();
+}
+
+/* Checks whether value may be inserted at index i without breaking the ordering */
+template <typename T, std::size_t N, typename Compare, bool Unique>
+constexpr bool basic_sorted_statvec<T, N, Compare, Unique>::fits(size_type i, T const& value) const noexcept {
+    return (!i || !comp_(value, vec_[i - 1u])) && (i == size() || !comp_(vec_[i], value));
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator==(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator!=(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator<=(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator>=(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator<(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M, typename Compare, bool Unique>
+constexpr bool operator>(basic_sorted_statvec<T, N, Compare, Unique> const& lhs, basic_sorted_statvec<T, M, Compare, Unique> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+namespace detail {
+
+template <typename T>
+constexpr T const& identity::operator()(T const& value) const noexcept {
+    return value;
+}
+
+#ifdef __SSE2__
+template <typename T>
+inline __m128i simd_broadcast(T value) noexcept {
+    if constexpr(sizeof(T) == 1u) {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+    else if constexpr(sizeof(T) == 2u) {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }
+    else {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }
+}
+
+/* Byte mask of the lanes of the 16 bytes at data that compare less than key */
+template <typename T>
+inline unsigned simd_less_mask(T const* data, T key) noexcept {
+    if constexpr(std::is_same_v<T, float>) {
+        return _mm_movemask_epi8(_mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(data), _mm_set1_ps(key))));
+    }
+    else if constexpr(std::is_same_v<T, double>) {
+        return _mm_movemask_epi8(_mm_castpd_si128(_mm_cmplt_pd(_mm_loadu_pd(data), _mm_set1_pd(key))));
+    }
+    else {
+        auto lhs = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+        auto rhs = simd_broadcast(key);
+        if constexpr(std::is_unsigned_v<T>) {
+            /* SSE2 only has signed compares, flipping the sign bits maps the unsigned order onto the signed one */
+            auto const bias = simd_broadcast(static_cast<T>(T{1} << (sizeof(T) * 8u - 1u)));
+            lhs = _mm_xor_si128(lhs, bias);
+            rhs = _mm_xor_si128(rhs, bias);
+        }
+        if constexpr(sizeof(T) == 1u) {
+            return _mm_movemask_epi8(_mm_cmplt_epi8(lhs, rhs));
+        }
+        else if constexpr(sizeof(T) == 2u) {
+            return _mm_movemask_epi8(_mm_cmplt_epi16(lhs, rhs));
+        }
+        else {
+            return _mm_movemask_epi8(_mm_cmplt_epi32(lhs, rhs));
+        }
+    }
+}
+
+/* Counts the elements less than key in the simd_search_window bytes at data */
+template <typename T>
+std::size_t simd_count_less(T const* data, T key) noexcept {
+    unsigned count = 0u;
+    for(std::size_t i = 0u; i < simd_search_window / sizeof(T); i += 16u / sizeof(T)) {
+        count += __builtin_popcount(simd_less_mask(data + i, key));
+    }
+    return count / sizeof(T);
+}
+#endif
+
+/* Branchless binary search, the comparison result selects the next base with a conditional move rather than a
+ * jump. For arithmetic keys, the search stops once the range fits in a window of simd_search_window bytes, whose
+ * elements less than key are then counted with SIMD compares. Since all elements before base are known to be less
+ * than key, the window may be moved back to stay within the vector */
+template <typename T, typename Key, typename Compare, typename Proj>
+constexpr std::size_t sorted_lower_bound(T const* data, std::size_t size, Key const& key, Compare const& comp, Proj const& proj) noexcept {
+    T const* base = data;
+    std::size_t n = size;
+    if constexpr(is_simd_searchable_v<T, Key, Compare, Proj>) {
+        std::size_t constexpr window = simd_search_window / sizeof(T);
+        if(!__builtin_is_constant_evaluated() && size >= window) {
+            while(n > window) {
+                auto const half = n / 2u;
+                base = comp(base[half], key) ? base + half : base;
+                n -= half;
+            }
+            base = std::min(base, data + size - window);
+            return static_cast<std::size_t>(base - data) + simd_count_less(base, key);
+        }
+    }
+    if(!n) {
+        return 0u;
+    }
+    while(n > 1u) {
+        auto const half = n / 2u;
+        base = comp(proj(base[half]), key) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - data) + comp(proj(*base), key);
+}
+
+template <typename T, typename Key, typename Compare, typename Proj>
+constexpr std::size_t sorted_upper_bound(T const* data, std::size_t size, Key const& key, Compare const& comp, Proj const& proj) noexcept {
+    T const* base = data;
+    std::size_t n = size;
+    if(!n) {
+        return 0u;
+    }
+    while(n > 1u) {
+        auto const half = n / 2u;
+        base = comp(key, proj(base[half])) ? base : base + half;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - data) + !comp(key, proj(*base));
+}
+
+/* Merges the sorted range [first, last) into the sorted vector. The number of new elements is computed first, then
+ * the merge runs backwards from the new end so that every element is moved at most once. Inserted elements end up
+ * after existing equivalent ones. If unique is set, elements equivalent to an existing one or to their predecessor
+ * in the range are skipped */
+template <typename Vec, typename It, typename Less>
+constexpr bool sorted_merge(Vec& vec, It first, It last, Less const& less, bool unique) {
+    static_assert(is_bidirectional_iterator_v<It>, "The range is traversed twice, and backwards");
+    std::size_t const old_size = vec.size();
+    std::size_t count = 0u;
+    if(unique) {
+        std::size_t i = 0u;
+        for(auto it = first; it != last; ++it) {
+            if(it != first && !less(*std::prev(it), *it)) {
+                continue;
+            }
+            while(i < old_size && less(vec[i], *it)) {
+                ++i;
+            }
+            count += i == old_size || less(*it, vec[i]);
+        }
+    }
+    else {
+        count = std::distance(first, last);
+    }
+    if(old_size + count > vec.capacity()) {
+        return false;
+    }
+
+    vec.resize(old_size + count);
+    auto i = old_size;
+    auto k = old_size + count;
+    for(auto it = last; it != first && k != i;) {
+        --it;
+        if(unique && it != std::prev(last) && !less(*it, *std::next(it))) {
+            continue;
+        }
+        while(i && less(*it, vec[i - 1u])) {
+            vec[--k] = std::move(vec[--i]);
+        }
+        if(unique && i && !less(vec[i - 1u], *it)) {
+            continue;
+        }
+        vec[--k] = *it;
+    }
+    return true;
+}
+
+} // namespace detail
+
+#endif /* SORTED_STATVEC_H */
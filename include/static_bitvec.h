@@ -0,0 +1,923 @@
+#ifndef STATIC_BITVEC_H
+#define STATIC_BITVEC_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+template <std::size_t N>
+class static_bitvec;
+
+namespace detail {
+
+inline std::size_t constexpr bit_word_width = 64u;
+
+/* Word with the low count bits set, for count in [0, 64] */
+constexpr std::uint64_t low_bits(std::size_t count) noexcept;
+
+/* The 64 bits starting at bit offset of the n words, bits outside of them reading as zero */
+constexpr std::uint64_t read_bits(std::uint64_t const* words, std::size_t n, std::ptrdiff_t offset) noexcept;
+
+/* Position of the k-th set bit of word, which must have more than k bits set */
+constexpr std::size_t select_bit(std::uint64_t word, std::size_t k) noexcept;
+
+class bit_reference {
+    public:
+        constexpr bit_reference(bit_reference const& other) noexcept = default;
+
+        constexpr bit_reference& operator=(bool value) noexcept;
+        constexpr bit_reference& operator=(bit_reference const& other) noexcept;
+
+        constexpr operator bool() const noexcept;
+        constexpr bool operator~() const noexcept;
+
+        constexpr bit_reference& flip() noexcept;
+
+    private:
+        std::uint64_t* word_;
+        std::uint64_t mask_;
+
+        constexpr bit_reference(std::uint64_t* word, std::uint64_t mask) noexcept;
+
+        template <typename>
+        friend class bit_iterator;
+        template <std::size_t>
+        friend class ::static_bitvec;
+};
+
+template <typename Word>
+class bit_iterator {
+    public:
+        using value_type        = bool;
+        using reference         = std::conditional_t<std::is_const_v<Word>, bool, bit_reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr bit_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Word> && !std::is_same_v<U, Word>>>
+        constexpr bit_iterator(bit_iterator<U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr bit_iterator& operator++() noexcept;
+        constexpr bit_iterator operator++(int) noexcept;
+
+        constexpr bit_iterator& operator--() noexcept;
+        constexpr bit_iterator operator--(int) noexcept;
+
+        constexpr bit_iterator& operator+=(difference_type n) noexcept;
+        constexpr bit_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U>
+        friend constexpr bool operator==(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator!=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+
+        template <typename U>
+        friend constexpr bit_iterator<U> operator+(bit_iterator<U> const& it, typename bit_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr bit_iterator<U> operator+(typename bit_iterator<U>::difference_type n, bit_iterator<U> const& it) noexcept;
+        template <typename U>
+        friend constexpr bit_iterator<U> operator-(bit_iterator<U> const& it, typename bit_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr typename bit_iterator<U>::difference_type operator-(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept;
+
+    private:
+        Word* words_{};
+        difference_type index_{};
+
+        constexpr bit_iterator(Word* words, difference_type index) noexcept;
+
+        template <typename>
+        friend class bit_iterator;
+        template <std::size_t>
+        friend class ::static_bitvec;
+};
+
+} // namespace detail
+
+/* Fixed-capacity vector of bits, packed into 64-bit words. Bits past size() are kept clear, so that counting,
+ * searching, comparing and combining vectors work on whole words without masking. Insertion and erasure in the
+ * middle shift the following bits a word at a time */
+template <std::size_t N>
+class static_bitvec {
+    static_assert(N);
+
+    static std::size_t constexpr words = (N + detail::bit_word_width - 1u) / detail::bit_word_width;
+
+    public:
+        using value_type             = bool;
+        using reference              = detail::bit_reference;
+        using const_reference        = bool;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using word_type              = std::uint64_t;
+
+        using iterator               = detail::bit_iterator<word_type>;
+        using const_iterator         = detail::bit_iterator<word_type const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr static_bitvec() noexcept = default;
+
+        constexpr bool assign(size_type count, bool value) noexcept;
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool assign(It first, It last) noexcept(noexcept(static_cast<bool>(*first)));
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr bool test(size_type i) const noexcept;
+        constexpr void set(size_type i, bool value = true) noexcept;
+        constexpr void reset(size_type i) noexcept;
+        constexpr void flip(size_type i) noexcept;
+
+        constexpr void set() noexcept;
+        constexpr void reset() noexcept;
+        constexpr void flip() noexcept;
+
+        constexpr word_type const* data() const noexcept;
+        constexpr size_type word_count() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr size_type count() const noexcept;
+        constexpr bool all() const noexcept;
+        constexpr bool any() const noexcept;
+        constexpr bool none() const noexcept;
+
+        constexpr size_type find_first() const noexcept;
+        constexpr size_type find_next(size_type i) const noexcept;
+        constexpr size_type find_first_unset() const noexcept;
+        template <typename F>
+        constexpr void for_each_set(F&& f) const noexcept(noexcept(f(size_type{})));
+        constexpr size_type rank(size_type i) const noexcept;
+        constexpr size_type select(size_type k) const noexcept;
+
+        constexpr void swap(static_bitvec& other) noexcept;
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size, bool value = false) noexcept;
+
+        constexpr iterator insert(const_iterator pos, bool value) noexcept;
+        constexpr iterator insert(const_iterator pos, size_type count, bool value) noexcept;
+
+        constexpr bool push_back(bool value) noexcept;
+        constexpr bool pop_back() noexcept;
+
+        constexpr iterator erase(const_iterator pos) noexcept;
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept;
+
+        constexpr static_bitvec& operator&=(static_bitvec const& other) noexcept;
+        constexpr static_bitvec& operator|=(static_bitvec const& other) noexcept;
+        constexpr static_bitvec& operator^=(static_bitvec const& other) noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+        template <std::size_t M>
+        friend constexpr bool operator==(static_bitvec<M> const& lhs, static_bitvec<M> const& rhs) noexcept;
+
+    private:
+        std::array<word_type, words> words_{};
+        size_type size_{};
+
+        constexpr void fill(size_type first, size_type last, bool value) noexcept;
+        constexpr void clear_tail() noexcept;
+        constexpr void shift_up(size_type pos, size_type count) noexcept;
+        constexpr void shift_down(size_type pos, size_type count) noexcept;
+};
+
+template <std::size_t N>
+constexpr bool operator!=(static_bitvec<N> const& lhs, static_bitvec<N> const& rhs) noexcept;
+
+template <std::size_t N>
+constexpr static_bitvec<N> operator&(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept;
+template <std::size_t N>
+constexpr static_bitvec<N> operator|(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept;
+template <std::size_t N>
+constexpr static_bitvec<N> operator^(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept;
+template <std::size_t N>
+constexpr static_bitvec<N> operator~(static_bitvec<N> vec) noexcept;
+
+namespace detail {
+
+constexpr std::uint64_t low_bits(std::size_t count) noexcept {
+    return count >= bit_word_width ? ~std::uint64_t{0} : (std::uint64_t{1} << count) - 1u;
+}
+
+constexpr std::uint64_t read_bits(std::uint64_t const* words, std::size_t n, std::ptrdiff_t offset) noexcept {
+    auto const word_at = [words, n](std::ptrdiff_t i) {
+        return i >= 0 && static_cast<std::size_t>(i) < n ? words[i] : std::uint64_t{0};
+    };
+    auto const width = static_cast<std::ptrdiff_t>(bit_word_width);
+    auto const shift = static_cast<unsigned>(((offset % width) + width) % width);
+    auto const i = (offset - static_cast<std::ptrdiff_t>(shift)) / width;
+    if(!shift) {
+        return word_at(i);
+    }
+    return (word_at(i) >> shift) | (word_at(i + 1) << (bit_word_width - shift));
+}
+
+constexpr std::size_t select_bit(std::uint64_t word, std::size_t k) noexcept {
+    for(; k; --k) {
+        word &= word - 1u;
+    }
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+}
+
+constexpr bit_reference::bit_reference(std::uint64_t* word, std::uint64_t mask) noexcept
+    : word_{word}, mask_{mask} { }
+
+constexpr bit_reference& bit_reference::operator=(bool value) noexcept {
+    *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+    return *this;
+}
+
+constexpr bit_reference& bit_reference::operator=(bit_reference const& other) noexcept {
+    return *this = static_cast<bool>(other);
+}
+
+constexpr bit_reference::operator bool() const noexcept {
+    return *word_ & mask_;
+}
+
+constexpr bool bit_reference::operator~() const noexcept {
+    return !*this;
+}
+
+constexpr bit_reference& bit_reference::flip() noexcept {
+    *word_ ^= mask_;
+    return *this;
+}
+
+template <typename Word>
+template <typename U, typename>
+constexpr bit_iterator<Word>::bit_iterator(bit_iterator<U> const& other) noexcept
+    : words_{other.words_}, index_{other.index_} { }
+
+template <typename Word>
+constexpr bit_iterator<Word>::bit_iterator(Word* words, difference_type index) noexcept
+    : words_{words}, index_{index} { }
+
+template <typename Word>
+constexpr typename bit_iterator<Word>::reference bit_iterator<Word>::operator*() const noexcept {
+    auto const word = words_ + index_ / static_cast<difference_type>(bit_word_width);
+    auto const mask = std::uint64_t{1} << (static_cast<std::size_t>(index_) % bit_word_width);
+    if constexpr(std::is_const_v<Word>) {
+        return *word & mask;
+    }
+    else {
+        return bit_reference{word, mask};
+    }
+}
+
+template <typename Word>
+constexpr typename bit_iterator<Word>::reference bit_iterator<Word>::operator[](difference_type i) const noexcept {
+    return *(*this + i);
+}
+
+template <typename Word>
+constexpr bit_iterator<Word>& bit_iterator<Word>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename Word>
+constexpr bit_iterator<Word> bit_iterator<Word>::operator++(int) noexcept {
+    auto const it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename Word>
+constexpr bit_iterator<Word>& bit_iterator<Word>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename Word>
+constexpr bit_iterator<Word> bit_iterator<Word>::operator--(int) noexcept {
+    auto const it = *this;
+    --index_;
+    return it;
+}
+
+template <typename Word>
+constexpr bit_iterator<Word>& bit_iterator<Word>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename Word>
+constexpr bit_iterator<Word>& bit_iterator<Word>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename U>
+constexpr bool operator==(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator!=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename U>
+constexpr bool operator<=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>=(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator<(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+}
+
+template <typename U>
+constexpr bit_iterator<U> operator+(bit_iterator<U> const& it, typename bit_iterator<U>::difference_type n) noexcept {
+    return bit_iterator<U>{it.words_, it.index_ + n};
+}
+
+template <typename U>
+constexpr bit_iterator<U> operator+(typename bit_iterator<U>::difference_type n, bit_iterator<U> const& it) noexcept {
+    return it + n;
+}
+
+template <typename U>
+constexpr bit_iterator<U> operator-(bit_iterator<U> const& it, typename bit_iterator<U>::difference_type n) noexcept {
+    return bit_iterator<U>{it.words_, it.index_ - n};
+}
+
+template <typename U>
+constexpr typename bit_iterator<U>::difference_type operator-(bit_iterator<U> const& lhs, bit_iterator<U> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+/* Returns false if count exceeds the capacity, in which case the vector is filled to capacity */
+template <std::size_t N>
+constexpr bool static_bitvec<N>::assign(size_type count, bool value) noexcept {
+    clear();
+    return resize(count, value);
+}
+
+template <std::size_t N>
+template <typename It, typename>
+constexpr bool static_bitvec<N>::assign(It first, It last) noexcept(noexcept(static_cast<bool>(*first))) {
+    clear();
+    for(; first != last; ++first) {
+        if(!push_back(static_cast<bool>(*first))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reference static_bitvec<N>::operator[](size_type i) noexcept {
+    return reference{&words_[i / detail::bit_word_width], word_type{1} << (i % detail::bit_word_width)};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reference static_bitvec<N>::operator[](size_type i) const noexcept {
+    return test(i);
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reference static_bitvec<N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reference static_bitvec<N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reference static_bitvec<N>::front() noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reference static_bitvec<N>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reference static_bitvec<N>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reference static_bitvec<N>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::test(size_type i) const noexcept {
+    return (words_[i / detail::bit_word_width] >> (i % detail::bit_word_width)) & 1u;
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::set(size_type i, bool value) noexcept {
+    (*this)[i] = value;
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::reset(size_type i) noexcept {
+    (*this)[i] = false;
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::flip(size_type i) noexcept {
+    (*this)[i].flip();
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::set() noexcept {
+    fill(0u, size_, true);
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::reset() noexcept {
+    fill(0u, size_, false);
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::flip() noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        words_[w] = ~words_[w];
+    }
+    clear_tail();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::word_type const* static_bitvec<N>::data() const noexcept {
+    return words_.data();
+}
+
+/* Number of words holding the bits in [0, size()) */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::word_count() const noexcept {
+    return (size_ + detail::bit_word_width - 1u) / detail::bit_word_width;
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::empty() const noexcept {
+    return !size_;
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::full() const noexcept {
+    return size_ == N;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::size() const noexcept {
+    return size_;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::capacity() const noexcept {
+    return N;
+}
+
+/* Number of set bits */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::count() const noexcept {
+    size_type count = 0u;
+    for(size_type w = 0u; w < word_count(); w++) {
+        count += static_cast<size_type>(__builtin_popcountll(words_[w]));
+    }
+    return count;
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::all() const noexcept {
+    return find_first_unset() == size_;
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::any() const noexcept {
+    return !none();
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::none() const noexcept {
+    return find_first() == size_;
+}
+
+/* Position of the first set bit, or size() if there is none */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::find_first() const noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        if(words_[w]) {
+            return w * detail::bit_word_width + static_cast<size_type>(__builtin_ctzll(words_[w]));
+        }
+    }
+    return size_;
+}
+
+/* Position of the first set bit after i, or size() if there is none */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::find_next(size_type i) const noexcept {
+    if(++i >= size_) {
+        return size_;
+    }
+    auto w = i / detail::bit_word_width;
+    auto word = words_[w] & (~word_type{0} << (i % detail::bit_word_width));
+    while(!word) {
+        if(++w == word_count()) {
+            return size_;
+        }
+        word = words_[w];
+    }
+    return w * detail::bit_word_width + static_cast<size_type>(__builtin_ctzll(word));
+}
+
+/* Position of the first clear bit, or size() if there is none */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::find_first_unset() const noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        if(~words_[w]) {
+            auto const i = w * detail::bit_word_width + static_cast<size_type>(__builtin_ctzll(~words_[w]));
+            return i < size_ ? i : size_;
+        }
+    }
+    return size_;
+}
+
+/* Calls f with the position of each set bit in ascending order. Bits are taken off each word by clearing the lowest
+ * one, so that the only branch that depends on the data is the one leaving the word */
+template <std::size_t N>
+template <typename F>
+constexpr void static_bitvec<N>::for_each_set(F&& f) const noexcept(noexcept(f(size_type{}))) {
+    for(size_type w = 0u; w < word_count(); w++) {
+        for(auto word = words_[w]; word; word &= word - 1u) {
+            f(w * detail::bit_word_width + static_cast<size_type>(__builtin_ctzll(word)));
+        }
+    }
+}
+
+/* Number of set bits in [0, i) */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::rank(size_type i) const noexcept {
+    size_type count = 0u;
+    auto const w = i / detail::bit_word_width;
+    for(size_type k = 0u; k < w; k++) {
+        count += static_cast<size_type>(__builtin_popcountll(words_[k]));
+    }
+    if(i % detail::bit_word_width) {
+        count += static_cast<size_type>(__builtin_popcountll(words_[w] & detail::low_bits(i % detail::bit_word_width)));
+    }
+    return count;
+}
+
+/* Position of the set bit of rank k, counting from zero, or size() if fewer than k + 1 bits are set */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::size_type static_bitvec<N>::select(size_type k) const noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        auto const count = static_cast<size_type>(__builtin_popcountll(words_[w]));
+        if(k < count) {
+            return w * detail::bit_word_width + detail::select_bit(words_[w], k);
+        }
+        k -= count;
+    }
+    return size_;
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::swap(static_bitvec& other) noexcept {
+    for(size_type w = 0u; w < words; w++) {
+        auto const word = words_[w];
+        words_[w] = other.words_[w];
+        other.words_[w] = word;
+    }
+    auto const size = size_;
+    size_ = other.size_;
+    other.size_ = size;
+}
+
+template <std::size_t N>
+constexpr void static_bitvec<N>::clear() noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        words_[w] = 0u;
+    }
+    size_ = 0u;
+}
+
+/* Growing sets the new bits to value. Returns false if size exceeds the capacity, in which case the vector is
+ * resized to capacity */
+template <std::size_t N>
+constexpr bool static_bitvec<N>::resize(size_type size, bool value) noexcept {
+    auto const fits = size <= capacity();
+    size = fits ? size : capacity();
+    if(size > size_) {
+        auto const first = size_;
+        size_ = size;
+        fill(first, size, value);
+    }
+    else {
+        fill(size, size_, false);
+        size_ = size;
+    }
+    return fits;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::insert(const_iterator pos, bool value) noexcept {
+    return insert(pos, 1u, value);
+}
+
+/* Returns end() if the bits do not fit */
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::insert(const_iterator pos, size_type count, bool value) noexcept {
+    if(size_ + count > capacity()) {
+        return end();
+    }
+    auto const i = static_cast<size_type>(pos - cbegin());
+    shift_up(i, count);
+    fill(i, i + count, value);
+    return begin() + static_cast<difference_type>(i);
+}
+
+template <std::size_t N>
+constexpr bool static_bitvec<N>::push_back(bool value) noexcept {
+    if(full()) {
+        return false;
+    }
+    (*this)[size_++] = value;
+    return true;
+}
+
+/* Returns the removed bit */
+template <std::size_t N>
+constexpr bool static_bitvec<N>::pop_back() noexcept {
+    bool const value = back();
+    (*this)[--size_] = false;
+    return value;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::erase(const_iterator pos) noexcept {
+    return erase(pos, pos + 1);
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::erase(const_iterator first, const_iterator last) noexcept {
+    auto const i = static_cast<size_type>(first - cbegin());
+    shift_down(i, static_cast<size_type>(last - first));
+    return begin() + static_cast<difference_type>(i);
+}
+
+/* The binary operators keep the size of the left-hand side, treating bits of other past its size as clear */
+template <std::size_t N>
+constexpr static_bitvec<N>& static_bitvec<N>::operator&=(static_bitvec const& other) noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        words_[w] &= other.words_[w];
+    }
+    return *this;
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N>& static_bitvec<N>::operator|=(static_bitvec const& other) noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        words_[w] |= other.words_[w];
+    }
+    clear_tail();
+    return *this;
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N>& static_bitvec<N>::operator^=(static_bitvec const& other) noexcept {
+    for(size_type w = 0u; w < word_count(); w++) {
+        words_[w] ^= other.words_[w];
+    }
+    clear_tail();
+    return *this;
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::begin() noexcept {
+    return iterator{words_.data(), 0};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::iterator static_bitvec<N>::end() noexcept {
+    return iterator{words_.data(), static_cast<difference_type>(size_)};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_iterator static_bitvec<N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_iterator static_bitvec<N>::end() const noexcept {
+    return cend();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_iterator static_bitvec<N>::cbegin() const noexcept {
+    return const_iterator{words_.data(), 0};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_iterator static_bitvec<N>::cend() const noexcept {
+    return const_iterator{words_.data(), static_cast<difference_type>(size_)};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reverse_iterator static_bitvec<N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::reverse_iterator static_bitvec<N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reverse_iterator static_bitvec<N>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reverse_iterator static_bitvec<N>::rend() const noexcept {
+    return crend();
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reverse_iterator static_bitvec<N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <std::size_t N>
+constexpr typename static_bitvec<N>::const_reverse_iterator static_bitvec<N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+/* Sets the bits in [first, last), whole words at a time */
+template <std::size_t N>
+constexpr void static_bitvec<N>::fill(size_type first, size_type last, bool value) noexcept {
+    for(auto w = first / detail::bit_word_width; first < last; w++) {
+        auto const offset = first % detail::bit_word_width;
+        auto const span = std::min(last - first, detail::bit_word_width - offset);
+        auto const mask = detail::low_bits(span) << offset;
+        words_[w] = value ? words_[w] | mask : words_[w] & ~mask;
+        first += span;
+    }
+}
+
+/* Clears the bits past size() in the last word in use */
+template <std::size_t N>
+constexpr void static_bitvec<N>::clear_tail() noexcept {
+    if(size_ % detail::bit_word_width) {
+        words_[size_ / detail::bit_word_width] &= detail::low_bits(size_ % detail::bit_word_width);
+    }
+}
+
+/* Moves the bits in [pos, size()) up by count and grows the vector by count, going from the last word down. Each
+ * word is assembled from the bits below pos it keeps and 64 bits read at its offset minus count */
+template <std::size_t N>
+constexpr void static_bitvec<N>::shift_up(size_type pos, size_type count) noexcept {
+    if(!count) {
+        return;
+    }
+    auto const old_words = word_count();
+    size_ += count;
+    for(auto w = word_count(); w-- > pos / detail::bit_word_width;) {
+        auto const base = w * detail::bit_word_width;
+        auto const moved = detail::read_bits(words_.data(), old_words, static_cast<difference_type>(base) - static_cast<difference_type>(count));
+        auto const keep = pos > base ? detail::low_bits(pos - base) : word_type{0};
+        words_[w] = (words_[w] & keep) | (moved & ~keep);
+    }
+}
+
+/* Removes the bits in [pos, pos + count) by moving the following ones down, going from the first affected word up.
+ * Bits read from past the old size are clear, so the vacated tail ends up clear */
+template <std::size_t N>
+constexpr void static_bitvec<N>::shift_down(size_type pos, size_type count) noexcept {
+    if(!count) {
+        return;
+    }
+    auto const old_words = word_count();
+    for(auto w = pos / detail::bit_word_width; w < old_words; w++) {
+        auto const base = w * detail::bit_word_width;
+        auto const moved = detail::read_bits(words_.data(), old_words, static_cast<difference_type>(base + count));
+        auto const keep = pos > base ? detail::low_bits(pos - base) : word_type{0};
+        words_[w] = (words_[w] & keep) | (moved & ~keep);
+    }
+    size_ -= count;
+}
+
+template <std::size_t M>
+constexpr bool operator==(static_bitvec<M> const& lhs, static_bitvec<M> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t w = 0u; w < lhs.word_count(); w++) {
+        if(lhs.words_[w] != rhs.words_[w]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool operator!=(static_bitvec<N> const& lhs, static_bitvec<N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N> operator&(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept {
+    return lhs &= rhs;
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N> operator|(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept {
+    return lhs |= rhs;
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N> operator^(static_bitvec<N> lhs, static_bitvec<N> const& rhs) noexcept {
+    return lhs ^= rhs;
+}
+
+template <std::size_t N>
+constexpr static_bitvec<N> operator~(static_bitvec<N> vec) noexcept {
+    vec.flip();
+    return vec;
+}
+
+#endif /* STATIC_BITVEC_H */
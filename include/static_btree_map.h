@@ -0,0 +1,1038 @@
+#ifndef STATIC_BTREE_MAP_H
+#define STATIC_BTREE_MAP_H
+
+#include "sorted_statvec.h"
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+class static_btree_map;
+
+namespace detail {
+
+/* Keys per node, as many as fit in a cache line but at least 4 */
+template <typename Key>
+inline std::size_t constexpr btree_node_width = 64u / sizeof(Key) < 4u ? 4u : 64u / sizeof(Key);
+
+template <typename Key, typename T, std::size_t B, typename Index>
+struct btree_leaf {
+    using key_type    = Key;
+    using mapped_type = T;
+    using index_type  = Index;
+
+    statvec<Key, B> keys{};
+    statvec<T, B> values{};
+    Index prev{std::numeric_limits<Index>::max()};
+    Index next{std::numeric_limits<Index>::max()};
+};
+
+/* Child i holds the keys ordered before keys[i] and not before keys[i - 1] */
+template <typename Key, std::size_t B, typename Index>
+struct btree_inner {
+    statvec<Key, B> keys{};
+    statvec<Index, B + 1u> children{};
+};
+
+template <typename Leaf>
+class btree_iterator {
+    using index_type = typename Leaf::index_type;
+    using mapped_type = std::conditional_t<std::is_const_v<Leaf>, typename Leaf::mapped_type const, typename Leaf::mapped_type>;
+
+    public:
+        using value_type        = std::pair<typename Leaf::key_type, typename Leaf::mapped_type>;
+        using reference         = std::pair<typename Leaf::key_type const&, mapped_type&>;
+        using pointer           = arrow_proxy<reference>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        constexpr btree_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Leaf> && !std::is_same_v<U, Leaf>>>
+        constexpr btree_iterator(btree_iterator<U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        constexpr btree_iterator& operator++() noexcept;
+        constexpr btree_iterator operator++(int) noexcept;
+
+        constexpr btree_iterator& operator--() noexcept;
+        constexpr btree_iterator operator--(int) noexcept;
+
+        template <typename U>
+        friend constexpr bool operator==(btree_iterator<U> const& lhs, btree_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator!=(btree_iterator<U> const& lhs, btree_iterator<U> const& rhs) noexcept;
+
+    private:
+        Leaf* leaves_{};
+        index_type const* last_{};
+        index_type leaf_{std::numeric_limits<index_type>::max()};
+        /* Wider than leaf_, as GCC otherwise merges both into one load when comparing iterators, right after storing
+         * them apart, which defeats store forwarding and makes each step of a scan several times slower */
+        std::size_t pos_{};
+
+        constexpr btree_iterator(Leaf* leaves, index_type const* last, index_type leaf, index_type pos) noexcept;
+
+        template <typename>
+        friend class btree_iterator;
+        template <typename, typename, std::size_t, typename, std::size_t>
+        friend class ::static_btree_map;
+};
+
+/* Number of keys in the node ordered before key. A node of arithmetic keys filling whole 16-byte lanes of at most a
+ * cache line is searched without branches, comparing all of its lanes with SIMD and masking off the stale keys past
+ * its size before counting */
+template <typename Key, std::size_t B, typename Compare>
+constexpr std::size_t btree_lower_bound(statvec<Key, B> const& keys, Key const& key, Compare const& comp) noexcept;
+
+template <typename Vec>
+constexpr void move_append(Vec& dst, Vec& src, std::size_t first) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type>);
+
+/* Node elements are shifted by hand, as the std algorithms behind statvec::insert and statvec::erase are not
+ * constexpr in C++17 */
+template <typename Vec, typename U>
+constexpr void shift_insert(Vec& vec, std::size_t pos, U&& value) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type> &&
+                                                                           std::is_nothrow_assignable_v<typename Vec::value_type&, U&&>);
+template <typename Vec>
+constexpr void shift_erase(Vec& vec, std::size_t pos) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type>);
+
+/* Number of nodes a tree of n leaves may need above them, with non-root nodes holding at least min_children */
+constexpr std::size_t btree_inner_count(std::size_t n, std::size_t min_children) noexcept;
+constexpr std::size_t btree_max_height(std::size_t n, std::size_t min_children) noexcept;
+
+} // namespace detail
+
+/* Fixed-capacity ordered map stored as a B+tree of at most B keys per node. Keys and values of a leaf are kept in
+ * separate statvecs, so that searching a node touches only its keys, which by default fill one cache line. Leaves
+ * are linked in key order for range scans. All nodes are drawn from pools sized for N elements at compile time, and
+ * are linked by 16-bit indices, or 32-bit ones for large pools. As with statvec, all keys and values in the pools
+ * are constructed for the lifetime of the map */
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>, std::size_t B = detail::btree_node_width<Key>>
+class static_btree_map {
+    static_assert(B >= 4u, "Nodes must hold at least 4 keys");
+
+    /* Fill of non-root nodes, in keys */
+    static std::size_t constexpr min_fill = B / 2u;
+    static std::size_t constexpr leaf_capacity = N / min_fill + 1u;
+    static std::size_t constexpr inner_capacity = detail::btree_inner_count(leaf_capacity, min_fill + 1u);
+    static std::size_t constexpr max_height = detail::btree_max_height(leaf_capacity, min_fill + 1u);
+
+    using index_type = std::conditional_t<(leaf_capacity < 0xffffu && inner_capacity < 0xffffu), std::uint16_t, std::uint32_t>;
+    using leaf_node = detail::btree_leaf<Key, T, B, index_type>;
+    using inner_node = detail::btree_inner<Key, B, index_type>;
+
+    static index_type constexpr npos = std::numeric_limits<index_type>::max();
+    static bool constexpr nothrow_move_v = std::is_nothrow_move_assignable_v<Key> && std::is_nothrow_move_assignable_v<T> &&
+                                           std::is_nothrow_copy_assignable_v<Key>;
+
+    template <typename U>
+    using enable_if_input_iterator_t = detail::enable_if_input_iterator_t<U>;
+
+    struct path_entry {
+        index_type node;
+        index_type child;
+    };
+
+    using path_type = std::array<path_entry, max_height>;
+
+    public:
+        using key_type        = Key;
+        using mapped_type     = T;
+        using value_type      = std::pair<Key, T>;
+        using key_compare     = Compare;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator        = detail::btree_iterator<leaf_node>;
+        using const_iterator  = detail::btree_iterator<leaf_node const>;
+        using reference       = typename iterator::reference;
+        using const_reference = typename const_iterator::reference;
+
+        constexpr static_btree_map() noexcept = default;
+        explicit constexpr static_btree_map(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr T& at(key_type const& key);
+        constexpr T const& at(key_type const& key) const;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+        constexpr size_type height() const noexcept;
+
+        constexpr key_compare key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr void clear() noexcept;
+
+        constexpr iterator lower_bound(key_type const& key) noexcept;
+        constexpr const_iterator lower_bound(key_type const& key) const noexcept;
+        constexpr iterator upper_bound(key_type const& key) noexcept;
+        constexpr const_iterator upper_bound(key_type const& key) const noexcept;
+        constexpr iterator find(key_type const& key) noexcept;
+        constexpr const_iterator find(key_type const& key) const noexcept;
+        constexpr bool contains(key_type const& key) const noexcept;
+        constexpr size_type count(key_type const& key) const noexcept;
+
+        constexpr std::pair<iterator, bool> insert(value_type const& value) noexcept(nothrow_move_v && std::is_nothrow_copy_assignable_v<T>);
+        constexpr std::pair<iterator, bool> insert(value_type&& value) noexcept(nothrow_move_v);
+        template <typename U>
+        constexpr std::pair<iterator, bool> insert_or_assign(key_type const& key, U&& value) noexcept(nothrow_move_v &&
+                                                                                                      std::is_nothrow_assignable_v<T&, U&&> &&
+                                                                                                      std::is_nothrow_constructible_v<T, U&&>);
+        template <typename... Ts>
+        constexpr std::pair<iterator, bool> try_emplace(key_type const& key, Ts&&... args) noexcept(nothrow_move_v &&
+                                                                                                    std::is_nothrow_constructible_v<T, Ts&&...>);
+        template <typename It, typename = enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool assign_sorted(It first, It last) noexcept(nothrow_move_v && std::is_nothrow_copy_assignable_v<T>);
+
+        constexpr iterator erase(const_iterator pos) noexcept(nothrow_move_v);
+        constexpr size_type erase(key_type const& key) noexcept(nothrow_move_v);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        std::array<leaf_node, leaf_capacity> leaves_{};
+        std::array<inner_node, inner_capacity> inners_{};
+        statvec<index_type, leaf_capacity> free_leaves_{};
+        statvec<index_type, inner_capacity> free_inners_{};
+        index_type used_leaves_{1u};
+        index_type used_inners_{};
+        index_type root_{};
+        index_type first_leaf_{};
+        index_type last_leaf_{};
+        size_type height_{};
+        size_type size_{};
+        Compare comp_{};
+
+        constexpr index_type route(inner_node const& node, key_type const& key) const noexcept;
+        constexpr index_type descend(key_type const& key, path_type& path) const noexcept;
+        constexpr std::pair<index_type, index_type> locate(key_type const& key) const noexcept;
+
+        constexpr iterator iterator_at(index_type leaf, index_type pos) noexcept;
+        constexpr const_iterator iterator_at(index_type leaf, index_type pos) const noexcept;
+
+        constexpr index_type allocate_leaf() noexcept;
+        constexpr index_type allocate_inner() noexcept;
+        constexpr void free_leaf(index_type node) noexcept;
+        constexpr void free_inner(index_type node) noexcept;
+
+        template <typename K, typename... Ts>
+        constexpr std::pair<iterator, bool> insert_unique(K&& key, Ts&&... args) noexcept(nothrow_move_v &&
+                                                                                         std::is_nothrow_constructible_v<T, Ts&&...>);
+        constexpr index_type split_leaf(index_type node) noexcept(nothrow_move_v);
+        constexpr void insert_separator(path_type const& path, key_type separator, index_type child) noexcept(nothrow_move_v);
+        constexpr key_type const& min_key(index_type node, size_type height) const noexcept;
+        constexpr void build_inner_levels() noexcept(nothrow_move_v);
+
+        constexpr void erase_at(path_type const& path, index_type leaf, index_type pos) noexcept(nothrow_move_v);
+        constexpr void rebalance_leaf(path_type const& path, index_type leaf) noexcept(nothrow_move_v);
+        constexpr void rebalance_inner(path_type const& path, size_type level) noexcept(nothrow_move_v);
+};
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool operator==(static_btree_map<Key, T, N, Compare, B> const& lhs, static_btree_map<Key, T, N, Compare, B> const& rhs) noexcept;
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool operator!=(static_btree_map<Key, T, N, Compare, B> const& lhs, static_btree_map<Key, T, N, Compare, B> const& rhs) noexcept;
+
+namespace detail {
+
+template <typename Leaf>
+template <typename U, typename>
+constexpr btree_iterator<Leaf>::btree_iterator(btree_iterator<U> const& other) noexcept
+    : leaves_{other.leaves_}, last_{other.last_}, leaf_{other.leaf_}, pos_{other.pos_} { }
+
+template <typename Leaf>
+constexpr btree_iterator<Leaf>::btree_iterator(Leaf* leaves, index_type const* last, index_type leaf, index_type pos) noexcept
+    : leaves_{leaves}, last_{last}, leaf_{leaf}, pos_{pos} { }
+
+template <typename Leaf>
+constexpr typename btree_iterator<Leaf>::reference btree_iterator<Leaf>::operator*() const noexcept {
+    return {leaves_[leaf_].keys[pos_], leaves_[leaf_].values[pos_]};
+}
+
+template <typename Leaf>
+constexpr typename btree_iterator<Leaf>::pointer btree_iterator<Leaf>::operator->() const noexcept {
+    return {**this};
+}
+
+template <typename Leaf>
+constexpr btree_iterator<Leaf>& btree_iterator<Leaf>::operator++() noexcept {
+    if(++pos_ == leaves_[leaf_].keys.size()) {
+        leaf_ = leaves_[leaf_].next;
+        pos_ = 0u;
+    }
+    return *this;
+}
+
+template <typename Leaf>
+constexpr btree_iterator<Leaf> btree_iterator<Leaf>::operator++(int) noexcept {
+    auto const it = *this;
+    ++*this;
+    return it;
+}
+
+template <typename Leaf>
+constexpr btree_iterator<Leaf>& btree_iterator<Leaf>::operator--() noexcept {
+    if(leaf_ == std::numeric_limits<index_type>::max()) {
+        leaf_ = *last_;
+        pos_ = leaves_[leaf_].keys.size();
+    }
+    else if(!pos_) {
+        leaf_ = leaves_[leaf_].prev;
+        pos_ = leaves_[leaf_].keys.size();
+    }
+    --pos_;
+    return *this;
+}
+
+template <typename Leaf>
+constexpr btree_iterator<Leaf> btree_iterator<Leaf>::operator--(int) noexcept {
+    auto const it = *this;
+    --*this;
+    return it;
+}
+
+template <typename U>
+constexpr bool operator==(btree_iterator<U> const& lhs, btree_iterator<U> const& rhs) noexcept {
+    return lhs.leaf_ == rhs.leaf_ && lhs.pos_ == rhs.pos_;
+}
+
+template <typename U>
+constexpr bool operator!=(btree_iterator<U> const& lhs, btree_iterator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename Key, std::size_t B, typename Compare>
+constexpr std::size_t btree_lower_bound(statvec<Key, B> const& keys, Key const& key, Compare const& comp) noexcept {
+#ifdef __SSE2__
+    if constexpr(is_simd_searchable_v<Key, Key, Compare, identity> && (B * sizeof(Key)) % 16u == 0u && B * sizeof(Key) <= 64u) {
+        if(!__builtin_is_constant_evaluated()) {
+            std::uint64_t mask = 0u;
+            for(std::size_t i = 0u; i < B * sizeof(Key); i += 16u) {
+                mask |= std::uint64_t{simd_less_mask(keys.data() + i / sizeof(Key), key)} << i;
+            }
+            std::size_t const bytes = keys.size() * sizeof(Key);
+            mask &= bytes == 64u ? ~std::uint64_t{0} : (std::uint64_t{1} << bytes) - 1u;
+            return static_cast<std::size_t>(__builtin_popcountll(mask)) / sizeof(Key);
+        }
+    }
+#endif
+    return sorted_lower_bound(keys.data(), keys.size(), key, comp, identity{});
+}
+
+template <typename Vec>
+constexpr void move_append(Vec& dst, Vec& src, std::size_t first) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type>) {
+    for(auto i = first; i < src.size(); i++) {
+        dst.push_back(std::move(src[i]));
+    }
+    src.resize(first);
+}
+
+template <typename Vec, typename U>
+constexpr void shift_insert(Vec& vec, std::size_t pos, U&& value) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type> &&
+                                                                           std::is_nothrow_assignable_v<typename Vec::value_type&, U&&>) {
+    vec.resize(vec.size() + 1u);
+    for(auto i = vec.size() - 1u; i > pos; i--) {
+        vec[i] = std::move(vec[i - 1u]);
+    }
+    vec[pos] = std::forward<U>(value);
+}
+
+template <typename Vec>
+constexpr void shift_erase(Vec& vec, std::size_t pos) noexcept(std::is_nothrow_move_assignable_v<typename Vec::value_type>) {
+    for(auto i = pos + 1u; i < vec.size(); i++) {
+        vec[i - 1u] = std::move(vec[i]);
+    }
+    vec.resize(vec.size() - 1u);
+}
+
+constexpr std::size_t btree_inner_count(std::size_t n, std::size_t min_children) noexcept {
+    std::size_t count = 0u;
+    while(n > 1u) {
+        n = n / min_children + 1u;
+        count += n;
+    }
+    return count ? count : 1u;
+}
+
+constexpr std::size_t btree_max_height(std::size_t n, std::size_t min_children) noexcept {
+    std::size_t height = 0u;
+    while(n > 1u) {
+        n = n / min_children + 1u;
+        ++height;
+    }
+    return height ? height : 1u;
+}
+
+} // namespace detail
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr static_btree_map<Key, T, N, Compare, B>::static_btree_map(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+    : comp_{comp} { }
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr T& static_btree_map<Key, T, N, Compare, B>::at(key_type const& key) {
+    auto const [leaf, pos] = locate(key);
+    if(leaf == npos) {
+        throw std::out_of_range("Key not found");
+    }
+    return leaves_[leaf].values[pos];
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr T const& static_btree_map<Key, T, N, Compare, B>::at(key_type const& key) const {
+    auto const [leaf, pos] = locate(key);
+    if(leaf == npos) {
+        throw std::out_of_range("Key not found");
+    }
+    return leaves_[leaf].values[pos];
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool static_btree_map<Key, T, N, Compare, B>::empty() const noexcept {
+    return !size_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool static_btree_map<Key, T, N, Compare, B>::full() const noexcept {
+    return size_ == N;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type static_btree_map<Key, T, N, Compare, B>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type static_btree_map<Key, T, N, Compare, B>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type static_btree_map<Key, T, N, Compare, B>::capacity() const noexcept {
+    return N;
+}
+
+/* Number of inner levels above the leaves */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type static_btree_map<Key, T, N, Compare, B>::height() const noexcept {
+    return height_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::key_compare
+static_btree_map<Key, T, N, Compare, B>::key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>) {
+    return comp_;
+}
+
+/* Empties the nodes in use and returns the pools to their initial state, a single empty root leaf */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::clear() noexcept {
+    for(index_type i = 0u; i < used_leaves_; i++) {
+        leaves_[i].keys.clear();
+        leaves_[i].values.clear();
+    }
+    for(index_type i = 0u; i < used_inners_; i++) {
+        inners_[i].keys.clear();
+        inners_[i].children.clear();
+    }
+    leaves_[0].prev = npos;
+    leaves_[0].next = npos;
+    free_leaves_.clear();
+    free_inners_.clear();
+    used_leaves_ = 1u;
+    used_inners_ = 0u;
+    root_ = 0u;
+    first_leaf_ = 0u;
+    last_leaf_ = 0u;
+    height_ = 0u;
+    size_ = 0u;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator
+static_btree_map<Key, T, N, Compare, B>::lower_bound(key_type const& key) noexcept {
+    path_type path{};
+    auto const leaf = descend(key, path);
+    return iterator_at(leaf, static_cast<index_type>(detail::btree_lower_bound(leaves_[leaf].keys, key, comp_)));
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator
+static_btree_map<Key, T, N, Compare, B>::lower_bound(key_type const& key) const noexcept {
+    path_type path{};
+    auto const leaf = descend(key, path);
+    return iterator_at(leaf, static_cast<index_type>(detail::btree_lower_bound(leaves_[leaf].keys, key, comp_)));
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator
+static_btree_map<Key, T, N, Compare, B>::upper_bound(key_type const& key) noexcept {
+    auto it = lower_bound(key);
+    if(it != end() && !comp_(key, it->first)) {
+        ++it;
+    }
+    return it;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator
+static_btree_map<Key, T, N, Compare, B>::upper_bound(key_type const& key) const noexcept {
+    auto it = lower_bound(key);
+    if(it != end() && !comp_(key, it->first)) {
+        ++it;
+    }
+    return it;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator static_btree_map<Key, T, N, Compare, B>::find(key_type const& key) noexcept {
+    auto const [leaf, pos] = locate(key);
+    return leaf == npos ? end() : iterator_at(leaf, pos);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator
+static_btree_map<Key, T, N, Compare, B>::find(key_type const& key) const noexcept {
+    auto const [leaf, pos] = locate(key);
+    return leaf == npos ? end() : iterator_at(leaf, pos);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool static_btree_map<Key, T, N, Compare, B>::contains(key_type const& key) const noexcept {
+    return locate(key).first != npos;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type
+static_btree_map<Key, T, N, Compare, B>::count(key_type const& key) const noexcept {
+    return contains(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::iterator, bool>
+static_btree_map<Key, T, N, Compare, B>::insert(value_type const& value) noexcept(nothrow_move_v && std::is_nothrow_copy_assignable_v<T>) {
+    return insert_unique(value.first, value.second);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::iterator, bool>
+static_btree_map<Key, T, N, Compare, B>::insert(value_type&& value) noexcept(nothrow_move_v) {
+    return insert_unique(std::move(value.first), std::move(value.second));
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+template <typename U>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::iterator, bool>
+static_btree_map<Key, T, N, Compare, B>::insert_or_assign(key_type const& key, U&& value) noexcept(nothrow_move_v &&
+                                                                                                  std::is_nothrow_assignable_v<T&, U&&> &&
+                                                                                                  std::is_nothrow_constructible_v<T, U&&>) {
+    auto const [leaf, pos] = locate(key);
+    if(leaf != npos) {
+        leaves_[leaf].values[pos] = std::forward<U>(value);
+        return {iterator_at(leaf, pos), false};
+    }
+    return insert_unique(key, std::forward<U>(value));
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+template <typename... Ts>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::iterator, bool>
+static_btree_map<Key, T, N, Compare, B>::try_emplace(key_type const& key, Ts&&... args) noexcept(nothrow_move_v &&
+                                                                                                std::is_nothrow_constructible_v<T, Ts&&...>) {
+    return insert_unique(key, std::forward<Ts>(args)...);
+}
+
+/* Replaces the contents with the ascending range [first, last) of pairs of unique keys and values, filling leaves
+ * completely from left to right and then building each inner level over the one below. Only the last two nodes of
+ * a level may be rebalanced to keep them at least half full. Returns false if the range holds more than N elements,
+ * in which case the map holds the first N */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+template <typename It, typename>
+constexpr bool static_btree_map<Key, T, N, Compare, B>::assign_sorted(It first, It last) noexcept(nothrow_move_v &&
+                                                                                                 std::is_nothrow_copy_assignable_v<T>) {
+    clear();
+    index_type node = root_;
+    for(; first != last && size_ < N; ++first, ++size_) {
+        if(leaves_[node].keys.size() == B) {
+            auto const next = allocate_leaf();
+            leaves_[node].next = next;
+            leaves_[next].prev = node;
+            leaves_[next].next = npos;
+            node = next;
+        }
+        auto const& value = *first;
+        leaves_[node].keys.push_back(value.first);
+        leaves_[node].values.push_back(value.second);
+    }
+    last_leaf_ = node;
+
+    auto& tail = leaves_[node];
+    if(node != first_leaf_ && tail.keys.size() < min_fill) {
+        auto& prev = leaves_[tail.prev];
+        auto const count = (prev.keys.size() + tail.keys.size()) / 2u - tail.keys.size();
+        for(size_type i = 0u; i < count; i++) {
+            detail::shift_insert(tail.keys, 0u, std::move(prev.keys.back()));
+            detail::shift_insert(tail.values, 0u, std::move(prev.values.back()));
+            prev.keys.resize(prev.keys.size() - 1u);
+            prev.values.resize(prev.values.size() - 1u);
+        }
+    }
+    build_inner_levels();
+    return first == last;
+}
+
+/* Returns an iterator to the element following the erased one. Erasure may move elements between leaves, so the
+ * successor is looked up again by key */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator
+static_btree_map<Key, T, N, Compare, B>::erase(const_iterator pos) noexcept(nothrow_move_v) {
+    auto const next = std::next(pos);
+    path_type path{};
+    auto const leaf = descend(pos->first, path);
+    if(next == cend()) {
+        erase_at(path, leaf, static_cast<index_type>(pos.pos_));
+        return end();
+    }
+    auto const key = next->first;
+    erase_at(path, leaf, static_cast<index_type>(pos.pos_));
+    return lower_bound(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::size_type
+static_btree_map<Key, T, N, Compare, B>::erase(key_type const& key) noexcept(nothrow_move_v) {
+    path_type path{};
+    auto const leaf = descend(key, path);
+    auto const& keys = leaves_[leaf].keys;
+    auto const pos = detail::btree_lower_bound(keys, key, comp_);
+    if(pos == keys.size() || comp_(key, keys[pos])) {
+        return 0u;
+    }
+    erase_at(path, leaf, static_cast<index_type>(pos));
+    return 1u;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator static_btree_map<Key, T, N, Compare, B>::begin() noexcept {
+    return size_ ? iterator{leaves_.data(), &last_leaf_, first_leaf_, 0u} : end();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator static_btree_map<Key, T, N, Compare, B>::end() noexcept {
+    return iterator{leaves_.data(), &last_leaf_, npos, 0u};
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator static_btree_map<Key, T, N, Compare, B>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator static_btree_map<Key, T, N, Compare, B>::end() const noexcept {
+    return cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator static_btree_map<Key, T, N, Compare, B>::cbegin() const noexcept {
+    return size_ ? const_iterator{leaves_.data(), &last_leaf_, first_leaf_, 0u} : cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator static_btree_map<Key, T, N, Compare, B>::cend() const noexcept {
+    return const_iterator{leaves_.data(), &last_leaf_, npos, 0u};
+}
+
+/* Index of the child whose keys may contain key, one past the last separator not ordered after it */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::index_type
+static_btree_map<Key, T, N, Compare, B>::route(inner_node const& node, key_type const& key) const noexcept {
+    auto i = detail::btree_lower_bound(node.keys, key, comp_);
+    if(i < node.keys.size() && !comp_(key, node.keys[i])) {
+        ++i;
+    }
+    return static_cast<index_type>(i);
+}
+
+/* Returns the leaf whose keys may contain key, recording the inner node and child index taken at each level */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::index_type
+static_btree_map<Key, T, N, Compare, B>::descend(key_type const& key, path_type& path) const noexcept {
+    auto node = root_;
+    for(size_type level = 0u; level < height_; level++) {
+        auto const child = route(inners_[node], key);
+        path[level] = path_entry{node, child};
+        node = inners_[node].children[child];
+    }
+    return node;
+}
+
+/* Leaf and position of key, or npos if absent */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::index_type, typename static_btree_map<Key, T, N, Compare, B>::index_type>
+static_btree_map<Key, T, N, Compare, B>::locate(key_type const& key) const noexcept {
+    auto node = root_;
+    for(size_type level = 0u; level < height_; level++) {
+        node = inners_[node].children[route(inners_[node], key)];
+    }
+    auto const& keys = leaves_[node].keys;
+    auto const pos = detail::btree_lower_bound(keys, key, comp_);
+    if(pos == keys.size() || comp_(key, keys[pos])) {
+        return {npos, 0u};
+    }
+    return {node, static_cast<index_type>(pos)};
+}
+
+/* Iterator to the element at pos in leaf, moving on to the next leaf if pos is one past its last element */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::iterator
+static_btree_map<Key, T, N, Compare, B>::iterator_at(index_type leaf, index_type pos) noexcept {
+    if(pos == leaves_[leaf].keys.size()) {
+        return iterator{leaves_.data(), &last_leaf_, leaves_[leaf].next, 0u};
+    }
+    return iterator{leaves_.data(), &last_leaf_, leaf, pos};
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::const_iterator
+static_btree_map<Key, T, N, Compare, B>::iterator_at(index_type leaf, index_type pos) const noexcept {
+    if(pos == leaves_[leaf].keys.size()) {
+        return const_iterator{leaves_.data(), &last_leaf_, leaves_[leaf].next, 0u};
+    }
+    return const_iterator{leaves_.data(), &last_leaf_, leaf, pos};
+}
+
+/* Freed nodes are reused last in, first out, nodes never used are handed out in order */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::index_type static_btree_map<Key, T, N, Compare, B>::allocate_leaf() noexcept {
+    if(free_leaves_.empty()) {
+        return used_leaves_++;
+    }
+    auto const node = free_leaves_.back();
+    free_leaves_.resize(free_leaves_.size() - 1u);
+    return node;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::index_type static_btree_map<Key, T, N, Compare, B>::allocate_inner() noexcept {
+    if(free_inners_.empty()) {
+        return used_inners_++;
+    }
+    auto const node = free_inners_.back();
+    free_inners_.resize(free_inners_.size() - 1u);
+    return node;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::free_leaf(index_type node) noexcept {
+    leaves_[node].keys.clear();
+    leaves_[node].values.clear();
+    free_leaves_.push_back(node);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::free_inner(index_type node) noexcept {
+    inners_[node].keys.clear();
+    inners_[node].children.clear();
+    free_inners_.push_back(node);
+}
+
+/* A full leaf is split before inserting, the new element going to whichever half covers its position */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+template <typename K, typename... Ts>
+constexpr std::pair<typename static_btree_map<Key, T, N, Compare, B>::iterator, bool>
+static_btree_map<Key, T, N, Compare, B>::insert_unique(K&& key, Ts&&... args) noexcept(nothrow_move_v &&
+                                                                                      std::is_nothrow_constructible_v<T, Ts&&...>) {
+    path_type path{};
+    auto leaf = descend(key, path);
+    auto pos = detail::btree_lower_bound(leaves_[leaf].keys, key, comp_);
+    if(pos < leaves_[leaf].keys.size() && !comp_(key, leaves_[leaf].keys[pos])) {
+        return {iterator_at(leaf, static_cast<index_type>(pos)), false};
+    }
+    if(size_ == N) {
+        return {end(), false};
+    }
+
+    if(leaves_[leaf].keys.size() == B) {
+        auto const right = split_leaf(leaf);
+        insert_separator(path, leaves_[right].keys.front(), right);
+        if(pos > min_fill) {
+            leaf = right;
+            pos -= min_fill;
+        }
+    }
+    auto& node = leaves_[leaf];
+    detail::shift_insert(node.keys, pos, std::forward<K>(key));
+    detail::shift_insert(node.values, pos, T(std::forward<Ts>(args)...));
+    ++size_;
+    return {iterator{leaves_.data(), &last_leaf_, leaf, static_cast<index_type>(pos)}, true};
+}
+
+/* Moves the upper half of a full leaf into a new leaf linked after it, and returns the new leaf */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::index_type
+static_btree_map<Key, T, N, Compare, B>::split_leaf(index_type node) noexcept(nothrow_move_v) {
+    auto const right = allocate_leaf();
+    auto& lhs = leaves_[node];
+    auto& rhs = leaves_[right];
+    detail::move_append(rhs.keys, lhs.keys, min_fill);
+    detail::move_append(rhs.values, lhs.values, min_fill);
+    rhs.prev = node;
+    rhs.next = lhs.next;
+    if(lhs.next == npos) {
+        last_leaf_ = right;
+    }
+    else {
+        leaves_[lhs.next].prev = right;
+    }
+    lhs.next = right;
+    return right;
+}
+
+/* Inserts the separator and the new child following it into the parent of the split node. Full parents are split
+ * in turn, handing their middle key up, and a split root gets a new root above it */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::insert_separator(path_type const& path, key_type separator,
+                                                                          index_type child) noexcept(nothrow_move_v) {
+    for(auto level = height_; level--;) {
+        auto const [node, i] = path[level];
+        auto& parent = inners_[node];
+        if(parent.keys.size() < B) {
+            detail::shift_insert(parent.keys, i, std::move(separator));
+            detail::shift_insert(parent.children, i + 1, child);
+            return;
+        }
+
+        statvec<Key, B + 1u> keys{};
+        statvec<index_type, B + 2u> children{};
+        for(size_type k = 0u; k < B; k++) {
+            if(k == i) {
+                keys.push_back(std::move(separator));
+            }
+            keys.push_back(std::move(parent.keys[k]));
+        }
+        if(i == B) {
+            keys.push_back(std::move(separator));
+        }
+        for(size_type k = 0u; k <= B; k++) {
+            children.push_back(parent.children[k]);
+            if(k == i) {
+                children.push_back(child);
+            }
+        }
+
+        auto const right = allocate_inner();
+        auto& rhs = inners_[right];
+        auto const mid = (B + 1u) / 2u;
+        parent.keys.clear();
+        parent.children.clear();
+        for(size_type k = 0u; k < mid; k++) {
+            parent.keys.push_back(std::move(keys[k]));
+            parent.children.push_back(children[k]);
+        }
+        parent.children.push_back(children[mid]);
+        for(size_type k = mid + 1u; k <= B; k++) {
+            rhs.keys.push_back(std::move(keys[k]));
+            rhs.children.push_back(children[k]);
+        }
+        rhs.children.push_back(children[B + 1u]);
+        separator = std::move(keys[mid]);
+        child = right;
+    }
+
+    auto const root = allocate_inner();
+    inners_[root].keys.push_back(std::move(separator));
+    inners_[root].children.push_back(root_);
+    inners_[root].children.push_back(child);
+    root_ = root;
+    ++height_;
+}
+
+/* Smallest key below node, which sits height levels above the leaves */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr typename static_btree_map<Key, T, N, Compare, B>::key_type const&
+static_btree_map<Key, T, N, Compare, B>::min_key(index_type node, size_type height) const noexcept {
+    for(; height; --height) {
+        node = inners_[node].children[0];
+    }
+    return leaves_[node].keys[0];
+}
+
+/* Builds the inner levels over the leaves laid out in order by assign_sorted. Each level is allocated in order as
+ * well, so a level is a contiguous range of nodes, and its children are spread evenly over as few nodes as fit */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::build_inner_levels() noexcept(nothrow_move_v) {
+    index_type first = 0u;
+    size_type count = used_leaves_;
+    while(count > 1u) {
+        auto const level_first = used_inners_;
+        auto const nodes = (count + B) / (B + 1u);
+        for(size_type n = 0u, child = first; n < nodes; n++) {
+            auto& inner = inners_[allocate_inner()];
+            auto const take = count / nodes + (n < count % nodes);
+            for(size_type c = 0u; c < take; c++, child++) {
+                if(c) {
+                    inner.keys.push_back(min_key(static_cast<index_type>(child), height_));
+                }
+                inner.children.push_back(static_cast<index_type>(child));
+            }
+        }
+        first = level_first;
+        count = nodes;
+        ++height_;
+    }
+    root_ = first;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::erase_at(path_type const& path, index_type leaf, index_type pos) noexcept(nothrow_move_v) {
+    auto& node = leaves_[leaf];
+    detail::shift_erase(node.keys, pos);
+    detail::shift_erase(node.values, pos);
+    --size_;
+    if(height_ && node.keys.size() < min_fill) {
+        rebalance_leaf(path, leaf);
+    }
+}
+
+/* Refills a leaf left less than half full by borrowing an element from a sibling, or merges it with one. Separators
+ * only need to order the subtrees, so they are updated on borrowing but left alone on plain erasure */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::rebalance_leaf(path_type const& path, index_type leaf) noexcept(nothrow_move_v) {
+    auto const [parent_node, i] = path[height_ - 1u];
+    auto& parent = inners_[parent_node];
+    auto& node = leaves_[leaf];
+    if(i) {
+        auto& left = leaves_[parent.children[i - 1u]];
+        if(left.keys.size() > min_fill) {
+            detail::shift_insert(node.keys, 0u, std::move(left.keys.back()));
+            detail::shift_insert(node.values, 0u, std::move(left.values.back()));
+            left.keys.resize(left.keys.size() - 1u);
+            left.values.resize(left.values.size() - 1u);
+            parent.keys[i - 1u] = node.keys.front();
+            return;
+        }
+    }
+    if(i + 1u < parent.children.size()) {
+        auto& right = leaves_[parent.children[i + 1u]];
+        if(right.keys.size() > min_fill) {
+            node.keys.push_back(std::move(right.keys.front()));
+            node.values.push_back(std::move(right.values.front()));
+            detail::shift_erase(right.keys, 0u);
+            detail::shift_erase(right.values, 0u);
+            parent.keys[i] = right.keys.front();
+            return;
+        }
+    }
+
+    /* Merge the right one of the pair into the left one */
+    auto const k = i ? i - 1u : i;
+    auto const lhs = parent.children[k];
+    auto const rhs = parent.children[k + 1u];
+    detail::move_append(leaves_[lhs].keys, leaves_[rhs].keys, 0u);
+    detail::move_append(leaves_[lhs].values, leaves_[rhs].values, 0u);
+    leaves_[lhs].next = leaves_[rhs].next;
+    if(leaves_[rhs].next == npos) {
+        last_leaf_ = lhs;
+    }
+    else {
+        leaves_[leaves_[rhs].next].prev = lhs;
+    }
+    free_leaf(rhs);
+    detail::shift_erase(parent.keys, k);
+    detail::shift_erase(parent.children, k + 1);
+    rebalance_inner(path, height_ - 1u);
+}
+
+/* Refills an inner node left less than half full by rotating a child through the parent from a sibling, or merges
+ * it with one around their separator, going up as long as merges leave parents underfull. A root left with a single
+ * child is replaced by that child */
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr void static_btree_map<Key, T, N, Compare, B>::rebalance_inner(path_type const& path, size_type level) noexcept(nothrow_move_v) {
+    for(;; --level) {
+        auto const node_index = path[level].node;
+        auto& node = inners_[node_index];
+        if(!level) {
+            if(node.keys.empty()) {
+                root_ = node.children.front();
+                free_inner(node_index);
+                --height_;
+            }
+            return;
+        }
+        if(node.keys.size() >= min_fill) {
+            return;
+        }
+
+        auto const [parent_node, i] = path[level - 1u];
+        auto& parent = inners_[parent_node];
+        if(i) {
+            auto& left = inners_[parent.children[i - 1u]];
+            if(left.keys.size() > min_fill) {
+                detail::shift_insert(node.keys, 0u, std::move(parent.keys[i - 1u]));
+                detail::shift_insert(node.children, 0u, left.children.back());
+                parent.keys[i - 1u] = std::move(left.keys.back());
+                left.keys.resize(left.keys.size() - 1u);
+                left.children.resize(left.children.size() - 1u);
+                return;
+            }
+        }
+        if(i + 1u < parent.children.size()) {
+            auto& right = inners_[parent.children[i + 1u]];
+            if(right.keys.size() > min_fill) {
+                node.keys.push_back(std::move(parent.keys[i]));
+                node.children.push_back(right.children.front());
+                parent.keys[i] = std::move(right.keys.front());
+                detail::shift_erase(right.keys, 0u);
+                detail::shift_erase(right.children, 0u);
+                return;
+            }
+        }
+
+        auto const k = i ? i - 1u : i;
+        auto& lhs = inners_[parent.children[k]];
+        auto const rhs = parent.children[k + 1u];
+        lhs.keys.push_back(std::move(parent.keys[k]));
+        detail::move_append(lhs.keys, inners_[rhs].keys, 0u);
+        detail::move_append(lhs.children, inners_[rhs].children, 0u);
+        free_inner(rhs);
+        detail::shift_erase(parent.keys, k);
+        detail::shift_erase(parent.children, k + 1);
+    }
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool operator==(static_btree_map<Key, T, N, Compare, B> const& lhs, static_btree_map<Key, T, N, Compare, B> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r) {
+        if(l->first != r->first || l->second != r->second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare, std::size_t B>
+constexpr bool operator!=(static_btree_map<Key, T, N, Compare, B> const& lhs, static_btree_map<Key, T, N, Compare, B> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* STATIC_BTREE_MAP_H */
@@ -0,0 +1,567 @@
+#ifndef STATIC_DEQUE_H
+#define STATIC_DEQUE_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class static_deque;
+
+namespace detail {
+
+template <typename Value, std::size_t N>
+class ring_iterator {
+    public:
+        using value_type        = std::remove_cv_t<Value>;
+        using reference         = Value&;
+        using pointer           = Value*;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr ring_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Value> && !std::is_same_v<U, Value>>>
+        constexpr ring_iterator(ring_iterator<U, N> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        constexpr ring_iterator& operator++() noexcept;
+        constexpr ring_iterator operator++(int) noexcept;
+
+        constexpr ring_iterator& operator--() noexcept;
+        constexpr ring_iterator operator--(int) noexcept;
+
+        constexpr ring_iterator& operator+=(difference_type n) noexcept;
+        constexpr ring_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U, std::size_t M>
+        friend constexpr bool operator==(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator!=(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator<=(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator>=(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator<(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator>(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+
+        template <typename U, std::size_t M>
+        friend constexpr ring_iterator<U, M> operator+(ring_iterator<U, M> const& it, typename ring_iterator<U, M>::difference_type n) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr ring_iterator<U, M> operator+(typename ring_iterator<U, M>::difference_type n, ring_iterator<U, M> const& it) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr ring_iterator<U, M> operator-(ring_iterator<U, M> const& it, typename ring_iterator<U, M>::difference_type n) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr typename ring_iterator<U, M>::difference_type operator-(ring_iterator<U, M> const& lhs, ring_iterator<U, M> const& rhs) noexcept;
+
+    private:
+        Value* buf_{};
+        std::size_t head_{};
+        difference_type index_{};
+
+        constexpr ring_iterator(Value* buf, std::size_t head, difference_type index) noexcept;
+
+        template <typename, std::size_t>
+        friend class ring_iterator;
+        template <typename, std::size_t>
+        friend class ::static_deque;
+};
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+class static_deque {
+    static_assert(!std::is_reference_v<T>);
+    static_assert(N);
+
+    public:
+        using value_type             = T;
+        using reference              = T&;
+        using const_reference        = T const&;
+        using pointer                = T*;
+        using const_pointer          = T const*;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = detail::ring_iterator<T, N>;
+        using const_iterator         = detail::ring_iterator<T const, N>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr static_deque() noexcept = default;
+
+        template <typename T0, typename... T1toN, typename = std::enable_if_t<!std::is_same_v<detail::remove_cvref_t<T0>, static_deque>>>
+        constexpr static_deque(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                    (std::is_nothrow_constructible_v<T, T1toN&&> && ...));
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr bool is_contiguous() const noexcept;
+        constexpr pointer as_contiguous() noexcept(std::is_nothrow_swappable_v<T>);
+
+        constexpr void swap(static_deque& other) noexcept(std::is_nothrow_swappable_v<T>);
+        constexpr void clear() noexcept;
+
+        constexpr bool push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr bool push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        template <typename... Ts>
+        constexpr bool emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                           std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr bool emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                            std::is_nothrow_move_assignable_v<T>);
+
+        constexpr T pop_back() noexcept(std::is_nothrow_move_constructible_v<T>);
+        constexpr T pop_front() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<T, N> buf_{};
+        size_type head_{};
+        size_type size_{};
+
+        static constexpr size_type wrap(size_type i) noexcept;
+};
+
+template <typename T0, typename... T1toN>
+static_deque(T0, T1toN...) -> static_deque<T0, sizeof...(T1toN) + 1>;
+
+template <typename T, std::size_t N>
+template <typename T0, typename... T1toN, typename>
+constexpr static_deque<T, N>::static_deque(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                                (std::is_nothrow_constructible_v<T, T1toN&&> && ...))
+    : buf_{std::forward<T0>(first), std::forward<T1toN>(rest)...},
+      size_{sizeof...(rest) + 1u}
+{
+    static_assert(sizeof...(rest) + 1u <= N);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reference static_deque<T, N>::operator[](size_type i) noexcept {
+    return buf_[wrap(head_ + i)];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reference static_deque<T, N>::operator[](size_type i) const noexcept {
+    return buf_[wrap(head_ + i)];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reference static_deque<T, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reference static_deque<T, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reference static_deque<T, N>::front() noexcept {
+    return buf_[head_];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reference static_deque<T, N>::front() const noexcept {
+    return buf_[head_];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reference static_deque<T, N>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reference static_deque<T, N>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::size_type static_deque<T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::size_type static_deque<T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::size_type static_deque<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::is_contiguous() const noexcept {
+    return head_ + size_ <= N;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::pointer static_deque<T, N>::as_contiguous() noexcept(std::is_nothrow_swappable_v<T>) {
+    if(!is_contiguous()) {
+        std::rotate(std::begin(buf_), std::begin(buf_) + head_, std::end(buf_));
+        head_ = 0u;
+    }
+    return buf_.data() + head_;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_deque<T, N>::swap(static_deque& other) noexcept(std::is_nothrow_swappable_v<T>) {
+    buf_.swap(other.buf_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+}
+
+template <typename T, std::size_t N>
+constexpr void static_deque<T, N>::clear() noexcept {
+    head_ = 0u;
+    size_ = 0u;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    buf_[wrap(head_ + size_++)] = value;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    buf_[wrap(head_ + size_++)] = std::move(value);
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    head_ = wrap(head_ + N - 1u);
+    buf_[head_] = value;
+    ++size_;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_deque<T, N>::push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    head_ = wrap(head_ + N - 1u);
+    buf_[head_] = std::move(value);
+    ++size_;
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_deque<T, N>::emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                       std::is_nothrow_move_assignable_v<T>)
+{
+    return push_back(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_deque<T, N>::emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                        std::is_nothrow_move_assignable_v<T>)
+{
+    return push_front(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr T static_deque<T, N>::pop_back() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return std::move(buf_[wrap(head_ + --size_)]);
+}
+
+template <typename T, std::size_t N>
+constexpr T static_deque<T, N>::pop_front() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    auto const head = head_;
+    head_ = wrap(head_ + 1u);
+    --size_;
+    return std::move(buf_[head]);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::iterator static_deque<T, N>::begin() noexcept {
+    return iterator{buf_.data(), head_, 0};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::iterator static_deque<T, N>::end() noexcept {
+    return iterator{buf_.data(), head_, static_cast<difference_type>(size_)};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_iterator static_deque<T, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_iterator static_deque<T, N>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_iterator static_deque<T, N>::cbegin() const noexcept {
+    return const_iterator{buf_.data(), head_, 0};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_iterator static_deque<T, N>::cend() const noexcept {
+    return const_iterator{buf_.data(), head_, static_cast<difference_type>(size_)};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reverse_iterator static_deque<T, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::reverse_iterator static_deque<T, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reverse_iterator static_deque<T, N>::rbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reverse_iterator static_deque<T, N>::rend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reverse_iterator static_deque<T, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::const_reverse_iterator static_deque<T, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_deque<T, N>::size_type static_deque<T, N>::wrap(size_type i) noexcept {
+    return i >= N ? i - N : i;
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator==(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator!=(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<=(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>=(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>(static_deque<T, N> const& lhs, static_deque<T, M> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+namespace detail {
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N>::ring_iterator(V* buf, std::size_t head, difference_type index) noexcept
+    : buf_{buf}, head_{head}, index_{index} { }
+
+template <typename V, std::size_t N>
+template <typename U, typename>
+constexpr ring_iterator<V, N>::ring_iterator(ring_iterator<U, N> const& other) noexcept
+    : buf_{other.buf_}, head_{other.head_}, index_{other.index_} { }
+
+template <typename V, std::size_t N>
+constexpr typename ring_iterator<V, N>::reference ring_iterator<V, N>::operator*() const noexcept {
+    return (*this)[0];
+}
+
+template <typename V, std::size_t N>
+constexpr typename ring_iterator<V, N>::reference ring_iterator<V, N>::operator[](difference_type i) const noexcept {
+    auto const pos = head_ + static_cast<std::size_t>(index_ + i);
+    return buf_[pos >= N ? pos - N : pos];
+}
+
+template <typename V, std::size_t N>
+constexpr typename ring_iterator<V, N>::pointer ring_iterator<V, N>::operator->() const noexcept {
+    return &**this;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N>& ring_iterator<V, N>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N> ring_iterator<V, N>::operator++(int) noexcept {
+    auto it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N>& ring_iterator<V, N>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N> ring_iterator<V, N>::operator--(int) noexcept {
+    auto it = *this;
+    --index_;
+    return it;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N>& ring_iterator<V, N>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N>& ring_iterator<V, N>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator==(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator!=(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator<=(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator>=(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator<(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return !(lhs >= rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator>(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return !(lhs <= rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N> operator+(ring_iterator<V, N> const& it, typename ring_iterator<V, N>::difference_type n) noexcept {
+    return ring_iterator<V, N>{it.buf_, it.head_, it.index_ + n};
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N> operator+(typename ring_iterator<V, N>::difference_type n, ring_iterator<V, N> const& it) noexcept {
+    return it + n;
+}
+
+template <typename V, std::size_t N>
+constexpr ring_iterator<V, N> operator-(ring_iterator<V, N> const& it, typename ring_iterator<V, N>::difference_type n) noexcept {
+    return it + -n;
+}
+
+template <typename V, std::size_t N>
+constexpr typename ring_iterator<V, N>::difference_type operator-(ring_iterator<V, N> const& lhs, ring_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+#endif /* STATIC_DEQUE_H */
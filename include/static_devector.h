@@ -0,0 +1,675 @@
+#ifndef STATIC_DEVECTOR_H
+#define STATIC_DEVECTOR_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class static_devector {
+    static_assert(!std::is_reference_v<T>);
+    static_assert(N);
+
+    template <typename U>
+    using remove_cvref_t = detail::remove_cvref_t<U>;
+    template <typename U>
+    using enable_if_input_iterator_t = detail::enable_if_input_iterator_t<U>;
+
+    public:
+        using value_type             = typename std::array<T, N>::value_type;
+        using reference              = typename std::array<T, N>::reference;
+        using const_reference        = typename std::array<T, N>::const_reference;
+        using pointer                = typename std::array<T, N>::pointer;
+        using const_pointer          = typename std::array<T, N>::const_pointer;
+        using size_type              = typename std::array<T, N>::size_type;
+
+        using iterator               = detail::iterator<static_devector<T, N>>;
+        using const_iterator         = detail::const_iterator<static_devector<T, N>>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr static_devector() noexcept = default;
+
+        template <typename T0, typename... T1toN, typename = std::enable_if_t<!std::is_same_v<remove_cvref_t<T0>, static_devector> &&
+                                                                              !detail::is_std_array_v<remove_cvref_t<T0>>>>
+        constexpr static_devector(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                       (std::is_nothrow_constructible_v<T, T1toN&&> && ...));
+        template <std::size_t M>
+        constexpr static_devector(std::array<T, M> const& array) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        template <std::size_t M>
+        constexpr static_devector(std::array<T, M>&& array) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr bool assign(size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                        std::is_nothrow_move_assignable_v<T>);
+        template <typename It, typename = enable_if_input_iterator_t<remove_cvref_t<It>>>
+        constexpr bool assign(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                          std::is_nothrow_move_assignable_v<T>);
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr pointer data() noexcept;
+        constexpr const_pointer data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr size_type front_headroom() const noexcept;
+        constexpr size_type back_headroom() const noexcept;
+        constexpr bool set_front_headroom(size_type headroom) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr void recenter() noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr void swap(static_devector& other) noexcept(std::is_nothrow_swappable_v<T>);
+
+        template <std::size_t M>
+        [[nodiscard]] constexpr static_devector<T, M> reserve() const & noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                 std::is_nothrow_move_assignable_v<T>);
+        template <std::size_t M>
+        [[nodiscard]] constexpr static_devector<T, M> reserve() && noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr iterator insert(const_iterator pos, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                               std::is_nothrow_move_assignable_v<T>);
+        constexpr iterator insert(const_iterator pos, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr iterator insert(const_iterator pos, size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                                std::is_nothrow_move_assignable_v<T>);
+        template <typename It, typename = enable_if_input_iterator_t<remove_cvref_t<It>>>
+        constexpr iterator insert(const_iterator pos, It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                                                  std::is_nothrow_move_assignable_v<T>);
+
+        template <typename... Ts>
+        constexpr iterator emplace(const_iterator pos, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                              std::is_nothrow_move_assignable_v<T>);
+
+        constexpr bool push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                          std::is_nothrow_move_assignable_v<T>);
+        constexpr bool push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr bool push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                           std::is_nothrow_move_assignable_v<T>);
+        constexpr bool push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        template <typename... Ts>
+        constexpr bool emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                           std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr bool emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                            std::is_nothrow_move_assignable_v<T>);
+
+        constexpr T pop_back() noexcept(std::is_nothrow_move_constructible_v<T>);
+        constexpr T pop_front() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        constexpr iterator erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<T, N> buf_{};
+        size_type off_{N / 2u};
+        size_type size_{};
+
+        constexpr void relocate(size_type off, size_type pos, size_type gap) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr size_type open_gap(size_type pos, size_type count) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr void close_gap(size_type pos, size_type count) noexcept(std::is_nothrow_move_assignable_v<T>);
+};
+
+template <typename T0, typename... T1toN>
+static_devector(T0, T1toN...) -> static_devector<T0, sizeof...(T1toN) + 1>;
+
+template <typename T, std::size_t N>
+static_devector(std::array<T, N> const&) -> static_devector<T, N>;
+
+template <typename T, std::size_t N>
+static_devector(std::array<T, N>&&) -> static_devector<T, N>;
+
+template <typename T, std::size_t N>
+template <typename T0, typename... T1toN, typename>
+constexpr static_devector<T, N>::static_devector(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                                      (std::is_nothrow_constructible_v<T, T1toN&&> && ...))
+    : buf_{std::forward<T0>(first), std::forward<T1toN>(rest)...},
+      off_{0u},
+      size_{sizeof...(rest) + 1u}
+{
+    static_assert(sizeof...(rest) + 1u <= N);
+}
+
+template <typename T, std::size_t N>
+template <std::size_t M>
+constexpr static_devector<T, N>::static_devector(std::array<T, M> const& array) noexcept(std::is_nothrow_copy_assignable_v<T>)
+    : off_{0u},
+      size_{M}
+{
+    static_assert(M <= N);
+    std::copy(std::begin(array), std::end(array), std::begin(buf_));
+}
+
+template <typename T, std::size_t N>
+template <std::size_t M>
+constexpr static_devector<T, N>::static_devector(std::array<T, M>&& array) noexcept(std::is_nothrow_move_assignable_v<T>)
+    : off_{0u},
+      size_{M}
+{
+    static_assert(M <= N);
+    std::move(std::begin(array), std::end(array), std::begin(buf_));
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::assign(size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                      std::is_nothrow_move_assignable_v<T>)
+{
+    auto const size = std::min(count, capacity());
+    off_ = std::min(off_, capacity() - size);
+    std::fill_n(std::begin(buf_) + off_, size, value);
+    size_ = size;
+    return count <= capacity();
+}
+
+template <typename T, std::size_t N>
+template <typename It, typename>
+constexpr bool static_devector<T, N>::assign(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                                         std::is_nothrow_move_assignable_v<T>)
+{
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type const diff = std::distance(first, last);
+        auto const size = std::min(diff, capacity());
+        off_ = std::min(off_, capacity() - size);
+        for(size_ = 0u; size_ < size; ++size_) {
+            buf_[off_ + size_] = *first++;
+        }
+        return diff <= capacity();
+    }
+    else {
+        /* The count is unknown up front, so fill from the start of the buffer and stop at capacity */
+        off_ = 0u;
+        for(size_ = 0u; size_ < capacity() && first != last; ++first) {
+            buf_[size_++] = *first;
+        }
+        return first == last;
+    }
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reference static_devector<T, N>::operator[](size_type i) noexcept {
+    return buf_[off_ + i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reference static_devector<T, N>::operator[](size_type i) const noexcept {
+    return buf_[off_ + i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reference static_devector<T, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reference static_devector<T, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reference static_devector<T, N>::front() noexcept {
+    return buf_[off_];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reference static_devector<T, N>::front() const noexcept {
+    return buf_[off_];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reference static_devector<T, N>::back() noexcept {
+    return buf_[off_ + size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reference static_devector<T, N>::back() const noexcept {
+    return buf_[off_ + size_ - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::pointer static_devector<T, N>::data() noexcept {
+    return buf_.data() + off_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_pointer static_devector<T, N>::data() const noexcept {
+    return buf_.data() + off_;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type static_devector<T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type static_devector<T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type static_devector<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type static_devector<T, N>::front_headroom() const noexcept {
+    return off_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type static_devector<T, N>::back_headroom() const noexcept {
+    return capacity() - off_ - size_;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::set_front_headroom(size_type headroom) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(headroom + size_ > capacity()) {
+        return false;
+    }
+    relocate(headroom, size_, 0u);
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_devector<T, N>::recenter() noexcept(std::is_nothrow_move_assignable_v<T>) {
+    relocate((capacity() - size_) / 2u, size_, 0u);
+}
+
+template <typename T, std::size_t N>
+constexpr void static_devector<T, N>::swap(static_devector& other) noexcept(std::is_nothrow_swappable_v<T>) {
+    buf_.swap(other.buf_);
+    std::swap(off_, other.off_);
+    std::swap(size_, other.size_);
+}
+
+/* The elements start at the middle of the new buffer, or end flush with it if they fill more than half of it */
+template <typename T, std::size_t N>
+template <std::size_t M>
+[[nodiscard]] constexpr static_devector<T, M> static_devector<T, N>::reserve() const & noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                               std::is_nothrow_move_assignable_v<T>)
+{
+    static_devector<T, M> vec{};
+    vec.assign(data(), data() + std::min(size(), M));
+    return vec;
+}
+
+template <typename T, std::size_t N>
+template <std::size_t M>
+[[nodiscard]] constexpr static_devector<T, M> static_devector<T, N>::reserve() && noexcept(std::is_nothrow_move_assignable_v<T>) {
+    static_devector<T, M> vec{};
+    vec.assign(std::make_move_iterator(data()), std::make_move_iterator(data() + std::min(size(), M)));
+    return vec;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_devector<T, N>::clear() noexcept {
+    size_ = 0u;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::resize(size_type size) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const fits = size <= capacity();
+    size = std::min(size, capacity());
+    if(off_ + size > capacity()) {
+        relocate(capacity() - size, size_, 0u);
+    }
+    size_ = size;
+    return fits;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::insert(const_iterator pos, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                           std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(pos, 1u, value);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::insert(const_iterator pos, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(size() == capacity()) {
+        return end();
+    }
+    auto const i = open_gap(std::distance(cbegin(), pos), 1u);
+    buf_[i] = std::move(value);
+    return begin() + (i - off_);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::insert(const_iterator pos, size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                            std::is_nothrow_move_assignable_v<T>)
+{
+    if(size() + count > capacity()) {
+        return end();
+    }
+    auto const i = open_gap(std::distance(cbegin(), pos), count);
+    std::fill_n(std::begin(buf_) + i, count, value);
+    return begin() + (i - off_);
+}
+
+template <typename T, std::size_t N>
+template <typename It, typename>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::insert(const_iterator pos, It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)> &&
+                                                                              std::is_nothrow_move_assignable_v<T>)
+{
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type const count = std::distance(first, last);
+        if(size() + count > capacity()) {
+            return end();
+        }
+        auto const i = open_gap(std::distance(cbegin(), pos), count);
+        std::copy(first, last, std::begin(buf_) + i);
+        return begin() + (i - off_);
+    }
+    else {
+        /* Appends in a single pass and rotates the new elements into place, dropping them again if they do not fit */
+        size_type const i = std::distance(cbegin(), pos);
+        auto const size = size_;
+        for(; first != last; ++first) {
+            if(size_ == capacity()) {
+                size_ = size;
+                return end();
+            }
+            buf_[open_gap(size_, 1u)] = *first;
+        }
+        std::rotate(data() + i, data() + size, data() + size_);
+        return begin() + i;
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::emplace(const_iterator pos, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                          std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(pos, T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                         std::is_nothrow_move_assignable_v<T>)
+{
+    if(size() == capacity()) {
+        return false;
+    }
+    buf_[open_gap(size_, 1u)] = value;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(size() == capacity()) {
+        return false;
+    }
+    buf_[open_gap(size_, 1u)] = std::move(value);
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                          std::is_nothrow_move_assignable_v<T>)
+{
+    if(size() == capacity()) {
+        return false;
+    }
+    buf_[open_gap(0u, 1u)] = value;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_devector<T, N>::push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(size() == capacity()) {
+        return false;
+    }
+    buf_[open_gap(0u, 1u)] = std::move(value);
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_devector<T, N>::emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                          std::is_nothrow_move_assignable_v<T>)
+{
+    return push_back(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_devector<T, N>::emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                           std::is_nothrow_move_assignable_v<T>)
+{
+    return push_front(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr T static_devector<T, N>::pop_back() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return std::move(buf_[off_ + --size_]);
+}
+
+template <typename T, std::size_t N>
+constexpr T static_devector<T, N>::pop_front() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    --size_;
+    return std::move(buf_[off_++]);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return erase(pos, pos + 1);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator
+static_devector<T, N>::erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    size_type const pos = std::distance(cbegin(), first);
+    close_gap(pos, std::distance(first, last));
+    return begin() + pos;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator static_devector<T, N>::begin() noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::iterator static_devector<T, N>::end() noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_iterator static_devector<T, N>::begin() const noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_iterator static_devector<T, N>::end() const noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_iterator static_devector<T, N>::cbegin() const noexcept {
+    return data();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_iterator static_devector<T, N>::cend() const noexcept {
+    return data() + size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reverse_iterator static_devector<T, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::reverse_iterator static_devector<T, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reverse_iterator static_devector<T, N>::rbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reverse_iterator static_devector<T, N>::rend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reverse_iterator static_devector<T, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::const_reverse_iterator static_devector<T, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+/* Moves the elements so that the first one ends up at off, leaving gap free slots between the elements at index
+ * pos - 1 and pos. The two halves are moved in an order that guarantees no element is overwritten before being
+ * moved itself */
+template <typename T, std::size_t N>
+constexpr void static_devector<T, N>::relocate(size_type off, size_type pos, size_type gap) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const move_block = [this](size_type from, size_type to, size_type count) {
+        auto const first = std::begin(buf_) + from;
+        if(!count) {
+            return;
+        }
+        if(to < from) {
+            std::move(first, first + count, std::begin(buf_) + to);
+        }
+        else if(to > from) {
+            std::move_backward(first, first + count, std::begin(buf_) + to + count);
+        }
+    };
+
+    if(off < off_) {
+        move_block(off_, off, pos);
+        move_block(off_ + pos, off + pos + gap, size_ - pos);
+    }
+    else {
+        move_block(off_ + pos, off + pos + gap, size_ - pos);
+        move_block(off_, off, pos);
+    }
+    off_ = off;
+}
+
+/* Opens a gap of count slots before the element at index pos by moving the shorter of the two halves into the
+ * headroom on its side. If that side lacks the headroom, the elements are re-centered instead, which costs about
+ * the same as shifting the longer half but restores headroom at both ends. The caller must ensure that
+ * size() + count <= capacity(). Returns the index in buf_ of the first slot of the gap */
+template <typename T, std::size_t N>
+constexpr typename static_devector<T, N>::size_type
+static_devector<T, N>::open_gap(size_type pos, size_type count) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(pos < size_ - pos) {
+        relocate(front_headroom() >= count ? off_ - count : (capacity() - size_ - count) / 2u, pos, count);
+    }
+    else {
+        relocate(back_headroom() >= count ? off_ : (capacity() - size_ - count) / 2u, pos, count);
+    }
+    size_ += count;
+    return off_ + pos;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_devector<T, N>::close_gap(size_type pos, size_type count) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const first = std::begin(buf_) + off_;
+    if(pos < size_ - pos - count) {
+        std::move_backward(first, first + pos, first + pos + count);
+        off_ += count;
+    }
+    else {
+        std::move(first + pos + count, first + size_, first + pos);
+    }
+    size_ -= count;
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator==(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator!=(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<=(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>=(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>(static_devector<T, N> const& lhs, static_devector<T, M> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+#endif /* STATIC_DEVECTOR_H */
@@ -0,0 +1,424 @@
+#ifndef STATIC_FLAT_MAP_H
+#define STATIC_FLAT_MAP_H
+
+#include "sorted_statvec.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+
+struct select_first {
+    template <typename T>
+    constexpr typename T::first_type const& operator()(T const& value) const noexcept;
+};
+
+} // namespace detail
+
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+class static_flat_map {
+    using vector_type = statvec<std::pair<Key, T>, N>;
+
+    template <typename U>
+    using enable_if_bidirectional_iterator_t = detail::enable_if_bidirectional_iterator_t<U>;
+
+    public:
+        using key_type               = Key;
+        using mapped_type            = T;
+        using value_type             = std::pair<Key, T>;
+        using key_compare            = Compare;
+        using reference              = value_type&;
+        using const_reference        = value_type const&;
+        using pointer                = value_type*;
+        using const_pointer          = value_type const*;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = typename vector_type::iterator;
+        using const_iterator         = typename vector_type::const_iterator;
+        using reverse_iterator       = typename vector_type::reverse_iterator;
+        using const_reverse_iterator = typename vector_type::const_reverse_iterator;
+
+        constexpr static_flat_map() noexcept = default;
+        explicit constexpr static_flat_map(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr T& at(key_type const& key);
+        constexpr T const& at(key_type const& key) const;
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr key_compare key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr void swap(static_flat_map& other) noexcept(std::is_nothrow_swappable_v<value_type> && std::is_nothrow_swappable_v<Compare>);
+        constexpr void clear() noexcept;
+
+        constexpr iterator lower_bound(key_type const& key) noexcept;
+        constexpr const_iterator lower_bound(key_type const& key) const noexcept;
+        constexpr iterator upper_bound(key_type const& key) noexcept;
+        constexpr const_iterator upper_bound(key_type const& key) const noexcept;
+        constexpr iterator find(key_type const& key) noexcept;
+        constexpr const_iterator find(key_type const& key) const noexcept;
+        constexpr bool contains(key_type const& key) const noexcept;
+        constexpr size_type count(key_type const& key) const noexcept;
+
+        constexpr std::pair<iterator, bool> insert(value_type const& value) noexcept(std::is_nothrow_copy_assignable_v<value_type> &&
+                                                                                     std::is_nothrow_move_assignable_v<value_type>);
+        constexpr std::pair<iterator, bool> insert(value_type&& value) noexcept(std::is_nothrow_move_assignable_v<value_type>);
+        template <typename U>
+        constexpr std::pair<iterator, bool> insert_or_assign(key_type const& key, U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&> &&
+                                                                                                      std::is_nothrow_constructible_v<T, U&&> &&
+                                                                                                      std::is_nothrow_move_assignable_v<value_type>);
+        template <typename... Ts>
+        constexpr std::pair<iterator, bool> try_emplace(key_type const& key, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                                    std::is_nothrow_move_assignable_v<value_type>);
+        template <typename It, typename = enable_if_bidirectional_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool insert_sorted_range(It first, It last) noexcept(std::is_nothrow_assignable_v<value_type, decltype(*first)> &&
+                                                                       std::is_nothrow_move_assignable_v<value_type>);
+
+        constexpr iterator erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<value_type>);
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<value_type>);
+        constexpr size_type erase(key_type const& key) noexcept(std::is_nothrow_move_assignable_v<value_type>);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        vector_type vec_{};
+        Compare comp_{};
+
+        constexpr size_type lower_index(key_type const& key) const noexcept;
+        constexpr size_type find_index(key_type const& key) const noexcept;
+};
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr static_flat_map<Key, T, N, Compare>::static_flat_map(Compare const& comp) noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+    : comp_{comp} { }
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr T& static_flat_map<Key, T, N, Compare>::at(key_type const& key) {
+    auto const i = find_index(key);
+    if(i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return vec_[i].second;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr T const& static_flat_map<Key, T, N, Compare>::at(key_type const& key) const {
+    auto const i = find_index(key);
+    if(i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return vec_[i].second;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr bool static_flat_map<Key, T, N, Compare>::empty() const noexcept {
+    return vec_.empty();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type static_flat_map<Key, T, N, Compare>::size() const noexcept {
+    return vec_.size();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type static_flat_map<Key, T, N, Compare>::max_size() const noexcept {
+    return vec_.max_size();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type static_flat_map<Key, T, N, Compare>::capacity() const noexcept {
+    return vec_.capacity();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::key_compare
+static_flat_map<Key, T, N, Compare>::key_comp() const noexcept(std::is_nothrow_copy_constructible_v<Compare>) {
+    return comp_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr void static_flat_map<Key, T, N, Compare>::swap(static_flat_map& other) noexcept(std::is_nothrow_swappable_v<value_type> &&
+                                                                                         std::is_nothrow_swappable_v<Compare>)
+{
+    using std::swap;
+    vec_.swap(other.vec_);
+    swap(comp_, other.comp_);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr void static_flat_map<Key, T, N, Compare>::clear() noexcept {
+    vec_.clear();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator
+static_flat_map<Key, T, N, Compare>::lower_bound(key_type const& key) noexcept {
+    return begin() + lower_index(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator
+static_flat_map<Key, T, N, Compare>::lower_bound(key_type const& key) const noexcept {
+    return cbegin() + lower_index(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator
+static_flat_map<Key, T, N, Compare>::upper_bound(key_type const& key) noexcept {
+    return begin() + detail::sorted_upper_bound(vec_.data(), vec_.size(), key, comp_, detail::select_first{});
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator
+static_flat_map<Key, T, N, Compare>::upper_bound(key_type const& key) const noexcept {
+    return cbegin() + detail::sorted_upper_bound(vec_.data(), vec_.size(), key, comp_, detail::select_first{});
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator
+static_flat_map<Key, T, N, Compare>::find(key_type const& key) noexcept {
+    return begin() + find_index(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator
+static_flat_map<Key, T, N, Compare>::find(key_type const& key) const noexcept {
+    return cbegin() + find_index(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr bool static_flat_map<Key, T, N, Compare>::contains(key_type const& key) const noexcept {
+    return find_index(key) != size();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type
+static_flat_map<Key, T, N, Compare>::count(key_type const& key) const noexcept {
+    return contains(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr std::pair<typename static_flat_map<Key, T, N, Compare>::iterator, bool>
+static_flat_map<Key, T, N, Compare>::insert(value_type const& value) noexcept(std::is_nothrow_copy_assignable_v<value_type> &&
+                                                                              std::is_nothrow_move_assignable_v<value_type>)
+{
+    return insert(value_type{value});
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr std::pair<typename static_flat_map<Key, T, N, Compare>::iterator, bool>
+static_flat_map<Key, T, N, Compare>::insert(value_type&& value) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+    auto const i = lower_index(value.first);
+    if(i != size() && !comp_(value.first, vec_[i].first)) {
+        return {begin() + i, false};
+    }
+    auto const pos = vec_.insert(cbegin() + i, std::move(value));
+    return {pos, pos != end()};
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+template <typename U>
+constexpr std::pair<typename static_flat_map<Key, T, N, Compare>::iterator, bool>
+static_flat_map<Key, T, N, Compare>::insert_or_assign(key_type const& key, U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&> &&
+                                                                                               std::is_nothrow_constructible_v<T, U&&> &&
+                                                                                               std::is_nothrow_move_assignable_v<value_type>)
+{
+    auto const i = lower_index(key);
+    if(i != size() && !comp_(key, vec_[i].first)) {
+        vec_[i].second = std::forward<U>(value);
+        return {begin() + i, false};
+    }
+    auto const pos = vec_.insert(cbegin() + i, value_type(key, std::forward<U>(value)));
+    return {pos, pos != end()};
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+template <typename... Ts>
+constexpr std::pair<typename static_flat_map<Key, T, N, Compare>::iterator, bool>
+static_flat_map<Key, T, N, Compare>::try_emplace(key_type const& key, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                             std::is_nothrow_move_assignable_v<value_type>)
+{
+    auto const i = lower_index(key);
+    if(i != size() && !comp_(key, vec_[i].first)) {
+        return {begin() + i, false};
+    }
+    auto const pos = vec_.insert(cbegin() + i, value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                                                          std::forward_as_tuple(std::forward<Ts>(args)...)));
+    return {pos, pos != end()};
+}
+
+/* Merges the range of key-value pairs sorted by key in linear time. Pairs whose key is already present are skipped */
+template <typename Key, typename T, std::size_t N, typename Compare>
+template <typename It, typename>
+constexpr bool static_flat_map<Key, T, N, Compare>::insert_sorted_range(It first, It last) noexcept(std::is_nothrow_assignable_v<value_type, decltype(*first)> &&
+                                                                                                 std::is_nothrow_move_assignable_v<value_type>)
+{
+    auto const less = [this](auto const& lhs, auto const& rhs) {
+        return comp_(lhs.first, rhs.first);
+    };
+    return detail::sorted_merge(vec_, first, last, less, true);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator
+static_flat_map<Key, T, N, Compare>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+    return vec_.erase(pos);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator
+static_flat_map<Key, T, N, Compare>::erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+    return vec_.erase(first, last);
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type
+static_flat_map<Key, T, N, Compare>::erase(key_type const& key) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+    auto const i = find_index(key);
+    if(i == size()) {
+        return 0u;
+    }
+    vec_.erase(cbegin() + i);
+    return 1u;
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator static_flat_map<Key, T, N, Compare>::begin() noexcept {
+    return vec_.begin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::iterator static_flat_map<Key, T, N, Compare>::end() noexcept {
+    return vec_.end();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator static_flat_map<Key, T, N, Compare>::begin() const noexcept {
+    return vec_.cbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator static_flat_map<Key, T, N, Compare>::end() const noexcept {
+    return vec_.cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator static_flat_map<Key, T, N, Compare>::cbegin() const noexcept {
+    return vec_.cbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_iterator static_flat_map<Key, T, N, Compare>::cend() const noexcept {
+    return vec_.cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::reverse_iterator static_flat_map<Key, T, N, Compare>::rbegin() noexcept {
+    return vec_.rbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::reverse_iterator static_flat_map<Key, T, N, Compare>::rend() noexcept {
+    return vec_.rend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_reverse_iterator static_flat_map<Key, T, N, Compare>::rbegin() const noexcept {
+    return vec_.crbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_reverse_iterator static_flat_map<Key, T, N, Compare>::rend() const noexcept {
+    return vec_.crend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_reverse_iterator static_flat_map<Key, T, N, Compare>::crbegin() const noexcept {
+    return vec_.crbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::const_reverse_iterator static_flat_map<Key, T, N, Compare>::crend() const noexcept {
+    return vec_.crend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type
+static_flat_map<Key, T, N, Compare>::lower_index(key_type const& key) const noexcept {
+    return detail::sorted_lower_bound(vec_.data(), vec_.size(), key, comp_, detail::select_first{});
+}
+
+template <typename Key, typename T, std::size_t N, typename Compare>
+constexpr typename static_flat_map<Key, T, N, Compare>::size_type
+static_flat_map<Key, T, N, Compare>::find_index(key_type const& key) const noexcept {
+    auto const i = lower_index(key);
+    return i != size() && !comp_(key, vec_[i].first) ? i : size();
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator==(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator!=(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator<=(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator>=(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator<(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename Key, typename T, std::size_t N, std::size_t M, typename Compare>
+constexpr bool operator>(static_flat_map<Key, T, N, Compare> const& lhs, static_flat_map<Key, T, M, Compare> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+namespace detail {
+
+template <typename T>
+constexpr typename T::first_type const& select_first::operator()(T const& value) const noexcept {
+    return value.first;
+}
+
+} // namespace detail
+
+#endif /* STATIC_FLAT_MAP_H */
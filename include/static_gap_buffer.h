@@ -0,0 +1,622 @@
+#ifndef STATIC_GAP_BUFFER_H
+#define STATIC_GAP_BUFFER_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class static_gap_buffer;
+
+namespace detail {
+
+template <typename Value, std::size_t N>
+class gap_iterator {
+    public:
+        using value_type        = std::remove_cv_t<Value>;
+        using reference         = Value&;
+        using pointer           = Value*;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr gap_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Value> && !std::is_same_v<U, Value>>>
+        constexpr gap_iterator(gap_iterator<U, N> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        constexpr gap_iterator& operator++() noexcept;
+        constexpr gap_iterator operator++(int) noexcept;
+
+        constexpr gap_iterator& operator--() noexcept;
+        constexpr gap_iterator operator--(int) noexcept;
+
+        constexpr gap_iterator& operator+=(difference_type n) noexcept;
+        constexpr gap_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U, std::size_t M>
+        friend constexpr bool operator==(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator!=(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator<=(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator>=(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator<(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr bool operator>(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+
+        template <typename U, std::size_t M>
+        friend constexpr gap_iterator<U, M> operator+(gap_iterator<U, M> const& it, typename gap_iterator<U, M>::difference_type n) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr gap_iterator<U, M> operator+(typename gap_iterator<U, M>::difference_type n, gap_iterator<U, M> const& it) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr gap_iterator<U, M> operator-(gap_iterator<U, M> const& it, typename gap_iterator<U, M>::difference_type n) noexcept;
+        template <typename U, std::size_t M>
+        friend constexpr typename gap_iterator<U, M>::difference_type operator-(gap_iterator<U, M> const& lhs, gap_iterator<U, M> const& rhs) noexcept;
+
+    private:
+        Value* buf_{};
+        std::size_t gap_begin_{};
+        std::size_t gap_size_{};
+        difference_type index_{};
+
+        constexpr gap_iterator(Value* buf, std::size_t gap_begin, std::size_t gap_size, difference_type index) noexcept;
+
+        template <typename, std::size_t>
+        friend class gap_iterator;
+        template <typename, std::size_t>
+        friend class ::static_gap_buffer;
+};
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+class static_gap_buffer {
+    static_assert(!std::is_reference_v<T>);
+    static_assert(N);
+
+    public:
+        using value_type             = T;
+        using reference              = T&;
+        using const_reference        = T const&;
+        using pointer                = T*;
+        using const_pointer          = T const*;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = detail::gap_iterator<T, N>;
+        using const_iterator         = detail::gap_iterator<T const, N>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        using span                   = detail::span<T>;
+        using const_span             = detail::span<T const>;
+
+        constexpr static_gap_buffer() noexcept = default;
+
+        template <typename T0, typename... T1toN, typename = std::enable_if_t<!std::is_same_v<detail::remove_cvref_t<T0>, static_gap_buffer>>>
+        constexpr static_gap_buffer(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                         (std::is_nothrow_constructible_v<T, T1toN&&> && ...));
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr size_type cursor() const noexcept;
+        constexpr void move_cursor(size_type pos) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr span before_cursor() noexcept;
+        constexpr const_span before_cursor() const noexcept;
+        constexpr span after_cursor() noexcept;
+        constexpr const_span after_cursor() const noexcept;
+
+        constexpr pointer linearize() noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr void swap(static_gap_buffer& other) noexcept(std::is_nothrow_swappable_v<T>);
+        constexpr void clear() noexcept;
+
+        constexpr bool insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr bool insert(size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool insert(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)>);
+
+        template <typename... Ts>
+        constexpr bool emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                      std::is_nothrow_move_assignable_v<T>);
+
+        constexpr void erase_before(size_type count = 1u) noexcept;
+        constexpr void erase_after(size_type count = 1u) noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<T, N> buf_{};
+        size_type gap_begin_{};
+        size_type gap_end_{N};
+
+        constexpr size_type gap_size() const noexcept;
+        constexpr void shift(size_type first, size_type last, size_type dest) noexcept(std::is_nothrow_move_assignable_v<T>);
+};
+
+template <typename T0, typename... T1toN>
+static_gap_buffer(T0, T1toN...) -> static_gap_buffer<T0, sizeof...(T1toN) + 1>;
+
+template <typename T, std::size_t N>
+template <typename T0, typename... T1toN, typename>
+constexpr static_gap_buffer<T, N>::static_gap_buffer(T0&& first, T1toN&&... rest) noexcept(std::is_nothrow_constructible_v<T, T0&&> &&
+                                                                                          (std::is_nothrow_constructible_v<T, T1toN&&> && ...))
+    : buf_{std::forward<T0>(first), std::forward<T1toN>(rest)...},
+      gap_begin_{sizeof...(rest) + 1u}
+{
+    static_assert(sizeof...(rest) + 1u <= N);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reference static_gap_buffer<T, N>::operator[](size_type i) noexcept {
+    return buf_[i < gap_begin_ ? i : i + gap_size()];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reference static_gap_buffer<T, N>::operator[](size_type i) const noexcept {
+    return buf_[i < gap_begin_ ? i : i + gap_size()];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reference static_gap_buffer<T, N>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reference static_gap_buffer<T, N>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reference static_gap_buffer<T, N>::front() noexcept {
+    return (*this)[0u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reference static_gap_buffer<T, N>::front() const noexcept {
+    return (*this)[0u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reference static_gap_buffer<T, N>::back() noexcept {
+    return (*this)[size() - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reference static_gap_buffer<T, N>::back() const noexcept {
+    return (*this)[size() - 1u];
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_gap_buffer<T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_gap_buffer<T, N>::full() const noexcept {
+    return gap_begin_ == gap_end_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::size_type static_gap_buffer<T, N>::size() const noexcept {
+    return N - gap_size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::size_type static_gap_buffer<T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::size_type static_gap_buffer<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::size_type static_gap_buffer<T, N>::cursor() const noexcept {
+    return gap_begin_;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::move_cursor(size_type pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(pos < gap_begin_) {
+        shift(pos, gap_begin_, gap_end_ - (gap_begin_ - pos));
+        gap_end_ -= gap_begin_ - pos;
+    }
+    else if(pos > gap_begin_) {
+        shift(gap_end_, gap_end_ + (pos - gap_begin_), gap_begin_);
+        gap_end_ += pos - gap_begin_;
+    }
+    gap_begin_ = pos;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::span static_gap_buffer<T, N>::before_cursor() noexcept {
+    return span{buf_.data(), gap_begin_};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_span static_gap_buffer<T, N>::before_cursor() const noexcept {
+    return const_span{buf_.data(), gap_begin_};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::span static_gap_buffer<T, N>::after_cursor() noexcept {
+    return span{buf_.data() + gap_end_, N - gap_end_};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_span static_gap_buffer<T, N>::after_cursor() const noexcept {
+    return const_span{buf_.data() + gap_end_, N - gap_end_};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::pointer static_gap_buffer<T, N>::linearize() noexcept(std::is_nothrow_move_assignable_v<T>) {
+    move_cursor(size());
+    return buf_.data();
+}
+
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::swap(static_gap_buffer& other) noexcept(std::is_nothrow_swappable_v<T>) {
+    buf_.swap(other.buf_);
+    std::swap(gap_begin_, other.gap_begin_);
+    std::swap(gap_end_, other.gap_end_);
+}
+
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::clear() noexcept {
+    gap_begin_ = 0u;
+    gap_end_ = N;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_gap_buffer<T, N>::insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    buf_[gap_begin_++] = value;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_gap_buffer<T, N>::insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(full()) {
+        return false;
+    }
+    buf_[gap_begin_++] = std::move(value);
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_gap_buffer<T, N>::insert(size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(count > gap_size()) {
+        return false;
+    }
+    std::fill_n(std::begin(buf_) + gap_begin_, count, value);
+    gap_begin_ += count;
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename It, typename>
+constexpr bool static_gap_buffer<T, N>::insert(It first, It last) noexcept(std::is_nothrow_assignable_v<T, decltype(*first)>) {
+    size_type const count = std::distance(first, last);
+    if(count > gap_size()) {
+        return false;
+    }
+    std::copy(first, last, std::begin(buf_) + gap_begin_);
+    gap_begin_ += count;
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_gap_buffer<T, N>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                       std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::erase_before(size_type count) noexcept {
+    gap_begin_ -= count;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::erase_after(size_type count) noexcept {
+    gap_end_ += count;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::iterator static_gap_buffer<T, N>::begin() noexcept {
+    return iterator{buf_.data(), gap_begin_, gap_size(), 0};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::iterator static_gap_buffer<T, N>::end() noexcept {
+    return iterator{buf_.data(), gap_begin_, gap_size(), static_cast<difference_type>(size())};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_iterator static_gap_buffer<T, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_iterator static_gap_buffer<T, N>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_iterator static_gap_buffer<T, N>::cbegin() const noexcept {
+    return const_iterator{buf_.data(), gap_begin_, gap_size(), 0};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_iterator static_gap_buffer<T, N>::cend() const noexcept {
+    return const_iterator{buf_.data(), gap_begin_, gap_size(), static_cast<difference_type>(size())};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reverse_iterator static_gap_buffer<T, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::reverse_iterator static_gap_buffer<T, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reverse_iterator static_gap_buffer<T, N>::rbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reverse_iterator static_gap_buffer<T, N>::rend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reverse_iterator static_gap_buffer<T, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::const_reverse_iterator static_gap_buffer<T, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_gap_buffer<T, N>::size_type static_gap_buffer<T, N>::gap_size() const noexcept {
+    return gap_end_ - gap_begin_;
+}
+
+/* Moves the elements in [first, last) to dest, the ranges may overlap. Trivially copyable elements are moved
+ * with a single memmove outside of constant evaluation */
+template <typename T, std::size_t N>
+constexpr void static_gap_buffer<T, N>::shift(size_type first, size_type last, size_type dest) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(dest == first) {
+        return;
+    }
+    if constexpr(std::is_trivially_copyable_v<T>) {
+        if(!__builtin_is_constant_evaluated()) {
+            std::memmove(static_cast<void*>(buf_.data() + dest), buf_.data() + first, (last - first) * sizeof(T));
+            return;
+        }
+    }
+    if(dest < first) {
+        for(auto i = first; i < last; i++) {
+            buf_[dest++] = std::move(buf_[i]);
+        }
+    }
+    else {
+        for(auto i = last; i > first; i--) {
+            buf_[dest + (i - first) - 1u] = std::move(buf_[i - 1u]);
+        }
+    }
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator==(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator!=(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<=(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>=(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator<(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <typename T, std::size_t N, std::size_t M>
+constexpr bool operator>(static_gap_buffer<T, N> const& lhs, static_gap_buffer<T, M> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+namespace detail {
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N>::gap_iterator(V* buf, std::size_t gap_begin, std::size_t gap_size, difference_type index) noexcept
+    : buf_{buf}, gap_begin_{gap_begin}, gap_size_{gap_size}, index_{index} { }
+
+template <typename V, std::size_t N>
+template <typename U, typename>
+constexpr gap_iterator<V, N>::gap_iterator(gap_iterator<U, N> const& other) noexcept
+    : buf_{other.buf_}, gap_begin_{other.gap_begin_}, gap_size_{other.gap_size_}, index_{other.index_} { }
+
+template <typename V, std::size_t N>
+constexpr typename gap_iterator<V, N>::reference gap_iterator<V, N>::operator*() const noexcept {
+    return (*this)[0];
+}
+
+template <typename V, std::size_t N>
+constexpr typename gap_iterator<V, N>::reference gap_iterator<V, N>::operator[](difference_type i) const noexcept {
+    auto const pos = static_cast<std::size_t>(index_ + i);
+    return buf_[pos < gap_begin_ ? pos : pos + gap_size_];
+}
+
+template <typename V, std::size_t N>
+constexpr typename gap_iterator<V, N>::pointer gap_iterator<V, N>::operator->() const noexcept {
+    return &**this;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N>& gap_iterator<V, N>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N> gap_iterator<V, N>::operator++(int) noexcept {
+    auto it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N>& gap_iterator<V, N>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N> gap_iterator<V, N>::operator--(int) noexcept {
+    auto it = *this;
+    --index_;
+    return it;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N>& gap_iterator<V, N>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N>& gap_iterator<V, N>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator==(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator!=(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator<=(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator>=(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator<(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return !(lhs >= rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr bool operator>(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return !(lhs <= rhs);
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N> operator+(gap_iterator<V, N> const& it, typename gap_iterator<V, N>::difference_type n) noexcept {
+    return gap_iterator<V, N>{it.buf_, it.gap_begin_, it.gap_size_, it.index_ + n};
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N> operator+(typename gap_iterator<V, N>::difference_type n, gap_iterator<V, N> const& it) noexcept {
+    return it + n;
+}
+
+template <typename V, std::size_t N>
+constexpr gap_iterator<V, N> operator-(gap_iterator<V, N> const& it, typename gap_iterator<V, N>::difference_type n) noexcept {
+    return it + -n;
+}
+
+template <typename V, std::size_t N>
+constexpr typename gap_iterator<V, N>::difference_type operator-(gap_iterator<V, N> const& lhs, gap_iterator<V, N> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+#endif /* STATIC_GAP_BUFFER_H */
@@ -0,0 +1,699 @@
+#ifndef STATIC_HASH_MAP_H
+#define STATIC_HASH_MAP_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+class basic_static_hash_table;
+
+namespace detail {
+
+/* Control bytes, one per slot. Full slots store the low 7 bits of the hash of their key, all other states have the
+ * sign bit set. The sentinel terminates iteration */
+inline std::int8_t constexpr ctrl_empty = -128;
+inline std::int8_t constexpr ctrl_deleted = -2;
+inline std::int8_t constexpr ctrl_sentinel = -1;
+
+/* Number of control bytes probed at once */
+inline std::size_t constexpr group_width = 16u;
+
+constexpr std::uint32_t group_match(std::int8_t const* group, std::int8_t h2) noexcept;
+constexpr std::uint32_t group_match_empty(std::int8_t const* group) noexcept;
+constexpr std::uint32_t group_match_free(std::int8_t const* group) noexcept;
+
+/* Smallest power of two number of slots, and at least one group, keeping the load factor at or below 7/8 */
+constexpr std::size_t hash_slot_count(std::size_t n) noexcept;
+
+/* Maps hand out their elements as a pair of references, through which the key cannot be modified */
+template <typename Value, bool Map>
+struct hash_reference {
+    using type = Value&;
+    using pointer = Value*;
+};
+
+template <typename Value>
+struct hash_reference<Value, true> {
+    using type = std::pair<typename Value::first_type const&,
+                           std::conditional_t<std::is_const_v<Value>, typename Value::second_type const, typename Value::second_type>&>;
+    using pointer = arrow_proxy<type>;
+};
+
+template <typename Value, bool Map>
+class hash_iterator {
+    public:
+        using value_type        = std::remove_cv_t<Value>;
+        using reference         = typename hash_reference<Value, Map>::type;
+        using pointer           = typename hash_reference<Value, Map>::pointer;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr hash_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Value> && !std::is_same_v<U, Value>>>
+        constexpr hash_iterator(hash_iterator<U, Map> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        constexpr hash_iterator& operator++() noexcept;
+        constexpr hash_iterator operator++(int) noexcept;
+
+        template <typename U, bool M>
+        friend constexpr bool operator==(hash_iterator<U, M> const& lhs, hash_iterator<U, M> const& rhs) noexcept;
+        template <typename U, bool M>
+        friend constexpr bool operator!=(hash_iterator<U, M> const& lhs, hash_iterator<U, M> const& rhs) noexcept;
+
+    private:
+        std::int8_t const* ctrl_{};
+        Value* slot_{};
+
+        constexpr hash_iterator(std::int8_t const* ctrl, Value* slot) noexcept;
+
+        constexpr void skip_free() noexcept;
+
+        template <typename, bool>
+        friend class hash_iterator;
+        template <typename, typename, std::size_t, typename, typename>
+        friend class ::basic_static_hash_table;
+};
+
+} // namespace detail
+
+/* Fixed-capacity open-addressing hash table holding up to N elements, with the control byte layout of Swiss
+ * tables. The slots are grouped by 16, the control bytes of each group being matched against the hash of the key
+ * all at once. A set if Mapped is void, a map otherwise */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+class basic_static_hash_table {
+    static_assert(!std::is_reference_v<Key> && !std::is_reference_v<Mapped>);
+    static_assert(N);
+
+    static bool constexpr is_map = !std::is_void_v<Mapped>;
+
+    template <typename M>
+    using enable_if_map_t = std::enable_if_t<!std::is_void_v<M>>;
+
+    public:
+        using key_type        = Key;
+        using mapped_type     = Mapped;
+        using value_type      = std::conditional_t<is_map, std::pair<Key, Mapped>, Key>;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using iterator        = detail::hash_iterator<std::conditional_t<is_map, value_type, value_type const>, is_map>;
+        using const_iterator  = detail::hash_iterator<value_type const, is_map>;
+        using reference       = typename iterator::reference;
+        using const_reference = typename const_iterator::reference;
+
+        static size_type constexpr slot_count = detail::hash_slot_count(N);
+
+        constexpr basic_static_hash_table() noexcept;
+
+        constexpr iterator find(Key const& key) noexcept;
+        constexpr const_iterator find(Key const& key) const noexcept;
+        constexpr bool contains(Key const& key) const noexcept;
+        constexpr size_type count(Key const& key) const noexcept;
+
+        template <typename M = Mapped, typename = enable_if_map_t<M>>
+        constexpr M& at(Key const& key);
+        template <typename M = Mapped, typename = enable_if_map_t<M>>
+        constexpr M const& at(Key const& key) const;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(basic_static_hash_table& other) noexcept(std::is_nothrow_swappable_v<value_type> &&
+                                                                     std::is_nothrow_swappable_v<Hash> &&
+                                                                     std::is_nothrow_swappable_v<KeyEqual>);
+        constexpr void clear() noexcept;
+
+        constexpr std::pair<iterator, bool> insert(value_type const& value) noexcept(std::is_nothrow_copy_assignable_v<value_type> &&
+                                                                                     std::is_nothrow_swappable_v<value_type>);
+        constexpr std::pair<iterator, bool> insert(value_type&& value) noexcept(std::is_nothrow_move_assignable_v<value_type> &&
+                                                                                std::is_nothrow_swappable_v<value_type>);
+
+        template <typename... Ts, typename M = Mapped, typename = enable_if_map_t<M>>
+        constexpr std::pair<iterator, bool> try_emplace(Key const& key, Ts&&... args) noexcept(std::is_nothrow_constructible_v<M, Ts&&...> &&
+                                                                                               std::is_nothrow_move_assignable_v<M> &&
+                                                                                               std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                               std::is_nothrow_swappable_v<value_type>);
+        template <typename U, typename M = Mapped, typename = enable_if_map_t<M>>
+        constexpr std::pair<iterator, bool> insert_or_assign(Key const& key, U&& value) noexcept(std::is_nothrow_assignable_v<M&, U&&> &&
+                                                                                                 std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                                 std::is_nothrow_swappable_v<value_type>);
+
+        constexpr size_type erase(Key const& key) noexcept;
+        constexpr iterator erase(const_iterator pos) noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        static size_type constexpr group_count = slot_count / detail::group_width;
+
+        alignas(detail::group_width) std::array<std::int8_t, slot_count + 1u> ctrl_;
+        std::array<value_type, slot_count> slots_{};
+        size_type size_{};
+        size_type deleted_{};
+        Hash hash_{};
+        KeyEqual equal_{};
+
+        static constexpr Key const& key_of(value_type const& value) noexcept;
+        template <typename V>
+        static constexpr void assign(value_type& slot, V&& value) noexcept(std::is_nothrow_assignable_v<value_type&, V&&>);
+
+        constexpr std::size_t hash(Key const& key) const noexcept;
+        constexpr size_type find_index(Key const& key, std::size_t hash) const noexcept;
+        constexpr size_type find_free(std::size_t hash) const noexcept;
+        constexpr size_type insert_index(Key const& key, bool& inserted) noexcept(std::is_nothrow_swappable_v<value_type>);
+        constexpr void erase_index(size_type i) noexcept;
+        constexpr void drop_deleted() noexcept(std::is_nothrow_swappable_v<value_type>);
+};
+
+template <typename Key, typename T, std::size_t N, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using static_hash_map = basic_static_hash_table<Key, T, N, Hash, KeyEqual>;
+
+template <typename Key, std::size_t N, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using static_hash_set = basic_static_hash_table<Key, void, N, Hash, KeyEqual>;
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::basic_static_hash_table() noexcept
+    : ctrl_{}
+{
+    clear();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::find(Key const& key) noexcept {
+    auto const i = find_index(key, hash(key));
+    return iterator{ctrl_.data() + i, slots_.data() + i};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::const_iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::find(Key const& key) const noexcept {
+    auto const i = find_index(key, hash(key));
+    return const_iterator{ctrl_.data() + i, slots_.data() + i};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr bool basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::contains(Key const& key) const noexcept {
+    return find_index(key, hash(key)) != slot_count;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::count(Key const& key) const noexcept {
+    return contains(key);
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+template <typename M, typename>
+constexpr M& basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::at(Key const& key) {
+    auto const i = find_index(key, hash(key));
+    if(i == slot_count) {
+        throw std::out_of_range("Key not found");
+    }
+    return slots_[i].second;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+template <typename M, typename>
+constexpr M const& basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::at(Key const& key) const {
+    auto const i = find_index(key, hash(key));
+    if(i == slot_count) {
+        throw std::out_of_range("Key not found");
+    }
+    return slots_[i].second;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr bool basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::empty() const noexcept {
+    return !size();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr bool basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::capacity() const noexcept {
+    return N;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr void basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::swap(basic_static_hash_table& other) noexcept(std::is_nothrow_swappable_v<value_type> &&
+                                                                                                                   std::is_nothrow_swappable_v<Hash> &&
+                                                                                                                   std::is_nothrow_swappable_v<KeyEqual>)
+{
+    using std::swap;
+    ctrl_.swap(other.ctrl_);
+    slots_.swap(other.slots_);
+    swap(size_, other.size_);
+    swap(deleted_, other.deleted_);
+    swap(hash_, other.hash_);
+    swap(equal_, other.equal_);
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr void basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::clear() noexcept {
+    for(size_type i = 0u; i < slot_count; i++) {
+        ctrl_[i] = detail::ctrl_empty;
+    }
+    ctrl_[slot_count] = detail::ctrl_sentinel;
+    size_ = 0u;
+    deleted_ = 0u;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr std::pair<typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator, bool>
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::insert(value_type const& value) noexcept(std::is_nothrow_copy_assignable_v<value_type> &&
+                                                                                                  std::is_nothrow_swappable_v<value_type>)
+{
+    bool inserted = false;
+    auto const i = insert_index(key_of(value), inserted);
+    if(inserted) {
+        assign(slots_[i], value);
+    }
+    return {iterator{ctrl_.data() + i, slots_.data() + i}, inserted};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr std::pair<typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator, bool>
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::insert(value_type&& value) noexcept(std::is_nothrow_move_assignable_v<value_type> &&
+                                                                                             std::is_nothrow_swappable_v<value_type>)
+{
+    bool inserted = false;
+    auto const i = insert_index(key_of(value), inserted);
+    if(inserted) {
+        assign(slots_[i], std::move(value));
+    }
+    return {iterator{ctrl_.data() + i, slots_.data() + i}, inserted};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+template <typename... Ts, typename M, typename>
+constexpr std::pair<typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator, bool>
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::try_emplace(Key const& key, Ts&&... args) noexcept(std::is_nothrow_constructible_v<M, Ts&&...> &&
+                                                                                                         std::is_nothrow_move_assignable_v<M> &&
+                                                                                                         std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                                         std::is_nothrow_swappable_v<value_type>)
+{
+    bool inserted = false;
+    auto const i = insert_index(key, inserted);
+    if(inserted) {
+        slots_[i].first = key;
+        slots_[i].second = M(std::forward<Ts>(args)...);
+    }
+    return {iterator{ctrl_.data() + i, slots_.data() + i}, inserted};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+template <typename U, typename M, typename>
+constexpr std::pair<typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator, bool>
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::insert_or_assign(Key const& key, U&& value) noexcept(std::is_nothrow_assignable_v<M&, U&&> &&
+                                                                                                           std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                                           std::is_nothrow_swappable_v<value_type>)
+{
+    bool inserted = false;
+    auto const i = insert_index(key, inserted);
+    if(inserted) {
+        slots_[i].first = key;
+    }
+    if(i != slot_count) {
+        slots_[i].second = std::forward<U>(value);
+    }
+    return {iterator{ctrl_.data() + i, slots_.data() + i}, inserted};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::erase(Key const& key) noexcept {
+    auto const i = find_index(key, hash(key));
+    if(i == slot_count) {
+        return 0u;
+    }
+    erase_index(i);
+    return 1u;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::erase(const_iterator pos) noexcept {
+    auto const i = static_cast<size_type>(pos.ctrl_ - ctrl_.data());
+    erase_index(i);
+    iterator it{ctrl_.data() + i, slots_.data() + i};
+    it.skip_free();
+    return it;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::begin() noexcept {
+    iterator it{ctrl_.data(), slots_.data()};
+    it.skip_free();
+    return it;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::end() noexcept {
+    return iterator{ctrl_.data() + slot_count, slots_.data() + slot_count};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::const_iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::const_iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::end() const noexcept {
+    return cend();
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::const_iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::cbegin() const noexcept {
+    const_iterator it{ctrl_.data(), slots_.data()};
+    it.skip_free();
+    return it;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::const_iterator
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::cend() const noexcept {
+    return const_iterator{ctrl_.data() + slot_count, slots_.data() + slot_count};
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr Key const& basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::key_of(value_type const& value) noexcept {
+    if constexpr(is_map) {
+        return value.first;
+    }
+    else {
+        return value;
+    }
+}
+
+/* std::pair is not assignable in constant expressions before C++20 */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+template <typename V>
+constexpr void basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::assign(value_type& slot, V&& value) noexcept(std::is_nothrow_assignable_v<value_type&, V&&>) {
+    if constexpr(is_map) {
+        slot.first = std::forward<V>(value).first;
+        slot.second = std::forward<V>(value).second;
+    }
+    else {
+        slot = std::forward<V>(value);
+    }
+}
+
+/* Hashers such as std::hash for integers are often the identity, the multiplication spreads the entropy of the key
+ * over the high bits, which are then folded onto the low ones used for the control bytes */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr std::size_t basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::hash(Key const& key) const noexcept {
+    std::uint64_t const h = static_cast<std::uint64_t>(hash_(key)) * 0x9e3779b97f4a7c15u;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+/* Probes the groups in triangular order, which visits each of them once as their number is a power of two. The
+ * lowest 7 bits of the hash are matched against the control bytes, the remaining ones select the first group.
+ * Returns slot_count if the key is absent */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::find_index(Key const& key, std::size_t hash) const noexcept {
+    auto const h2 = static_cast<std::int8_t>(hash & 0x7fu);
+    auto g = (hash >> 7) & (group_count - 1u);
+    for(size_type step = 0u; step < group_count; g = (g + ++step) & (group_count - 1u)) {
+        auto const group = ctrl_.data() + g * detail::group_width;
+        for(auto mask = detail::group_match(group, h2); mask; mask &= mask - 1u) {
+            auto const i = g * detail::group_width + static_cast<size_type>(__builtin_ctz(mask));
+            if(equal_(key_of(slots_[i]), key)) {
+                return i;
+            }
+        }
+        if(detail::group_match_empty(group)) {
+            break;
+        }
+    }
+    return slot_count;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::find_free(std::size_t hash) const noexcept {
+    auto g = (hash >> 7) & (group_count - 1u);
+    for(size_type step = 0u;; g = (g + ++step) & (group_count - 1u)) {
+        if(auto const mask = detail::group_match_free(ctrl_.data() + g * detail::group_width)) {
+            return g * detail::group_width + static_cast<size_type>(__builtin_ctz(mask));
+        }
+    }
+}
+
+/* Returns the index of the slot holding key, claiming a free one if absent, or slot_count if the table is full. The
+ * sum of full and deleted slots never exceeds N, deleted slots are purged once it would, so that the probing of
+ * absent keys always ends at an empty slot */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr typename basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::size_type
+basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::insert_index(Key const& key, bool& inserted) noexcept(std::is_nothrow_swappable_v<value_type>) {
+    auto const h = hash(key);
+    if(auto const i = find_index(key, h); i != slot_count || full()) {
+        inserted = false;
+        return i;
+    }
+    if(size_ + deleted_ == N) {
+        drop_deleted();
+    }
+    auto const i = find_free(h);
+    deleted_ -= ctrl_[i] == detail::ctrl_deleted;
+    ctrl_[i] = static_cast<std::int8_t>(h & 0x7fu);
+    ++size_;
+    inserted = true;
+    return i;
+}
+
+/* A probe only moves on from a group without any empty slot. If the group of the erased slot has one, no probe can
+ * have passed through it, and the slot may be marked empty rather than deleted */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr void basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::erase_index(size_type i) noexcept {
+    auto const group = ctrl_.data() + i / detail::group_width * detail::group_width;
+    if(detail::group_match_empty(group)) {
+        ctrl_[i] = detail::ctrl_empty;
+    }
+    else {
+        ctrl_[i] = detail::ctrl_deleted;
+        ++deleted_;
+    }
+    --size_;
+}
+
+/* Rehashes in place to turn all deleted slots back into empty ones. Full slots are first marked deleted, each is
+ * then moved to the first free slot of its probe sequence, swapping with a not yet placed element if that one is
+ * marked deleted. Elements whose first free slot lies in their current group stay in place */
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr void basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual>::drop_deleted() noexcept(std::is_nothrow_swappable_v<value_type>) {
+    for(size_type i = 0u; i < slot_count; i++) {
+        ctrl_[i] = ctrl_[i] >= 0 ? detail::ctrl_deleted : detail::ctrl_empty;
+    }
+    for(size_type i = 0u; i < slot_count; i++) {
+        if(ctrl_[i] != detail::ctrl_deleted) {
+            continue;
+        }
+        auto const h = hash(key_of(slots_[i]));
+        auto const h2 = static_cast<std::int8_t>(h & 0x7fu);
+        auto const j = find_free(h);
+        if(j / detail::group_width == i / detail::group_width) {
+            ctrl_[i] = h2;
+        }
+        else if(ctrl_[j] == detail::ctrl_empty) {
+            slots_[j] = std::move(slots_[i]);
+            ctrl_[j] = h2;
+            ctrl_[i] = detail::ctrl_empty;
+        }
+        else {
+            using std::swap;
+            swap(slots_[i], slots_[j]);
+            ctrl_[j] = h2;
+            --i;
+        }
+    }
+    deleted_ = 0u;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr bool operator==(basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual> const& lhs,
+                          basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual> const& rhs) noexcept
+{
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(auto const& value : lhs) {
+        if constexpr(std::is_void_v<Mapped>) {
+            if(!rhs.contains(value)) {
+                return false;
+            }
+        }
+        else {
+            auto const it = rhs.find(value.first);
+            if(it == rhs.end() || !(it->second == value.second)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename Mapped, std::size_t N, typename Hash, typename KeyEqual>
+constexpr bool operator!=(basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual> const& lhs,
+                          basic_static_hash_table<Key, Mapped, N, Hash, KeyEqual> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+namespace detail {
+
+constexpr std::uint32_t group_match(std::int8_t const* group, std::int8_t h2) noexcept {
+#ifdef __SSE2__
+    if(!__builtin_is_constant_evaluated()) {
+        auto const ctrl = _mm_load_si128(reinterpret_cast<__m128i const*>(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+    }
+#endif
+    std::uint32_t mask = 0u;
+    for(std::size_t i = 0u; i < group_width; i++) {
+        mask |= std::uint32_t{group[i] == h2} << i;
+    }
+    return mask;
+}
+
+constexpr std::uint32_t group_match_empty(std::int8_t const* group) noexcept {
+    return group_match(group, ctrl_empty);
+}
+
+/* Empty and deleted slots are the only ones with the sign bit set */
+constexpr std::uint32_t group_match_free(std::int8_t const* group) noexcept {
+#ifdef __SSE2__
+    if(!__builtin_is_constant_evaluated()) {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<__m128i const*>(group))));
+    }
+#endif
+    std::uint32_t mask = 0u;
+    for(std::size_t i = 0u; i < group_width; i++) {
+        mask |= std::uint32_t{group[i] < 0} << i;
+    }
+    return mask;
+}
+
+constexpr std::size_t hash_slot_count(std::size_t n) noexcept {
+    auto const min = std::max(group_width, n + (n + 6u) / 7u);
+    std::size_t count = group_width;
+    while(count < min) {
+        count *= 2u;
+    }
+    return count;
+}
+
+template <typename V, bool M>
+constexpr hash_iterator<V, M>::hash_iterator(std::int8_t const* ctrl, V* slot) noexcept
+    : ctrl_{ctrl}, slot_{slot} { }
+
+template <typename V, bool M>
+template <typename U, typename>
+constexpr hash_iterator<V, M>::hash_iterator(hash_iterator<U, M> const& other) noexcept
+    : ctrl_{other.ctrl_}, slot_{other.slot_} { }
+
+template <typename V, bool M>
+constexpr typename hash_iterator<V, M>::reference hash_iterator<V, M>::operator*() const noexcept {
+    if constexpr(M) {
+        return {slot_->first, slot_->second};
+    }
+    else {
+        return *slot_;
+    }
+}
+
+template <typename V, bool M>
+constexpr typename hash_iterator<V, M>::pointer hash_iterator<V, M>::operator->() const noexcept {
+    if constexpr(M) {
+        return {**this};
+    }
+    else {
+        return slot_;
+    }
+}
+
+template <typename V, bool M>
+constexpr hash_iterator<V, M>& hash_iterator<V, M>::operator++() noexcept {
+    ++ctrl_;
+    ++slot_;
+    skip_free();
+    return *this;
+}
+
+template <typename V, bool M>
+constexpr hash_iterator<V, M> hash_iterator<V, M>::operator++(int) noexcept {
+    auto it = *this;
+    ++*this;
+    return it;
+}
+
+template <typename V, bool M>
+constexpr void hash_iterator<V, M>::skip_free() noexcept {
+    while(*ctrl_ < ctrl_sentinel) {
+        ++ctrl_;
+        ++slot_;
+    }
+}
+
+template <typename V, bool M>
+constexpr bool operator==(hash_iterator<V, M> const& lhs, hash_iterator<V, M> const& rhs) noexcept {
+    return lhs.ctrl_ == rhs.ctrl_;
+}
+
+template <typename V, bool M>
+constexpr bool operator!=(hash_iterator<V, M> const& lhs, hash_iterator<V, M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace detail
+
+#endif /* STATIC_HASH_MAP_H */
@@ -0,0 +1,607 @@
+#ifndef STATIC_JAGGED_H
+#define STATIC_JAGGED_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+class static_jagged;
+
+namespace detail {
+
+/* Random access iterator over the rows of a static_jagged, dereferencing to a span of the row */
+template <typename Container>
+class jagged_iterator {
+    public:
+        using value_type        = std::conditional_t<std::is_const_v<Container>, typename Container::const_row,
+                                                     typename Container::row>;
+        using reference         = value_type;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr jagged_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Container> && !std::is_same_v<U, Container>>>
+        constexpr jagged_iterator(jagged_iterator<U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr jagged_iterator& operator++() noexcept;
+        constexpr jagged_iterator operator++(int) noexcept;
+
+        constexpr jagged_iterator& operator--() noexcept;
+        constexpr jagged_iterator operator--(int) noexcept;
+
+        constexpr jagged_iterator& operator+=(difference_type n) noexcept;
+        constexpr jagged_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U>
+        friend constexpr bool operator==(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator!=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept;
+
+        template <typename U>
+        friend constexpr jagged_iterator<U> operator+(jagged_iterator<U> const& it, typename jagged_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr jagged_iterator<U> operator+(typename jagged_iterator<U>::difference_type n, jagged_iterator<U> const& it) noexcept;
+        template <typename U>
+        friend constexpr jagged_iterator<U> operator-(jagged_iterator<U> const& it, typename jagged_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr typename jagged_iterator<U>::difference_type operator-(jagged_iterator<U> const& lhs,
+                                                                                jagged_iterator<U> const& rhs) noexcept;
+
+    private:
+        Container* container_{};
+        difference_type index_{};
+
+        constexpr jagged_iterator(Container* container, difference_type index) noexcept;
+
+        template <typename>
+        friend class jagged_iterator;
+        template <typename, std::size_t, std::size_t>
+        friend class ::static_jagged;
+};
+
+} // namespace detail
+
+/* Fixed-capacity sequence of up to RowCap rows of varying length, holding up to TotalCap elements between them. The
+ * elements of all rows are stored back to back in one array, with row r spanning [offsets[r], offsets[r + 1]), as in
+ * the compressed sparse row layout. Only the last row can grow, and iterating over all elements is a single pass over
+ * contiguous memory */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+class static_jagged {
+    static_assert(!std::is_reference_v<T>);
+    static_assert(TotalCap && RowCap);
+
+    public:
+        using value_type             = T;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using row                    = detail::span<T>;
+        using const_row              = detail::span<T const>;
+
+        using iterator               = detail::jagged_iterator<static_jagged>;
+        using const_iterator         = detail::jagged_iterator<static_jagged const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr static_jagged() noexcept(std::is_nothrow_default_constructible_v<T>) = default;
+
+        constexpr row operator[](size_type r) noexcept;
+        constexpr const_row operator[](size_type r) const noexcept;
+
+        constexpr row at(size_type r);
+        constexpr const_row at(size_type r) const;
+
+        constexpr row front() noexcept;
+        constexpr const_row front() const noexcept;
+
+        constexpr row back() noexcept;
+        constexpr const_row back() const noexcept;
+
+        constexpr row elements() noexcept;
+        constexpr const_row elements() const noexcept;
+        constexpr detail::span<size_type const> offsets() const noexcept;
+
+        constexpr size_type row_size(size_type r) const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type rows() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+        constexpr size_type row_capacity() const noexcept;
+
+        constexpr void swap(static_jagged& other) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr void clear() noexcept;
+
+        constexpr bool push_row() noexcept;
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool push_row(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>);
+
+        constexpr bool append_to_last_row(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool append_to_last_row(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool append_to_last_row(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>);
+
+        constexpr void pop_row() noexcept;
+        constexpr void erase_row(size_type r) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<T, TotalCap> buf_{};
+        std::array<size_type, RowCap + 1u> offsets_{};
+        size_type rows_{};
+
+        template <typename It>
+        constexpr size_type copy_back(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>);
+};
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool operator==(static_jagged<T, TotalCap, RowCap> const& lhs, static_jagged<T, TotalCap, RowCap> const& rhs) noexcept;
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool operator!=(static_jagged<T, TotalCap, RowCap> const& lhs, static_jagged<T, TotalCap, RowCap> const& rhs) noexcept;
+
+namespace detail {
+
+template <typename Container>
+template <typename U, typename>
+constexpr jagged_iterator<Container>::jagged_iterator(jagged_iterator<U> const& other) noexcept
+    : container_{other.container_}, index_{other.index_} { }
+
+template <typename Container>
+constexpr jagged_iterator<Container>::jagged_iterator(Container* container, difference_type index) noexcept
+    : container_{container}, index_{index} { }
+
+template <typename Container>
+constexpr typename jagged_iterator<Container>::reference jagged_iterator<Container>::operator*() const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_)];
+}
+
+template <typename Container>
+constexpr typename jagged_iterator<Container>::reference jagged_iterator<Container>::operator[](difference_type i) const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_ + i)];
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container>& jagged_iterator<Container>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container> jagged_iterator<Container>::operator++(int) noexcept {
+    auto const it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container>& jagged_iterator<Container>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container> jagged_iterator<Container>::operator--(int) noexcept {
+    auto const it = *this;
+    --index_;
+    return it;
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container>& jagged_iterator<Container>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename Container>
+constexpr jagged_iterator<Container>& jagged_iterator<Container>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename U>
+constexpr bool operator==(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator!=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename U>
+constexpr bool operator<=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>=(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator<(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+}
+
+template <typename U>
+constexpr jagged_iterator<U> operator+(jagged_iterator<U> const& it, typename jagged_iterator<U>::difference_type n) noexcept {
+    return jagged_iterator<U>{it.container_, it.index_ + n};
+}
+
+template <typename U>
+constexpr jagged_iterator<U> operator+(typename jagged_iterator<U>::difference_type n, jagged_iterator<U> const& it) noexcept {
+    return it + n;
+}
+
+template <typename U>
+constexpr jagged_iterator<U> operator-(jagged_iterator<U> const& it, typename jagged_iterator<U>::difference_type n) noexcept {
+    return jagged_iterator<U>{it.container_, it.index_ - n};
+}
+
+template <typename U>
+constexpr typename jagged_iterator<U>::difference_type operator-(jagged_iterator<U> const& lhs, jagged_iterator<U> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::row static_jagged<T, TotalCap, RowCap>::operator[](size_type r) noexcept {
+    return row{buf_.data() + offsets_[r], offsets_[r + 1u] - offsets_[r]};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_row static_jagged<T, TotalCap, RowCap>::operator[](size_type r) const noexcept {
+    return const_row{buf_.data() + offsets_[r], offsets_[r + 1u] - offsets_[r]};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::row static_jagged<T, TotalCap, RowCap>::at(size_type r) {
+    using namespace std::string_literals;
+    if(r >= rows()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(r));
+    }
+    return (*this)[r];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_row static_jagged<T, TotalCap, RowCap>::at(size_type r) const {
+    using namespace std::string_literals;
+    if(r >= rows()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(r));
+    }
+    return (*this)[r];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::row static_jagged<T, TotalCap, RowCap>::front() noexcept {
+    return (*this)[0];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_row static_jagged<T, TotalCap, RowCap>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::row static_jagged<T, TotalCap, RowCap>::back() noexcept {
+    return (*this)[rows_ - 1u];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_row static_jagged<T, TotalCap, RowCap>::back() const noexcept {
+    return (*this)[rows_ - 1u];
+}
+
+/* The elements of all rows, in order */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::row static_jagged<T, TotalCap, RowCap>::elements() noexcept {
+    return row{buf_.data(), size()};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_row static_jagged<T, TotalCap, RowCap>::elements() const noexcept {
+    return const_row{buf_.data(), size()};
+}
+
+/* rows() + 1 offsets into elements(), row r spanning [offsets()[r], offsets()[r + 1]) */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr detail::span<typename static_jagged<T, TotalCap, RowCap>::size_type const>
+static_jagged<T, TotalCap, RowCap>::offsets() const noexcept {
+    return detail::span<size_type const>{offsets_.data(), rows_ + 1u};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type static_jagged<T, TotalCap, RowCap>::row_size(size_type r) const noexcept {
+    return offsets_[r + 1u] - offsets_[r];
+}
+
+/* True if there are no rows, a jagged array of empty rows is not empty */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool static_jagged<T, TotalCap, RowCap>::empty() const noexcept {
+    return !rows_;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type static_jagged<T, TotalCap, RowCap>::rows() const noexcept {
+    return rows_;
+}
+
+/* Number of elements across all rows */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type static_jagged<T, TotalCap, RowCap>::size() const noexcept {
+    return offsets_[rows_];
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type static_jagged<T, TotalCap, RowCap>::capacity() const noexcept {
+    return TotalCap;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type static_jagged<T, TotalCap, RowCap>::row_capacity() const noexcept {
+    return RowCap;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr void static_jagged<T, TotalCap, RowCap>::swap(static_jagged& other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const size = this->size() > other.size() ? this->size() : other.size();
+    for(size_type i = 0u; i < size; i++) {
+        T value = std::move(buf_[i]);
+        buf_[i] = std::move(other.buf_[i]);
+        other.buf_[i] = std::move(value);
+    }
+    auto const rows = rows_ > other.rows_ ? rows_ : other.rows_;
+    for(size_type r = 0u; r <= rows; r++) {
+        auto const offset = offsets_[r];
+        offsets_[r] = other.offsets_[r];
+        other.offsets_[r] = offset;
+    }
+    auto const own = rows_;
+    rows_ = other.rows_;
+    other.rows_ = own;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr void static_jagged<T, TotalCap, RowCap>::clear() noexcept {
+    rows_ = 0u;
+}
+
+/* Appends an empty row. Returns false if there are already RowCap rows */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool static_jagged<T, TotalCap, RowCap>::push_row() noexcept {
+    if(rows_ == RowCap) {
+        return false;
+    }
+    offsets_[rows_ + 1u] = offsets_[rows_];
+    ++rows_;
+    return true;
+}
+
+/* Appends a row holding [first, last). Returns false, leaving the array unchanged, if there are already RowCap rows
+ * or the elements do not fit */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+template <typename It, typename>
+constexpr bool static_jagged<T, TotalCap, RowCap>::push_row(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>) {
+    if(rows_ == RowCap) {
+        return false;
+    }
+    auto const end = copy_back(first, last);
+    if(end > TotalCap) {
+        return false;
+    }
+    offsets_[++rows_] = end;
+    return true;
+}
+
+/* Returns false if there are no rows or the elements are at capacity */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool static_jagged<T, TotalCap, RowCap>::append_to_last_row(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(!rows_ || size() == TotalCap) {
+        return false;
+    }
+    buf_[offsets_[rows_]++] = value;
+    return true;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool static_jagged<T, TotalCap, RowCap>::append_to_last_row(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(!rows_ || size() == TotalCap) {
+        return false;
+    }
+    buf_[offsets_[rows_]++] = std::move(value);
+    return true;
+}
+
+/* Returns false, leaving the array unchanged, if there are no rows or the elements do not fit */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+template <typename It, typename>
+constexpr bool static_jagged<T, TotalCap, RowCap>::append_to_last_row(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>) {
+    if(!rows_) {
+        return false;
+    }
+    auto const end = copy_back(first, last);
+    if(end > TotalCap) {
+        return false;
+    }
+    offsets_[rows_] = end;
+    return true;
+}
+
+/* Copies [first, last) to the end of the elements without touching the offsets, and returns the new end. Returns a
+ * value past TotalCap if the elements do not fit, in which case nothing is copied from forward iterators, and input
+ * iterators stop at capacity */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+template <typename It>
+constexpr typename static_jagged<T, TotalCap, RowCap>::size_type
+static_jagged<T, TotalCap, RowCap>::copy_back(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)>) {
+    auto end = size();
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>) {
+        auto const count = static_cast<size_type>(std::distance(first, last));
+        if(count > TotalCap - end) {
+            return TotalCap + 1u;
+        }
+        for(; first != last; ++first) {
+            buf_[end++] = *first;
+        }
+    }
+    else {
+        for(; first != last; ++first) {
+            if(end == TotalCap) {
+                return TotalCap + 1u;
+            }
+            buf_[end++] = *first;
+        }
+    }
+    return end;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr void static_jagged<T, TotalCap, RowCap>::pop_row() noexcept {
+    --rows_;
+}
+
+/* Erases row r, moving the elements of the following rows down */
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr void static_jagged<T, TotalCap, RowCap>::erase_row(size_type r) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const count = row_size(r);
+    if(count) {
+        for(auto i = offsets_[r + 1u]; i < size(); i++) {
+            buf_[i - count] = std::move(buf_[i]);
+        }
+    }
+    for(auto k = r + 1u; k < rows_; k++) {
+        offsets_[k] = offsets_[k + 1u] - count;
+    }
+    --rows_;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::iterator static_jagged<T, TotalCap, RowCap>::begin() noexcept {
+    return iterator{this, 0};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::iterator static_jagged<T, TotalCap, RowCap>::end() noexcept {
+    return iterator{this, static_cast<difference_type>(rows_)};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_iterator static_jagged<T, TotalCap, RowCap>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_iterator static_jagged<T, TotalCap, RowCap>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_iterator static_jagged<T, TotalCap, RowCap>::cbegin() const noexcept {
+    return const_iterator{this, 0};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_iterator static_jagged<T, TotalCap, RowCap>::cend() const noexcept {
+    return const_iterator{this, static_cast<difference_type>(rows_)};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::reverse_iterator static_jagged<T, TotalCap, RowCap>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::reverse_iterator static_jagged<T, TotalCap, RowCap>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_reverse_iterator static_jagged<T, TotalCap, RowCap>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_reverse_iterator static_jagged<T, TotalCap, RowCap>::rend() const noexcept {
+    return crend();
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_reverse_iterator static_jagged<T, TotalCap, RowCap>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr typename static_jagged<T, TotalCap, RowCap>::const_reverse_iterator static_jagged<T, TotalCap, RowCap>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool operator==(static_jagged<T, TotalCap, RowCap> const& lhs, static_jagged<T, TotalCap, RowCap> const& rhs) noexcept {
+    if(lhs.rows() != rhs.rows()) {
+        return false;
+    }
+    auto const lhs_offsets = lhs.offsets();
+    auto const rhs_offsets = rhs.offsets();
+    for(std::size_t r = 0u; r <= lhs.rows(); r++) {
+        if(lhs_offsets[r] != rhs_offsets[r]) {
+            return false;
+        }
+    }
+    auto const lhs_elements = lhs.elements();
+    auto const rhs_elements = rhs.elements();
+    for(std::size_t i = 0u; i < lhs_elements.size(); i++) {
+        if(!(lhs_elements[i] == rhs_elements[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+constexpr bool operator!=(static_jagged<T, TotalCap, RowCap> const& lhs, static_jagged<T, TotalCap, RowCap> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* STATIC_JAGGED_H */
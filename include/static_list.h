@@ -0,0 +1,605 @@
+#ifndef STATIC_LIST_H
+#define STATIC_LIST_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class static_list;
+
+namespace detail {
+
+template <typename Index>
+struct list_link {
+    Index prev;
+    Index next;
+};
+
+template <typename Value, typename Index>
+class list_iterator;
+
+/* Iterator at node index of a ring of links, for containers other than static_list laid out the same way */
+template <typename Value, typename Index>
+constexpr list_iterator<Value, Index> make_list_iterator(list_link<Index> const* links, Value* values, Index index) noexcept;
+
+template <typename Value, typename Index>
+class list_iterator {
+    using link = list_link<Index>;
+
+    public:
+        using value_type        = std::remove_cv_t<Value>;
+        using reference         = Value&;
+        using pointer           = Value*;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        constexpr list_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Value> && !std::is_same_v<U, Value>>>
+        constexpr list_iterator(list_iterator<U, Index> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+
+        constexpr list_iterator& operator++() noexcept;
+        constexpr list_iterator operator++(int) noexcept;
+
+        constexpr list_iterator& operator--() noexcept;
+        constexpr list_iterator operator--(int) noexcept;
+
+        template <typename U, typename I>
+        friend constexpr bool operator==(list_iterator<U, I> const& lhs, list_iterator<U, I> const& rhs) noexcept;
+        template <typename U, typename I>
+        friend constexpr bool operator!=(list_iterator<U, I> const& lhs, list_iterator<U, I> const& rhs) noexcept;
+
+    private:
+        link const* links_{};
+        Value* values_{};
+        Index index_{};
+
+        constexpr list_iterator(link const* links, Value* values, Index index) noexcept;
+
+        template <typename, typename>
+        friend class list_iterator;
+        template <typename, std::size_t>
+        friend class ::static_list;
+        template <typename V, typename I>
+        friend constexpr list_iterator<V, I> make_list_iterator(list_link<I> const* links, V* values, I index) noexcept;
+};
+
+} // namespace detail
+
+/* Fixed-capacity doubly-linked list. Nodes live in an array and are linked by 16-bit indices, or 32-bit ones for
+ * N of 65534 or more, with values and links stored apart. Index N is the sentinel closing the list into a ring.
+ * Erased nodes form a singly-linked free list and are reused last in, first out, nodes never used are handed out
+ * in order. As with statvec, all N values are constructed for the lifetime of the list */
+template <typename T, std::size_t N>
+class static_list {
+    using index_type = std::conditional_t<(N + 1u < 0xffffu), std::uint16_t, std::uint32_t>;
+    using link = detail::list_link<index_type>;
+
+    public:
+        using value_type             = T;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = T&;
+        using const_reference        = T const&;
+        using pointer                = T*;
+        using const_pointer          = T const*;
+        using iterator               = detail::list_iterator<T, index_type>;
+        using const_iterator         = detail::list_iterator<T const, index_type>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        constexpr static_list() noexcept;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_list& other) noexcept(std::is_nothrow_swappable_v<T>);
+        constexpr void clear() noexcept;
+        constexpr void compact() noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_assignable_v<T>);
+
+        constexpr iterator insert(const_iterator pos, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr iterator insert(const_iterator pos, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr iterator emplace(const_iterator pos, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                              std::is_nothrow_move_assignable_v<T>);
+
+        constexpr bool push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr bool emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                            std::is_nothrow_move_assignable_v<T>);
+
+        constexpr bool push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr bool push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr bool emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                           std::is_nothrow_move_assignable_v<T>);
+
+        constexpr T pop_front() noexcept(std::is_nothrow_move_constructible_v<T>);
+        constexpr T pop_back() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        constexpr iterator erase(const_iterator pos) noexcept;
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept;
+
+        constexpr void splice(const_iterator pos, const_iterator it) noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        static index_type constexpr sentinel = static_cast<index_type>(N);
+        /* Marks the prev link of free nodes */
+        static index_type constexpr unlinked = static_cast<index_type>(N + 1u);
+
+        std::array<T, N> values_{};
+        std::array<link, N + 1u> links_{};
+        size_type size_{};
+        index_type free_{sentinel};
+        index_type used_{};
+
+        constexpr iterator make_iterator(index_type i) noexcept;
+        constexpr const_iterator make_iterator(index_type i) const noexcept;
+
+        constexpr index_type acquire() noexcept;
+        constexpr void release(index_type i) noexcept;
+        constexpr void link_before(index_type i, index_type pos) noexcept;
+        constexpr void unlink(index_type i) noexcept;
+        constexpr bool is_free(index_type i) const noexcept;
+        constexpr void swap_nodes(index_type a, index_type b) noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_assignable_v<T>);
+};
+
+template <typename T, std::size_t N>
+constexpr bool operator==(static_list<T, N> const& lhs, static_list<T, N> const& rhs) noexcept;
+template <typename T, std::size_t N>
+constexpr bool operator!=(static_list<T, N> const& lhs, static_list<T, N> const& rhs) noexcept;
+
+template <typename T, std::size_t N>
+constexpr static_list<T, N>::static_list() noexcept {
+    links_[sentinel] = link{sentinel, sentinel};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::reference static_list<T, N>::front() noexcept {
+    return values_[links_[sentinel].next];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reference static_list<T, N>::front() const noexcept {
+    return values_[links_[sentinel].next];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::reference static_list<T, N>::back() noexcept {
+    return values_[links_[sentinel].prev];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reference static_list<T, N>::back() const noexcept {
+    return values_[links_[sentinel].prev];
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::size_type static_list<T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::size_type static_list<T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::size_type static_list<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::swap(static_list& other) noexcept(std::is_nothrow_swappable_v<T>) {
+    using std::swap;
+    swap(values_, other.values_);
+    swap(links_, other.links_);
+    swap(size_, other.size_);
+    swap(free_, other.free_);
+    swap(used_, other.used_);
+}
+
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::clear() noexcept {
+    links_[sentinel] = link{sentinel, sentinel};
+    size_ = 0u;
+    free_ = sentinel;
+    used_ = 0u;
+}
+
+/* Relabels the nodes so that the list occupies indices 0 to size() - 1 in traversal order, which turns iteration
+ * into a linear walk over the arrays. Node k is swapped with the k-th node of the list, whose own position is
+ * final once visited. Invalidates all iterators */
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::compact() noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_assignable_v<T>) {
+    auto i = links_[sentinel].next;
+    for(index_type k = 0u; k < size_; k++) {
+        if(i != k) {
+            swap_nodes(i, k);
+        }
+        i = links_[k].next;
+    }
+    free_ = sentinel;
+    used_ = static_cast<index_type>(size_);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator
+static_list<T, N>::insert(const_iterator pos, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if(full()) {
+        return end();
+    }
+    auto const i = acquire();
+    values_[i] = value;
+    link_before(i, pos.index_);
+    return make_iterator(i);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator
+static_list<T, N>::insert(const_iterator pos, T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(full()) {
+        return end();
+    }
+    auto const i = acquire();
+    values_[i] = std::move(value);
+    link_before(i, pos.index_);
+    return make_iterator(i);
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr typename static_list<T, N>::iterator
+static_list<T, N>::emplace(const_iterator pos, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                      std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(pos, T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::push_front(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    return insert(cbegin(), value) != end();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::push_front(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return insert(cbegin(), std::move(value)) != end();
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_list<T, N>::emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                      std::is_nothrow_move_assignable_v<T>)
+{
+    return emplace(cbegin(), std::forward<Ts>(args)...) != end();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::push_back(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    return insert(cend(), value) != end();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::push_back(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return insert(cend(), std::move(value)) != end();
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr bool static_list<T, N>::emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                     std::is_nothrow_move_assignable_v<T>)
+{
+    return emplace(cend(), std::forward<Ts>(args)...) != end();
+}
+
+/* Precondition: !empty() */
+template <typename T, std::size_t N>
+constexpr T static_list<T, N>::pop_front() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    auto const i = links_[sentinel].next;
+    T value = std::move(values_[i]);
+    unlink(i);
+    release(i);
+    return value;
+}
+
+/* Precondition: !empty() */
+template <typename T, std::size_t N>
+constexpr T static_list<T, N>::pop_back() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    auto const i = links_[sentinel].prev;
+    T value = std::move(values_[i]);
+    unlink(i);
+    release(i);
+    return value;
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator static_list<T, N>::erase(const_iterator pos) noexcept {
+    auto const next = links_[pos.index_].next;
+    unlink(pos.index_);
+    release(pos.index_);
+    return make_iterator(next);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator static_list<T, N>::erase(const_iterator first, const_iterator last) noexcept {
+    while(first != last) {
+        first = erase(first);
+    }
+    return make_iterator(last.index_);
+}
+
+/* Moves the element at it in front of pos without copying it. Iterators to it remain valid */
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::splice(const_iterator pos, const_iterator it) noexcept {
+    if(pos == it) {
+        return;
+    }
+    unlink(it.index_);
+    link_before(it.index_, pos.index_);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator static_list<T, N>::begin() noexcept {
+    return make_iterator(links_[sentinel].next);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator static_list<T, N>::end() noexcept {
+    return make_iterator(sentinel);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_iterator static_list<T, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_iterator static_list<T, N>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_iterator static_list<T, N>::cbegin() const noexcept {
+    return make_iterator(links_[sentinel].next);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_iterator static_list<T, N>::cend() const noexcept {
+    return make_iterator(sentinel);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::reverse_iterator static_list<T, N>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::reverse_iterator static_list<T, N>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reverse_iterator static_list<T, N>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reverse_iterator static_list<T, N>::rend() const noexcept {
+    return crend();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reverse_iterator static_list<T, N>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_reverse_iterator static_list<T, N>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+/* The iterators point at the first value, even for the sentinel, which has none */
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::iterator static_list<T, N>::make_iterator(index_type i) noexcept {
+    return iterator{links_.data(), values_.data(), i};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::const_iterator static_list<T, N>::make_iterator(index_type i) const noexcept {
+    return const_iterator{links_.data(), values_.data(), i};
+}
+
+/* Precondition: !full() */
+template <typename T, std::size_t N>
+constexpr typename static_list<T, N>::index_type static_list<T, N>::acquire() noexcept {
+    ++size_;
+    if(free_ == sentinel) {
+        return used_++;
+    }
+    auto const i = free_;
+    free_ = links_[i].next;
+    return i;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::release(index_type i) noexcept {
+    links_[i] = link{unlinked, free_};
+    free_ = i;
+    --size_;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::link_before(index_type i, index_type pos) noexcept {
+    auto const prev = links_[pos].prev;
+    links_[i] = link{prev, pos};
+    links_[prev].next = i;
+    links_[pos].prev = i;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::unlink(index_type i) noexcept {
+    auto const [prev, next] = links_[i];
+    links_[prev].next = next;
+    links_[next].prev = prev;
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_list<T, N>::is_free(index_type i) const noexcept {
+    return i >= used_ || links_[i].prev == unlinked;
+}
+
+/* Exchanges the positions of linked node a and node b in the arrays, b being either linked or free. Links between
+ * a and b themselves are relabeled before the neighbours are patched, which keeps adjacent nodes consistent */
+template <typename T, std::size_t N>
+constexpr void static_list<T, N>::swap_nodes(index_type a, index_type b) noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_assignable_v<T>) {
+    if(is_free(b)) {
+        values_[b] = std::move(values_[a]);
+        links_[b] = links_[a];
+        links_[a].prev = unlinked;
+    }
+    else {
+        using std::swap;
+        swap(values_[a], values_[b]);
+        auto const relabel = [a, b](index_type i) {
+            return i == a ? b : i == b ? a : i;
+        };
+        auto const la = links_[a];
+        auto const lb = links_[b];
+        links_[a] = link{relabel(lb.prev), relabel(lb.next)};
+        links_[b] = link{relabel(la.prev), relabel(la.next)};
+        links_[links_[a].prev].next = a;
+        links_[links_[a].next].prev = a;
+    }
+    links_[links_[b].prev].next = b;
+    links_[links_[b].next].prev = b;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator==(static_list<T, N> const& lhs, static_list<T, N> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r) {
+        if(!(*l == *r)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator!=(static_list<T, N> const& lhs, static_list<T, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+namespace detail {
+
+template <typename V, typename I>
+constexpr list_iterator<V, I>::list_iterator(link const* links, V* values, I index) noexcept
+    : links_{links}, values_{values}, index_{index} { }
+
+template <typename V, typename I>
+template <typename U, typename>
+constexpr list_iterator<V, I>::list_iterator(list_iterator<U, I> const& other) noexcept
+    : links_{other.links_}, values_{other.values_}, index_{other.index_} { }
+
+template <typename V, typename I>
+constexpr typename list_iterator<V, I>::reference list_iterator<V, I>::operator*() const noexcept {
+    return values_[index_];
+}
+
+template <typename V, typename I>
+constexpr typename list_iterator<V, I>::pointer list_iterator<V, I>::operator->() const noexcept {
+    return values_ + index_;
+}
+
+template <typename V, typename I>
+constexpr list_iterator<V, I>& list_iterator<V, I>::operator++() noexcept {
+    index_ = links_[index_].next;
+    return *this;
+}
+
+template <typename V, typename I>
+constexpr list_iterator<V, I> list_iterator<V, I>::operator++(int) noexcept {
+    auto it = *this;
+    ++*this;
+    return it;
+}
+
+template <typename V, typename I>
+constexpr list_iterator<V, I>& list_iterator<V, I>::operator--() noexcept {
+    index_ = links_[index_].prev;
+    return *this;
+}
+
+template <typename V, typename I>
+constexpr list_iterator<V, I> list_iterator<V, I>::operator--(int) noexcept {
+    auto it = *this;
+    --*this;
+    return it;
+}
+
+template <typename V, typename I>
+constexpr list_iterator<V, I> make_list_iterator(list_link<I> const* links, V* values, I index) noexcept {
+    return list_iterator<V, I>{links, values, index};
+}
+
+template <typename V, typename I>
+constexpr bool operator==(list_iterator<V, I> const& lhs, list_iterator<V, I> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename V, typename I>
+constexpr bool operator!=(list_iterator<V, I> const& lhs, list_iterator<V, I> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace detail
+
+#endif /* STATIC_LIST_H */
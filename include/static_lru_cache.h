@@ -0,0 +1,321 @@
+#ifndef STATIC_LRU_CACHE_H
+#define STATIC_LRU_CACHE_H
+
+#include "static_list.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+
+/* Default eviction hook of static_lru_cache */
+struct ignore_eviction {
+    template <typename Key, typename T>
+    constexpr void operator()(Key const&, T&) const noexcept { }
+};
+
+} // namespace detail
+
+/* Fixed-capacity cache of up to N entries, evicting the least recently used one to make room. Entries live in an
+ * array, their recency order being a ring of index links as in static_list, with index N as the sentinel. Keys are
+ * found through an open-addressing table of entry indices, at least twice as large as N, probed linearly and
+ * compacted by backward shifting on removal, so it never holds tombstones. Evict is called with the key and value of
+ * each entry evicted for lack of room, before it is overwritten */
+template <typename Key, typename T, std::size_t N, typename Evict = detail::ignore_eviction,
+          typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class static_lru_cache {
+    static_assert(N);
+
+    using index_type = std::conditional_t<(N + 1u < 0xffffu), std::uint16_t, std::uint32_t>;
+    using link = detail::list_link<index_type>;
+
+    public:
+        using key_type        = Key;
+        using mapped_type     = T;
+        using value_type      = std::pair<Key, T>;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using const_reference = value_type const&;
+        using const_iterator  = detail::list_iterator<value_type const, index_type>;
+        using iterator        = const_iterator;
+
+        static size_type constexpr slot_count = [] {
+            size_type count = 1u;
+            while(count < 2u * N) {
+                count *= 2u;
+            }
+            return count;
+        }();
+
+        constexpr static_lru_cache() noexcept(std::is_nothrow_default_constructible_v<Evict>);
+        constexpr explicit static_lru_cache(Evict evict) noexcept(std::is_nothrow_move_constructible_v<Evict>);
+
+        constexpr T* get(Key const& key) noexcept;
+        constexpr T const* peek(Key const& key) const noexcept;
+        constexpr bool contains(Key const& key) const noexcept;
+
+        template <typename U>
+        constexpr T& put(Key const& key, U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&> &&
+                                                             std::is_nothrow_copy_assignable_v<Key> &&
+                                                             std::is_nothrow_invocable_v<Evict&, Key const&, T&>);
+        constexpr bool erase(Key const& key) noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void clear() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        static index_type constexpr sentinel = static_cast<index_type>(N);
+        static size_type constexpr mask = slot_count - 1u;
+
+        std::array<value_type, N> entries_{};
+        std::array<std::size_t, N> hashes_{};
+        std::array<link, N + 1u> links_{};
+        std::array<index_type, slot_count> table_{};
+        size_type size_{};
+        index_type free_{sentinel};
+        index_type used_{};
+        Hash hash_{};
+        KeyEqual equal_{};
+        Evict evict_{};
+
+        constexpr std::size_t hash(Key const& key) const noexcept;
+        constexpr size_type find_slot(Key const& key, std::size_t hash) const noexcept;
+        constexpr void remove_slot(index_type e) noexcept;
+        constexpr void link_front(index_type e) noexcept;
+        constexpr void unlink(index_type e) noexcept;
+        constexpr void release(index_type e) noexcept;
+};
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::static_lru_cache() noexcept(std::is_nothrow_default_constructible_v<Evict>) {
+    clear();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::static_lru_cache(Evict evict) noexcept(std::is_nothrow_move_constructible_v<Evict>)
+    : evict_{std::move(evict)}
+{
+    clear();
+}
+
+/* Marks the entry as most recently used */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr T* static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::get(Key const& key) noexcept {
+    auto const e = table_[find_slot(key, hash(key))];
+    if(e == sentinel) {
+        return nullptr;
+    }
+    unlink(e);
+    link_front(e);
+    return &entries_[e].second;
+}
+
+/* Leaves the recency order untouched */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr T const* static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::peek(Key const& key) const noexcept {
+    auto const e = table_[find_slot(key, hash(key))];
+    return e == sentinel ? nullptr : &entries_[e].second;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr bool static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::contains(Key const& key) const noexcept {
+    return peek(key) != nullptr;
+}
+
+/* Inserts or assigns, marking the entry as most recently used. When full, the least recently used entry is handed
+ * to Evict and replaced */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+template <typename U>
+constexpr T& static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::put(Key const& key, U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&> &&
+                                                                                                       std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                                       std::is_nothrow_invocable_v<Evict&, Key const&, T&>)
+{
+    auto const h = hash(key);
+    auto slot = find_slot(key, h);
+    index_type e = table_[slot];
+    if(e != sentinel) {
+        unlink(e);
+    }
+    else {
+        if(full()) {
+            e = links_[sentinel].prev;
+            evict_(std::as_const(entries_[e].first), entries_[e].second);
+            remove_slot(e);
+            unlink(e);
+            slot = find_slot(key, h);
+        }
+        else if(free_ != sentinel) {
+            e = free_;
+            free_ = links_[e].next;
+            ++size_;
+        }
+        else {
+            e = used_++;
+            ++size_;
+        }
+        entries_[e].first = key;
+        hashes_[e] = h;
+        table_[slot] = e;
+    }
+    entries_[e].second = std::forward<U>(value);
+    link_front(e);
+    return entries_[e].second;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr bool static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::erase(Key const& key) noexcept {
+    auto const e = table_[find_slot(key, hash(key))];
+    if(e == sentinel) {
+        return false;
+    }
+    remove_slot(e);
+    unlink(e);
+    release(e);
+    return true;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr bool static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::empty() const noexcept {
+    return !size();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr bool static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::size_type
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::size_type
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::size_type
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::capacity() const noexcept {
+    return N;
+}
+
+/* Drops all entries without calling Evict */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr void static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::clear() noexcept {
+    for(auto& e : table_) {
+        e = sentinel;
+    }
+    links_[sentinel] = link{sentinel, sentinel};
+    size_ = 0u;
+    free_ = sentinel;
+    used_ = 0u;
+}
+
+/* Iterates from the most to the least recently used entry */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::const_iterator
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::const_iterator
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::end() const noexcept {
+    return cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::const_iterator
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::cbegin() const noexcept {
+    return detail::make_list_iterator(links_.data(), entries_.data(), links_[sentinel].next);
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::const_iterator
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::cend() const noexcept {
+    return detail::make_list_iterator(links_.data(), entries_.data(), sentinel);
+}
+
+/* Spreads the entropy of identity hashes over the low bits used to index the table */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr std::size_t static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::hash(Key const& key) const noexcept {
+    std::uint64_t const h = static_cast<std::uint64_t>(hash_(key)) * 0x9e3779b97f4a7c15u;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+/* Slot holding the index of the entry with key, or the empty slot ending its probe sequence */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr typename static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::size_type
+static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::find_slot(Key const& key, std::size_t hash) const noexcept {
+    auto slot = hash & mask;
+    for(; table_[slot] != sentinel; slot = (slot + 1u) & mask) {
+        auto const e = table_[slot];
+        if(hashes_[e] == hash && equal_(entries_[e].first, key)) {
+            break;
+        }
+    }
+    return slot;
+}
+
+/* Backward shift deletion, pulling each following entry of the probe run into the hole unless that would move it
+ * before its home slot */
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr void static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::remove_slot(index_type e) noexcept {
+    auto hole = hashes_[e] & mask;
+    while(table_[hole] != e) {
+        hole = (hole + 1u) & mask;
+    }
+    for(auto slot = (hole + 1u) & mask; table_[slot] != sentinel; slot = (slot + 1u) & mask) {
+        auto const home = hashes_[table_[slot]] & mask;
+        if(((slot - home) & mask) >= ((slot - hole) & mask)) {
+            table_[hole] = table_[slot];
+            hole = slot;
+        }
+    }
+    table_[hole] = sentinel;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr void static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::link_front(index_type e) noexcept {
+    auto const next = links_[sentinel].next;
+    links_[e] = link{sentinel, next};
+    links_[next].prev = e;
+    links_[sentinel].next = e;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr void static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::unlink(index_type e) noexcept {
+    auto const [prev, next] = links_[e];
+    links_[prev].next = next;
+    links_[next].prev = prev;
+}
+
+template <typename Key, typename T, std::size_t N, typename Evict, typename Hash, typename KeyEqual>
+constexpr void static_lru_cache<Key, T, N, Evict, Hash, KeyEqual>::release(index_type e) noexcept {
+    links_[e].next = free_;
+    free_ = e;
+    --size_;
+}
+
+#endif /* STATIC_LRU_CACHE_H */
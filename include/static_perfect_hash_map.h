@@ -0,0 +1,338 @@
+#ifndef STATIC_PERFECT_HASH_MAP_H
+#define STATIC_PERFECT_HASH_MAP_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+
+/* Hashers usable in constant expressions, std::hash is not. Integers and enumerations hash to their value,
+ * anything convertible to std::string_view to an FNV-style hash of its 64-bit words */
+template <typename Key, typename = void>
+struct constexpr_hash;
+
+template <typename Key>
+struct constexpr_hash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>> {
+    constexpr std::uint64_t operator()(Key key) const noexcept;
+};
+
+template <typename Key>
+struct constexpr_hash<Key, std::enable_if_t<std::is_convertible_v<Key const&, std::string_view>>> {
+    constexpr std::uint64_t operator()(std::string_view key) const noexcept;
+};
+
+/* Key comparison consistent with constexpr_hash, keys hashed by content are also compared by content so that
+ * character pointers match strings at other addresses */
+template <typename Key>
+constexpr bool constexpr_key_equal(Key const& lhs, Key const& rhs) noexcept;
+
+/* Finalizer of splitmix64 */
+constexpr std::uint64_t mix64(std::uint64_t x) noexcept;
+
+constexpr std::size_t ceil_pow2(std::size_t n) noexcept;
+
+template <std::size_t Bytes>
+constexpr std::uint64_t load_le(char const* data) noexcept;
+
+} // namespace detail
+
+/* Immutable map built from a statvec of up to N distinct keys, using hash and displace. Keys are first spread over
+ * bucket_count buckets, then, starting with the largest bucket, the builder searches for each bucket a seed placing
+ * all its keys in free slots. A lookup thus hashes the key once, mixes the hash with the seed of its bucket to find
+ * its slot, and compares against the single entry there. Construction runs in constant expressions, so a constexpr
+ * map costs nothing at startup */
+template <typename Key, typename T, std::size_t N, typename Hash = detail::constexpr_hash<Key>>
+class static_perfect_hash_map {
+    static_assert(N);
+
+    public:
+        using key_type        = Key;
+        using mapped_type     = T;
+        using value_type      = std::pair<Key, T>;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher          = Hash;
+        using const_reference = value_type const&;
+        using const_iterator  = value_type const*;
+        using iterator        = const_iterator;
+
+        static size_type constexpr slot_count = detail::ceil_pow2(N + (N + 3u) / 4u);
+        static size_type constexpr bucket_count = detail::ceil_pow2((N + 1u) / 2u);
+
+        constexpr explicit static_perfect_hash_map(statvec<value_type, N> const& entries);
+
+        constexpr T const* find(Key const& key) const noexcept;
+        constexpr bool contains(Key const& key) const noexcept;
+        constexpr size_type count(Key const& key) const noexcept;
+        constexpr T const& at(Key const& key) const;
+
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        using index_type = std::conditional_t<(N <= 0xffu), std::uint8_t,
+                           std::conditional_t<(N <= 0xffffu), std::uint16_t, std::uint32_t>>;
+
+        static std::uint32_t constexpr max_seed = 1u << 16;
+
+        std::array<value_type, N> entries_{};
+        std::array<index_type, slot_count> slots_{};
+        std::array<std::uint32_t, bucket_count> seeds_{};
+        size_type size_{};
+        Hash hash_{};
+
+        static constexpr size_type bucket_of(std::uint64_t mixed) noexcept;
+        static constexpr size_type slot_of(std::uint64_t mixed, std::uint32_t seed) noexcept;
+};
+
+template <typename Key, typename T, std::size_t N>
+static_perfect_hash_map(statvec<std::pair<Key, T>, N> const&) -> static_perfect_hash_map<Key, T, N>;
+
+/* Throws std::invalid_argument on duplicate keys, and std::runtime_error if no seed places some bucket, which
+ * turns into a compilation error for constexpr maps */
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr static_perfect_hash_map<Key, T, N, Hash>::static_perfect_hash_map(statvec<value_type, N> const& entries)
+    : size_{entries.size()}
+{
+    std::array<std::uint64_t, N> mixed{};
+    std::array<size_type, bucket_count + 1u> offsets{};
+    for(size_type i = 0u; i < size_; i++) {
+        /* std::pair is not assignable in constant expressions before C++20 */
+        entries_[i].first = entries[i].first;
+        entries_[i].second = entries[i].second;
+        mixed[i] = detail::mix64(hash_(entries_[i].first));
+        ++offsets[bucket_of(mixed[i]) + 1u];
+    }
+
+    size_type longest = 0u;
+    for(size_type b = 0u; b < bucket_count; b++) {
+        longest = offsets[b + 1u] > longest ? offsets[b + 1u] : longest;
+        offsets[b + 1u] += offsets[b];
+    }
+
+    /* Entry indices grouped by bucket */
+    std::array<size_type, N> order{};
+    auto next = offsets;
+    for(size_type i = 0u; i < size_; i++) {
+        order[next[bucket_of(mixed[i])]++] = i;
+    }
+
+    for(size_type b = 0u; b < bucket_count; b++) {
+        for(auto i = offsets[b]; i < offsets[b + 1u]; i++) {
+            for(auto j = offsets[b]; j < i; j++) {
+                if(detail::constexpr_key_equal(entries_[order[i]].first, entries_[order[j]].first)) {
+                    throw std::invalid_argument("Duplicate key");
+                }
+            }
+        }
+    }
+
+    std::array<bool, slot_count> used{};
+    for(auto length = longest; length; length--) {
+        for(size_type b = 0u; b < bucket_count; b++) {
+            if(offsets[b + 1u] - offsets[b] != length) {
+                continue;
+            }
+            for(std::uint32_t seed = 0u;; seed++) {
+                if(seed == max_seed) {
+                    throw std::runtime_error("No perfect hash found");
+                }
+                auto i = offsets[b];
+                for(; i < offsets[b + 1u] && !used[slot_of(mixed[order[i]], seed)]; i++) {
+                    used[slot_of(mixed[order[i]], seed)] = true;
+                }
+                if(i == offsets[b + 1u]) {
+                    seeds_[b] = seed;
+                    break;
+                }
+                while(i-- > offsets[b]) {
+                    used[slot_of(mixed[order[i]], seed)] = false;
+                }
+            }
+            for(auto i = offsets[b]; i < offsets[b + 1u]; i++) {
+                slots_[slot_of(mixed[order[i]], seeds_[b])] = static_cast<index_type>(order[i]);
+            }
+        }
+    }
+}
+
+/* Free slots hold index 0, the key of entry 0 never lands there */
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr T const* static_perfect_hash_map<Key, T, N, Hash>::find(Key const& key) const noexcept {
+    auto const mixed = detail::mix64(hash_(key));
+    auto const i = slots_[slot_of(mixed, seeds_[bucket_of(mixed)])];
+    return size_ && detail::constexpr_key_equal(entries_[i].first, key) ? &entries_[i].second : nullptr;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr bool static_perfect_hash_map<Key, T, N, Hash>::contains(Key const& key) const noexcept {
+    return find(key) != nullptr;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::count(Key const& key) const noexcept {
+    return contains(key);
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr T const& static_perfect_hash_map<Key, T, N, Hash>::at(Key const& key) const {
+    auto const value = find(key);
+    if(!value) {
+        throw std::out_of_range("Key not found");
+    }
+    return *value;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr bool static_perfect_hash_map<Key, T, N, Hash>::empty() const noexcept {
+    return !size();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::capacity() const noexcept {
+    return N;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::const_iterator
+static_perfect_hash_map<Key, T, N, Hash>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::const_iterator
+static_perfect_hash_map<Key, T, N, Hash>::end() const noexcept {
+    return cend();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::const_iterator
+static_perfect_hash_map<Key, T, N, Hash>::cbegin() const noexcept {
+    return entries_.data();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::const_iterator
+static_perfect_hash_map<Key, T, N, Hash>::cend() const noexcept {
+    return entries_.data() + size_;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::bucket_of(std::uint64_t mixed) noexcept {
+    return static_cast<size_type>(mixed) & (bucket_count - 1u);
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash>
+constexpr typename static_perfect_hash_map<Key, T, N, Hash>::size_type
+static_perfect_hash_map<Key, T, N, Hash>::slot_of(std::uint64_t mixed, std::uint32_t seed) noexcept {
+    return static_cast<size_type>(detail::mix64(mixed ^ seed * 0x9e3779b97f4a7c15u)) & (slot_count - 1u);
+}
+
+namespace detail {
+
+template <typename Key>
+constexpr std::uint64_t constexpr_hash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>>::operator()(Key key) const noexcept {
+    return static_cast<std::uint64_t>(key);
+}
+
+/* Reads Bytes bytes as a little-endian integer. Assembled byte by byte in constant expressions, with a single load
+ * otherwise, both giving the same value on little-endian targets */
+template <std::size_t Bytes>
+constexpr std::uint64_t load_le(char const* data) noexcept {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if(!__builtin_is_constant_evaluated()) {
+        std::conditional_t<Bytes == 8u, std::uint64_t, std::uint32_t> word{};
+        std::memcpy(&word, data, Bytes);
+        return word;
+    }
+#endif
+    std::uint64_t word = 0u;
+    for(std::size_t i = 0u; i < Bytes; i++) {
+        word |= std::uint64_t{static_cast<unsigned char>(data[i])} << (8u * i);
+    }
+    return word;
+}
+
+/* Strings of up to 8 bytes are hashed without looping, reading overlapping words at both ends */
+template <typename Key>
+constexpr std::uint64_t constexpr_hash<Key, std::enable_if_t<std::is_convertible_v<Key const&, std::string_view>>>::operator()(std::string_view key) const noexcept {
+    auto const data = key.data();
+    auto const size = key.size();
+    std::uint64_t hash = 0xcbf29ce484222325u ^ size;
+    std::uint64_t word = 0u;
+    if(size > 8u) {
+        for(std::size_t i = 0u; i + 8u < size; i += 8u) {
+            hash = (hash ^ load_le<8u>(data + i)) * 0x100000001b3u;
+            hash ^= hash >> 32;
+        }
+        word = load_le<8u>(data + size - 8u);
+    }
+    else if(size >= 4u) {
+        word = load_le<4u>(data) << 32 | load_le<4u>(data + size - 4u);
+    }
+    else if(size) {
+        word = std::uint64_t{static_cast<unsigned char>(data[0])} << 16 |
+               std::uint64_t{static_cast<unsigned char>(data[size / 2u])} << 8 |
+               std::uint64_t{static_cast<unsigned char>(data[size - 1u])};
+    }
+    return (hash ^ word) * 0x100000001b3u;
+}
+
+template <typename Key>
+constexpr bool constexpr_key_equal(Key const& lhs, Key const& rhs) noexcept {
+    if constexpr(std::is_convertible_v<Key const&, std::string_view>) {
+        return std::string_view{lhs} == std::string_view{rhs};
+    }
+    else {
+        return lhs == rhs;
+    }
+}
+
+constexpr std::uint64_t mix64(std::uint64_t x) noexcept {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9u;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebu;
+    return x ^ (x >> 31);
+}
+
+constexpr std::size_t ceil_pow2(std::size_t n) noexcept {
+    std::size_t pow = 1u;
+    while(pow < n) {
+        pow *= 2u;
+    }
+    return pow;
+}
+
+} // namespace detail
+
+#endif /* STATIC_PERFECT_HASH_MAP_H */
@@ -0,0 +1,339 @@
+#ifndef STATIC_PRIORITY_QUEUE_H
+#define STATIC_PRIORITY_QUEUE_H
+
+#include "statvec.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/* Fixed-capacity priority queue on a statvec, kept as an implicit heap in which each node has Arity children. The
+ * top is the greatest element according to Compare, as with std::priority_queue. An Arity of 4 halves the depth of
+ * the heap and keeps the children of a node within a cache line or two, at the cost of more comparisons per level,
+ * which mostly pays off for heaps too large for the cache */
+template <typename T, std::size_t N, typename Compare = std::less<T>, std::size_t Arity = 2u>
+class static_priority_queue {
+    static_assert(Arity >= 2u);
+
+    public:
+        using container_type  = statvec<T, N>;
+        using value_compare   = Compare;
+        using value_type      = T;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = T const&;
+        using const_iterator  = typename container_type::const_iterator;
+
+        constexpr static_priority_queue() noexcept(std::is_nothrow_default_constructible_v<Compare>) = default;
+        constexpr explicit static_priority_queue(container_type values, Compare const& comp = Compare{}) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                                                 std::is_nothrow_move_assignable_v<T> &&
+                                                                                                                 std::is_nothrow_copy_constructible_v<Compare>);
+
+        constexpr const_reference top() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_priority_queue& other) noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_swappable_v<Compare>);
+        constexpr void clear() noexcept;
+
+        constexpr bool push(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                     std::is_nothrow_move_constructible_v<T> &&
+                                                     std::is_nothrow_move_assignable_v<T>);
+        constexpr bool push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr bool emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                      std::is_nothrow_move_constructible_v<T> &&
+                                                      std::is_nothrow_move_assignable_v<T>);
+        template <typename It, typename = detail::enable_if_input_iterator_t<detail::remove_cvref_t<It>>>
+        constexpr bool push_range(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)> &&
+                                                              std::is_nothrow_move_constructible_v<T> &&
+                                                              std::is_nothrow_move_assignable_v<T>);
+
+        constexpr T pop() noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+        constexpr T push_pop(T value) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+        constexpr T replace_top(T value) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+        constexpr bool offer(T value) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+
+        [[nodiscard]] constexpr container_type take_sorted() noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                      std::is_nothrow_move_assignable_v<T>);
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        container_type heap_{};
+        Compare comp_{};
+
+        constexpr void sift_up(size_type i) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+        constexpr void sift_down(size_type i, T&& value, size_type size) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr void heapify(size_type size) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+};
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr static_priority_queue<T, N, Compare, Arity>::static_priority_queue(container_type values, Compare const& comp) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                                                                  std::is_nothrow_move_assignable_v<T> &&
+                                                                                                                                  std::is_nothrow_copy_constructible_v<Compare>)
+    : heap_{std::move(values)}, comp_{comp}
+{
+    heapify(heap_.size());
+}
+
+/* Precondition: !empty() */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::const_reference
+static_priority_queue<T, N, Compare, Arity>::top() const noexcept {
+    return heap_.front();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::empty() const noexcept {
+    return heap_.empty();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::size_type
+static_priority_queue<T, N, Compare, Arity>::size() const noexcept {
+    return heap_.size();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::size_type
+static_priority_queue<T, N, Compare, Arity>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::size_type
+static_priority_queue<T, N, Compare, Arity>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr void static_priority_queue<T, N, Compare, Arity>::swap(static_priority_queue& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                                                                      std::is_nothrow_swappable_v<Compare>)
+{
+    using std::swap;
+    heap_.swap(other.heap_);
+    swap(comp_, other.comp_);
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr void static_priority_queue<T, N, Compare, Arity>::clear() noexcept {
+    heap_.clear();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::push(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T> &&
+                                                                                         std::is_nothrow_move_constructible_v<T> &&
+                                                                                         std::is_nothrow_move_assignable_v<T>)
+{
+    if(!heap_.push_back(value)) {
+        return false;
+    }
+    sift_up(size() - 1u);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                    std::is_nothrow_move_assignable_v<T>)
+{
+    if(!heap_.push_back(std::move(value))) {
+        return false;
+    }
+    sift_up(size() - 1u);
+    return true;
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+template <typename... Ts>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                          std::is_nothrow_move_constructible_v<T> &&
+                                                                                          std::is_nothrow_move_assignable_v<T>)
+{
+    return push(T(std::forward<Ts>(args)...));
+}
+
+/* Pushes as many elements as fit, returning false if some were left out. Appending more elements than the heap
+ * already holds rebuilds it bottom-up in linear time, cheaper than sifting each of them up */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+template <typename It, typename>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::push_range(It first, It last) noexcept(std::is_nothrow_assignable_v<T&, decltype(*first)> &&
+                                                                                                  std::is_nothrow_move_constructible_v<T> &&
+                                                                                                  std::is_nothrow_move_assignable_v<T>)
+{
+    auto const old_size = size();
+    for(; first != last && heap_.push_back(*first); ++first) { }
+
+    auto const added = size() - old_size;
+    if(added > old_size) {
+        heapify(size());
+    }
+    else {
+        for(auto i = old_size; i < size(); i++) {
+            sift_up(i);
+        }
+    }
+    return first == last;
+}
+
+/* Precondition: !empty() */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr T static_priority_queue<T, N, Compare, Arity>::pop() noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                       std::is_nothrow_move_assignable_v<T>)
+{
+    T result = std::move(heap_.front());
+    T last = std::move(heap_.back());
+    heap_.resize(size() - 1u);
+    if(!empty()) {
+        sift_down(0u, std::move(last), size());
+    }
+    return result;
+}
+
+/* Same as a push followed by a pop, but sifts at most once and never needs free capacity */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr T static_priority_queue<T, N, Compare, Arity>::push_pop(T value) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                   std::is_nothrow_move_assignable_v<T>)
+{
+    if(empty() || !comp_(value, top())) {
+        return value;
+    }
+    return replace_top(std::move(value));
+}
+
+/* Same as a pop followed by a push. Precondition: !empty() */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr T static_priority_queue<T, N, Compare, Arity>::replace_top(T value) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                      std::is_nothrow_move_assignable_v<T>)
+{
+    T result = std::move(heap_.front());
+    sift_down(0u, std::move(value), size());
+    return result;
+}
+
+/* Bounded top-K insertion. Pushes if there is room, otherwise evicts the top if value compares less than it. The
+ * queue thus retains the N least elements offered, with the greatest of those on top, so keeping the K largest
+ * elements takes Compare = std::greater<T> */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr bool static_priority_queue<T, N, Compare, Arity>::offer(T value) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                   std::is_nothrow_move_assignable_v<T>)
+{
+    if(!full()) {
+        return push(std::move(value));
+    }
+    if(!comp_(value, top())) {
+        return false;
+    }
+    replace_top(std::move(value));
+    return true;
+}
+
+/* Empties the queue, returning its elements in ascending order according to Compare. Heap sort in place, each step
+ * moving the top past the end of the shrinking heap */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::container_type
+static_priority_queue<T, N, Compare, Arity>::take_sorted() noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                   std::is_nothrow_move_assignable_v<T>)
+{
+    for(auto n = size(); n > 1u; n--) {
+        T last = std::move(heap_[n - 1u]);
+        heap_[n - 1u] = std::move(heap_.front());
+        sift_down(0u, std::move(last), n - 1u);
+    }
+    container_type result = std::move(heap_);
+    heap_.clear();
+    return result;
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::const_iterator
+static_priority_queue<T, N, Compare, Arity>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::const_iterator
+static_priority_queue<T, N, Compare, Arity>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::const_iterator
+static_priority_queue<T, N, Compare, Arity>::cbegin() const noexcept {
+    return heap_.cbegin();
+}
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr typename static_priority_queue<T, N, Compare, Arity>::const_iterator
+static_priority_queue<T, N, Compare, Arity>::cend() const noexcept {
+    return heap_.cend();
+}
+
+/* Moves parents down into the hole left by the element at i until its place is found */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr void static_priority_queue<T, N, Compare, Arity>::sift_up(size_type i) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                         std::is_nothrow_move_assignable_v<T>)
+{
+    T value = std::move(heap_[i]);
+    while(i) {
+        auto const parent = (i - 1u) / Arity;
+        if(!comp_(heap_[parent], value)) {
+            break;
+        }
+        heap_[i] = std::move(heap_[parent]);
+        i = parent;
+    }
+    heap_[i] = std::move(value);
+}
+
+/* Fills the hole at i with value, moving the greatest child up into the hole while it compares greater than value,
+ * within the first size elements */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr void static_priority_queue<T, N, Compare, Arity>::sift_down(size_type i, T&& value, size_type size) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    for(auto first = Arity * i + 1u; first < size; first = Arity * i + 1u) {
+        auto const last = first + Arity < size ? first + Arity : size;
+        auto child = first;
+        for(auto j = first + 1u; j < last; j++) {
+            child = comp_(heap_[child], heap_[j]) ? j : child;
+        }
+        if(!comp_(value, heap_[child])) {
+            break;
+        }
+        heap_[i] = std::move(heap_[child]);
+        i = child;
+    }
+    heap_[i] = std::move(value);
+}
+
+/* Floyd's bottom-up construction, sifting down every node with children starting from the last */
+template <typename T, std::size_t N, typename Compare, std::size_t Arity>
+constexpr void static_priority_queue<T, N, Compare, Arity>::heapify(size_type size) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                                            std::is_nothrow_move_assignable_v<T>)
+{
+    if(size < 2u) {
+        return;
+    }
+    for(auto i = (size - 2u) / Arity + 1u; i--;) {
+        T value = std::move(heap_[i]);
+        sift_down(i, std::move(value), size);
+    }
+}
+
+#endif /* STATIC_PRIORITY_QUEUE_H */
@@ -0,0 +1,327 @@
+#ifndef STATIC_SLOT_MAP_H
+#define STATIC_SLOT_MAP_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/* Handle to an element of a static_slot_map. The generation of a slot is odd while occupied and bumped on both
+ * insertion and erasure, so a value-initialized handle never refers to an element, and neither does a handle to an
+ * erased one until its slot has been reused 2^31 times */
+struct slot_map_handle {
+    std::uint32_t index{};
+    std::uint32_t generation{};
+
+    constexpr explicit operator bool() const noexcept;
+};
+
+constexpr bool operator==(slot_map_handle lhs, slot_map_handle rhs) noexcept;
+constexpr bool operator!=(slot_map_handle lhs, slot_map_handle rhs) noexcept;
+
+/* Fixed-capacity container handing out handles that stay valid until their element is erased. Values are kept
+ * contiguous in a statvec for iteration, erasure moving the last value into the hole. Handles go through a table of
+ * slots, each holding the position of its value and a generation. Free slots form a list threaded through the same
+ * table, slots are first handed out in order and recycled last in, first out */
+template <typename T, std::size_t N>
+class static_slot_map {
+    static_assert(N < std::numeric_limits<std::uint32_t>::max());
+
+    public:
+        using value_type      = T;
+        using handle          = slot_map_handle;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = T const&;
+        using pointer         = T*;
+        using const_pointer   = T const*;
+        using iterator        = typename statvec<T, N>::iterator;
+        using const_iterator  = typename statvec<T, N>::const_iterator;
+
+        constexpr static_slot_map() noexcept = default;
+
+        constexpr T* find(handle h) noexcept;
+        constexpr T const* find(handle h) const noexcept;
+        constexpr bool contains(handle h) const noexcept;
+
+        constexpr T& at(handle h);
+        constexpr T const& at(handle h) const;
+
+        constexpr T& operator[](handle h) noexcept;
+        constexpr T const& operator[](handle h) const noexcept;
+
+        constexpr handle handle_of(const_iterator pos) const noexcept;
+
+        constexpr T* data() noexcept;
+        constexpr T const* data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_slot_map& other) noexcept(noexcept(std::declval<statvec<T, N>&>().swap(std::declval<statvec<T, N>&>())));
+        constexpr void clear() noexcept;
+
+        constexpr handle insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>);
+        constexpr handle insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>);
+        template <typename... Ts>
+        constexpr handle emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                        std::is_nothrow_move_assignable_v<T>);
+
+        constexpr bool erase(handle h) noexcept(std::is_nothrow_move_assignable_v<T>);
+        constexpr iterator erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        using index_type = std::uint32_t;
+
+        /* Position of the value while occupied, next free slot otherwise */
+        struct slot {
+            index_type index{};
+            index_type generation{};
+        };
+
+        static index_type constexpr npos = static_cast<index_type>(N);
+
+        statvec<T, N> values_{};
+        std::array<index_type, N> owners_{};
+        std::array<slot, N> slots_{};
+        index_type free_{npos};
+        index_type used_{};
+
+        constexpr handle claim() noexcept;
+        constexpr void release(index_type s) noexcept(std::is_nothrow_move_assignable_v<T>);
+};
+
+constexpr slot_map_handle::operator bool() const noexcept {
+    return generation;
+}
+
+constexpr bool operator==(slot_map_handle lhs, slot_map_handle rhs) noexcept {
+    return lhs.index == rhs.index && lhs.generation == rhs.generation;
+}
+
+constexpr bool operator!=(slot_map_handle lhs, slot_map_handle rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, std::size_t N>
+constexpr T* static_slot_map<T, N>::find(handle h) noexcept {
+    return contains(h) ? &values_[slots_[h.index].index] : nullptr;
+}
+
+template <typename T, std::size_t N>
+constexpr T const* static_slot_map<T, N>::find(handle h) const noexcept {
+    return contains(h) ? &values_[slots_[h.index].index] : nullptr;
+}
+
+/* Handles to slots never handed out fail on the index, stale ones on the generation */
+template <typename T, std::size_t N>
+constexpr bool static_slot_map<T, N>::contains(handle h) const noexcept {
+    return h.index < used_ && slots_[h.index].generation == h.generation && (h.generation & 1u);
+}
+
+template <typename T, std::size_t N>
+constexpr T& static_slot_map<T, N>::at(handle h) {
+    if(!contains(h)) {
+        throw std::out_of_range("Stale or invalid handle");
+    }
+    return (*this)[h];
+}
+
+template <typename T, std::size_t N>
+constexpr T const& static_slot_map<T, N>::at(handle h) const {
+    if(!contains(h)) {
+        throw std::out_of_range("Stale or invalid handle");
+    }
+    return (*this)[h];
+}
+
+/* Precondition: contains(h) */
+template <typename T, std::size_t N>
+constexpr T& static_slot_map<T, N>::operator[](handle h) noexcept {
+    return values_[slots_[h.index].index];
+}
+
+template <typename T, std::size_t N>
+constexpr T const& static_slot_map<T, N>::operator[](handle h) const noexcept {
+    return values_[slots_[h.index].index];
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::handle static_slot_map<T, N>::handle_of(const_iterator pos) const noexcept {
+    auto const s = owners_[static_cast<size_type>(pos - cbegin())];
+    return handle{s, slots_[s].generation};
+}
+
+template <typename T, std::size_t N>
+constexpr T* static_slot_map<T, N>::data() noexcept {
+    return values_.data();
+}
+
+template <typename T, std::size_t N>
+constexpr T const* static_slot_map<T, N>::data() const noexcept {
+    return values_.data();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_slot_map<T, N>::empty() const noexcept {
+    return values_.empty();
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_slot_map<T, N>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::size_type static_slot_map<T, N>::size() const noexcept {
+    return values_.size();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::size_type static_slot_map<T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::size_type static_slot_map<T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr void static_slot_map<T, N>::swap(static_slot_map& other) noexcept(noexcept(std::declval<statvec<T, N>&>().swap(std::declval<statvec<T, N>&>()))) {
+    using std::swap;
+    values_.swap(other.values_);
+    swap(owners_, other.owners_);
+    swap(slots_, other.slots_);
+    swap(free_, other.free_);
+    swap(used_, other.used_);
+}
+
+/* Bumps the generation of every occupied slot, invalidating all handles, and frees them */
+template <typename T, std::size_t N>
+constexpr void static_slot_map<T, N>::clear() noexcept {
+    for(size_type i = 0u; i < size(); i++) {
+        auto const s = owners_[i];
+        ++slots_[s].generation;
+        slots_[s].index = free_;
+        free_ = s;
+    }
+    values_.clear();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::handle static_slot_map<T, N>::insert(T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    return values_.push_back(value) ? claim() : handle{};
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::handle static_slot_map<T, N>::insert(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return values_.push_back(std::move(value)) ? claim() : handle{};
+}
+
+template <typename T, std::size_t N>
+template <typename... Ts>
+constexpr typename static_slot_map<T, N>::handle static_slot_map<T, N>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                                     std::is_nothrow_move_assignable_v<T>)
+{
+    return insert(T(std::forward<Ts>(args)...));
+}
+
+template <typename T, std::size_t N>
+constexpr bool static_slot_map<T, N>::erase(handle h) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if(!contains(h)) {
+        return false;
+    }
+    release(h.index);
+    return true;
+}
+
+/* Returns an iterator to the value moved into the hole, or end() */
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::iterator static_slot_map<T, N>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const i = static_cast<size_type>(pos - cbegin());
+    release(owners_[i]);
+    return begin() + static_cast<difference_type>(i);
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::iterator static_slot_map<T, N>::begin() noexcept {
+    return values_.begin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::iterator static_slot_map<T, N>::end() noexcept {
+    return values_.end();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::const_iterator static_slot_map<T, N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::const_iterator static_slot_map<T, N>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::const_iterator static_slot_map<T, N>::cbegin() const noexcept {
+    return values_.cbegin();
+}
+
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::const_iterator static_slot_map<T, N>::cend() const noexcept {
+    return values_.cend();
+}
+
+/* Binds a slot to the value just appended */
+template <typename T, std::size_t N>
+constexpr typename static_slot_map<T, N>::handle static_slot_map<T, N>::claim() noexcept {
+    index_type s = used_;
+    if(free_ != npos) {
+        s = free_;
+        free_ = slots_[s].index;
+    }
+    else {
+        ++used_;
+    }
+    auto const i = static_cast<index_type>(size() - 1u);
+    owners_[i] = s;
+    slots_[s].index = i;
+    return handle{s, ++slots_[s].generation};
+}
+
+template <typename T, std::size_t N>
+constexpr void static_slot_map<T, N>::release(index_type s) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    auto const i = slots_[s].index;
+    auto const last = static_cast<index_type>(size() - 1u);
+    if(i != last) {
+        values_[i] = std::move(values_[last]);
+        owners_[i] = owners_[last];
+        slots_[owners_[i]].index = i;
+    }
+    values_.resize(last);
+    ++slots_[s].generation;
+    slots_[s].index = free_;
+    free_ = s;
+}
+
+#endif /* STATIC_SLOT_MAP_H */
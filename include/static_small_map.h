@@ -0,0 +1,374 @@
+#ifndef STATIC_SMALL_MAP_H
+#define STATIC_SMALL_MAP_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace detail {
+
+/* Number of key bytes compared per instruction during the linear scan */
+#if defined(__AVX2__)
+inline std::size_t constexpr simd_scan_width = 32u;
+#else
+inline std::size_t constexpr simd_scan_width = 16u;
+#endif
+
+template <typename K>
+inline bool constexpr is_simd_scannable_v =
+#ifdef __SSE2__
+   (std::is_integral_v<K> || std::is_enum_v<K> || std::is_pointer_v<K>) &&
+   (sizeof(K) == 1u || sizeof(K) == 2u || sizeof(K) == 4u || sizeof(K) == 8u);
+#else
+    false;
+#endif
+
+template <typename K, std::size_t N>
+constexpr std::size_t scan_keys(std::array<K, N> const& keys, std::size_t size, K const& key) noexcept;
+
+} // namespace detail
+
+/* Fixed-capacity map intended for a few dozen entries at most. Keys and values are kept in two separate arrays so
+ * that lookups scan a contiguous run of keys, comparing several of them per instruction. The entries are unordered,
+ * which makes erasure constant time */
+template <typename Key, typename T, std::size_t N>
+class static_small_map {
+    static_assert(!std::is_reference_v<Key> && !std::is_reference_v<T>);
+    static_assert(N);
+
+    public:
+        using key_type        = Key;
+        using mapped_type     = T;
+        using size_type       = std::size_t;
+
+        using key_span        = detail::span<Key const>;
+        using mapped_span     = detail::span<T>;
+        using const_mapped_span = detail::span<T const>;
+
+        constexpr static_small_map() noexcept = default;
+
+        constexpr T& at(Key const& key);
+        constexpr T const& at(Key const& key) const;
+
+        constexpr T* find(Key const& key) noexcept;
+        constexpr T const* find(Key const& key) const noexcept;
+        constexpr size_type index_of(Key const& key) const noexcept;
+        constexpr bool contains(Key const& key) const noexcept;
+
+        constexpr Key const& key_at(size_type i) const noexcept;
+        constexpr T& value_at(size_type i) noexcept;
+        constexpr T const& value_at(size_type i) const noexcept;
+
+        constexpr key_span keys() const noexcept;
+        constexpr mapped_span values() noexcept;
+        constexpr const_mapped_span values() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_small_map& other) noexcept(std::is_nothrow_swappable_v<Key> && std::is_nothrow_swappable_v<T>);
+        constexpr void clear() noexcept;
+
+        template <typename... Ts>
+        constexpr std::pair<T*, bool> try_emplace(Key const& key, Ts&&... args) noexcept(std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                         std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                         std::is_nothrow_move_assignable_v<T>);
+        template <typename U>
+        constexpr T* insert_or_assign(Key const& key, U&& value) noexcept(std::is_nothrow_copy_assignable_v<Key> &&
+                                                                          std::is_nothrow_assignable_v<T&, U&&>);
+
+        constexpr bool erase(Key const& key) noexcept(std::is_nothrow_move_assignable_v<Key> && std::is_nothrow_move_assignable_v<T>);
+        constexpr void erase_at(size_type i) noexcept(std::is_nothrow_move_assignable_v<Key> && std::is_nothrow_move_assignable_v<T>);
+
+    private:
+        std::array<Key, N> keys_{};
+        std::array<T, N> values_{};
+        size_type size_{};
+};
+
+template <typename Key, typename T, std::size_t N>
+constexpr T& static_small_map<Key, T, N>::at(Key const& key) {
+    auto const i = index_of(key);
+    if(i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr T const& static_small_map<Key, T, N>::at(Key const& key) const {
+    auto const i = index_of(key);
+    if(i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr T* static_small_map<Key, T, N>::find(Key const& key) noexcept {
+    auto const i = index_of(key);
+    return i == size() ? nullptr : &values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr T const* static_small_map<Key, T, N>::find(Key const& key) const noexcept {
+    auto const i = index_of(key);
+    return i == size() ? nullptr : &values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::size_type static_small_map<Key, T, N>::index_of(Key const& key) const noexcept {
+    return detail::scan_keys(keys_, size_, key);
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool static_small_map<Key, T, N>::contains(Key const& key) const noexcept {
+    return index_of(key) != size();
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr Key const& static_small_map<Key, T, N>::key_at(size_type i) const noexcept {
+    return keys_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr T& static_small_map<Key, T, N>::value_at(size_type i) noexcept {
+    return values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr T const& static_small_map<Key, T, N>::value_at(size_type i) const noexcept {
+    return values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::key_span static_small_map<Key, T, N>::keys() const noexcept {
+    return key_span{keys_.data(), size_};
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::mapped_span static_small_map<Key, T, N>::values() noexcept {
+    return mapped_span{values_.data(), size_};
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::const_mapped_span static_small_map<Key, T, N>::values() const noexcept {
+    return const_mapped_span{values_.data(), size_};
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool static_small_map<Key, T, N>::empty() const noexcept {
+    return !size();
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool static_small_map<Key, T, N>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::size_type static_small_map<Key, T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::size_type static_small_map<Key, T, N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr typename static_small_map<Key, T, N>::size_type static_small_map<Key, T, N>::capacity() const noexcept {
+    return N;
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr void static_small_map<Key, T, N>::swap(static_small_map& other) noexcept(std::is_nothrow_swappable_v<Key> &&
+                                                                                  std::is_nothrow_swappable_v<T>)
+{
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(size_, other.size_);
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr void static_small_map<Key, T, N>::clear() noexcept {
+    size_ = 0u;
+}
+
+template <typename Key, typename T, std::size_t N>
+template <typename... Ts>
+constexpr std::pair<T*, bool> static_small_map<Key, T, N>::try_emplace(Key const& key, Ts&&... args) noexcept(std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                                             std::is_nothrow_constructible_v<T, Ts&&...> &&
+                                                                                                             std::is_nothrow_move_assignable_v<T>)
+{
+    auto const i = index_of(key);
+    if(i != size()) {
+        return {&values_[i], false};
+    }
+    if(full()) {
+        return {nullptr, false};
+    }
+    keys_[size_] = key;
+    values_[size_] = T(std::forward<Ts>(args)...);
+    return {&values_[size_++], true};
+}
+
+template <typename Key, typename T, std::size_t N>
+template <typename U>
+constexpr T* static_small_map<Key, T, N>::insert_or_assign(Key const& key, U&& value) noexcept(std::is_nothrow_copy_assignable_v<Key> &&
+                                                                                               std::is_nothrow_assignable_v<T&, U&&>)
+{
+    auto i = index_of(key);
+    if(i == size()) {
+        if(full()) {
+            return nullptr;
+        }
+        keys_[size_++] = key;
+    }
+    values_[i] = std::forward<U>(value);
+    return &values_[i];
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool static_small_map<Key, T, N>::erase(Key const& key) noexcept(std::is_nothrow_move_assignable_v<Key> &&
+                                                                           std::is_nothrow_move_assignable_v<T>)
+{
+    auto const i = index_of(key);
+    if(i == size()) {
+        return false;
+    }
+    erase_at(i);
+    return true;
+}
+
+/* Fills the hole with the last entry rather than shifting the ones after it */
+template <typename Key, typename T, std::size_t N>
+constexpr void static_small_map<Key, T, N>::erase_at(size_type i) noexcept(std::is_nothrow_move_assignable_v<Key> &&
+                                                                           std::is_nothrow_move_assignable_v<T>)
+{
+    if(i != --size_) {
+        keys_[i] = std::move(keys_[size_]);
+        values_[i] = std::move(values_[size_]);
+    }
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool operator==(static_small_map<Key, T, N> const& lhs, static_small_map<Key, T, N> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0u; i < lhs.size(); i++) {
+        auto const value = rhs.find(lhs.key_at(i));
+        if(!value || !(*value == lhs.value_at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename T, std::size_t N>
+constexpr bool operator!=(static_small_map<Key, T, N> const& lhs, static_small_map<Key, T, N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+namespace detail {
+
+#ifdef __SSE2__
+/* Byte mask of the keys among the simd_scan_width bytes at data that are equal to key */
+template <typename K>
+inline unsigned simd_equal_mask(K const* data, K key) noexcept {
+    using bits_type = std::conditional_t<sizeof(K) == 1u, std::uint8_t,
+                      std::conditional_t<sizeof(K) == 2u, std::uint16_t,
+                      std::conditional_t<sizeof(K) == 4u, std::uint32_t, std::uint64_t>>>;
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(K));
+
+#ifdef __AVX2__
+    auto const lhs = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+    if constexpr(sizeof(K) == 1u) {
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, _mm256_set1_epi8(static_cast<char>(bits))));
+    }
+    else if constexpr(sizeof(K) == 2u) {
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi16(lhs, _mm256_set1_epi16(static_cast<short>(bits))));
+    }
+    else if constexpr(sizeof(K) == 4u) {
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, _mm256_set1_epi32(static_cast<int>(bits))));
+    }
+    else {
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi64(lhs, _mm256_set1_epi64x(static_cast<long long>(bits))));
+    }
+#else
+    auto const lhs = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+    if constexpr(sizeof(K) == 1u) {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(lhs, _mm_set1_epi8(static_cast<char>(bits))));
+    }
+    else if constexpr(sizeof(K) == 2u) {
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(lhs, _mm_set1_epi16(static_cast<short>(bits))));
+    }
+    else if constexpr(sizeof(K) == 4u) {
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(lhs, _mm_set1_epi32(static_cast<int>(bits))));
+    }
+    else {
+        /* SSE2 lacks 64-bit compares, a key matches if both of its 32-bit halves do */
+        auto const eq = _mm_cmpeq_epi32(lhs, _mm_set1_epi64x(static_cast<long long>(bits)));
+        return _mm_movemask_epi8(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+    }
+#endif
+}
+#endif
+
+/* Returns the index of key among the first size keys, or size if absent. The byte masks of the vectors covering
+ * 64 bytes of keys are merged into a single 64-bit mask, so that there is only one data-dependent branch per 64
+ * bytes. Whole vectors are only loaded while they lie within the array, with the lanes past size masked off, the
+ * remainder is compared one key at a time */
+template <typename K, std::size_t N>
+constexpr std::size_t scan_keys(std::array<K, N> const& keys, std::size_t size, K const& key) noexcept {
+    std::size_t i = 0u;
+    if constexpr(is_simd_scannable_v<K>) {
+        if(!__builtin_is_constant_evaluated()) {
+            std::size_t constexpr lanes = simd_scan_width / sizeof(K);
+            std::size_t constexpr vectors = N / lanes;
+            std::size_t constexpr per_mask = 64u / simd_scan_width;
+            for(std::size_t v = 0u; v < vectors && i < size; v += per_mask, i = v * lanes) {
+                std::uint64_t mask = 0u;
+                for(std::size_t w = 0u; w < per_mask && v + w < vectors; w++) {
+                    mask |= std::uint64_t{simd_equal_mask(keys.data() + (v + w) * lanes, key)} << (w * simd_scan_width);
+                }
+                if(size - i < 64u / sizeof(K)) {
+                    mask &= (std::uint64_t{1u} << ((size - i) * sizeof(K))) - 1u;
+                }
+                if(mask) {
+                    return i + __builtin_ctzll(mask) / sizeof(K);
+                }
+            }
+            i = std::min(i, vectors * lanes);
+        }
+    }
+    for(; i < size; i++) {
+        if(keys[i] == key) {
+            return i;
+        }
+    }
+    return size;
+}
+
+} // namespace detail
+
+#endif /* STATIC_SMALL_MAP_H */
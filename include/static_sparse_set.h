@@ -0,0 +1,201 @@
+#ifndef STATIC_SPARSE_SET_H
+#define STATIC_SPARSE_SET_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/* Set of integers in [0, N), as a dense statvec of the members and a sparse array mapping each integer to its
+ * position in the dense one. An integer is a member if its sparse entry points into the dense array at a slot
+ * holding it back, so stale sparse entries never need resetting and clear() only empties the dense array */
+template <std::size_t N>
+class static_sparse_set {
+    public:
+        using value_type      = std::conditional_t<(N <= 0x100u), std::uint8_t,
+                                std::conditional_t<(N <= 0x10000u), std::uint16_t, std::uint32_t>>;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = value_type const&;
+        using const_iterator  = typename statvec<value_type, N>::const_iterator;
+        using iterator        = const_iterator;
+
+        constexpr static_sparse_set() noexcept = default;
+
+        constexpr bool contains(size_type key) const noexcept;
+        constexpr size_type count(size_type key) const noexcept;
+        constexpr size_type index_of(size_type key) const noexcept;
+
+        constexpr value_type const* data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_sparse_set& other) noexcept;
+        constexpr void clear() noexcept;
+
+        constexpr bool insert(size_type key) noexcept;
+        constexpr bool erase(size_type key) noexcept;
+        constexpr const_iterator erase(const_iterator pos) noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+    private:
+        statvec<value_type, N> dense_{};
+        std::array<value_type, N> sparse_{};
+
+        constexpr void erase_at(size_type i) noexcept;
+};
+
+template <std::size_t N>
+constexpr bool operator==(static_sparse_set<N> const& lhs, static_sparse_set<N> const& rhs) noexcept;
+template <std::size_t N>
+constexpr bool operator!=(static_sparse_set<N> const& lhs, static_sparse_set<N> const& rhs) noexcept;
+
+template <std::size_t N>
+constexpr bool static_sparse_set<N>::contains(size_type key) const noexcept {
+    return index_of(key) != size();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::size_type static_sparse_set<N>::count(size_type key) const noexcept {
+    return contains(key);
+}
+
+/* Position of key in the dense array, or size() if it is not a member */
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::size_type static_sparse_set<N>::index_of(size_type key) const noexcept {
+    if(key >= N) {
+        return size();
+    }
+    size_type const i = sparse_[key];
+    return i < size() && dense_[i] == key ? i : size();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::value_type const* static_sparse_set<N>::data() const noexcept {
+    return dense_.data();
+}
+
+template <std::size_t N>
+constexpr bool static_sparse_set<N>::empty() const noexcept {
+    return dense_.empty();
+}
+
+template <std::size_t N>
+constexpr bool static_sparse_set<N>::full() const noexcept {
+    return size() == capacity();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::size_type static_sparse_set<N>::size() const noexcept {
+    return dense_.size();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::size_type static_sparse_set<N>::max_size() const noexcept {
+    return capacity();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::size_type static_sparse_set<N>::capacity() const noexcept {
+    return N;
+}
+
+template <std::size_t N>
+constexpr void static_sparse_set<N>::swap(static_sparse_set& other) noexcept {
+    dense_.swap(other.dense_);
+    sparse_.swap(other.sparse_);
+}
+
+template <std::size_t N>
+constexpr void static_sparse_set<N>::clear() noexcept {
+    dense_.clear();
+}
+
+/* Returns false if key is already a member or outside [0, N) */
+template <std::size_t N>
+constexpr bool static_sparse_set<N>::insert(size_type key) noexcept {
+    if(key >= N || contains(key)) {
+        return false;
+    }
+    sparse_[key] = static_cast<value_type>(size());
+    dense_.push_back(static_cast<value_type>(key));
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool static_sparse_set<N>::erase(size_type key) noexcept {
+    auto const i = index_of(key);
+    if(i == size()) {
+        return false;
+    }
+    erase_at(i);
+    return true;
+}
+
+/* Returns an iterator to the member moved into the hole, or end() */
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::const_iterator static_sparse_set<N>::erase(const_iterator pos) noexcept {
+    auto const i = static_cast<size_type>(pos - cbegin());
+    erase_at(i);
+    return cbegin() + static_cast<difference_type>(i);
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::const_iterator static_sparse_set<N>::begin() const noexcept {
+    return cbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::const_iterator static_sparse_set<N>::end() const noexcept {
+    return cend();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::const_iterator static_sparse_set<N>::cbegin() const noexcept {
+    return dense_.cbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_sparse_set<N>::const_iterator static_sparse_set<N>::cend() const noexcept {
+    return dense_.cend();
+}
+
+/* Moves the last member into the hole */
+template <std::size_t N>
+constexpr void static_sparse_set<N>::erase_at(size_type i) noexcept {
+    auto const last = dense_[size() - 1u];
+    dense_[i] = last;
+    sparse_[last] = static_cast<value_type>(i);
+    dense_.resize(size() - 1u);
+}
+
+template <std::size_t N>
+constexpr bool operator==(static_sparse_set<N> const& lhs, static_sparse_set<N> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(auto key : lhs) {
+        if(!rhs.contains(key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool operator!=(static_sparse_set<N> const& lhs, static_sparse_set<N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* STATIC_SPARSE_SET_H */
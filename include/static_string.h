@@ -0,0 +1,710 @@
+#ifndef STATIC_STRING_H
+#define STATIC_STRING_H
+
+#include "statvec.h"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+template <std::size_t N>
+class static_string;
+
+namespace detail {
+
+/* Copies n characters between non-overlapping ranges */
+constexpr void string_copy(char* dst, char const* src, std::size_t n) noexcept;
+/* Copies n characters between ranges of the same buffer that may overlap */
+constexpr void string_move(char* dst, char const* src, std::size_t n) noexcept;
+
+#ifdef __SSE2__
+/* Number of characters compared per instruction when searching */
+#if defined(__AVX2__)
+inline std::size_t constexpr simd_string_width = 32u;
+#else
+inline std::size_t constexpr simd_string_width = 16u;
+#endif
+
+inline std::uint32_t simd_char_mask(char const* data, char ch) noexcept;
+inline std::size_t simd_find(char const* data, std::size_t size, std::string_view needle, std::size_t pos) noexcept;
+#endif
+
+} // namespace detail
+
+/* Fixed-capacity string of up to N characters, stored in a statvec<char, N + 1> so that the characters are always
+ * followed by a null terminator. Operations that would exceed the capacity return false and leave the string
+ * unchanged. Substring searches compare a vector of characters per instruction where SSE2 or AVX2 is available */
+template <std::size_t N>
+class static_string {
+    using buffer_type = statvec<char, N + 1u>;
+
+    public:
+        using value_type             = char;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = char&;
+        using const_reference        = char const&;
+        using pointer                = char*;
+        using const_pointer          = char const*;
+
+        using iterator               = typename buffer_type::iterator;
+        using const_iterator         = typename buffer_type::const_iterator;
+        using reverse_iterator       = typename buffer_type::reverse_iterator;
+        using const_reverse_iterator = typename buffer_type::const_reverse_iterator;
+
+        static size_type constexpr npos = std::string_view::npos;
+
+        constexpr static_string() noexcept = default;
+        template <std::size_t M>
+        constexpr static_string(char const (&str)[M]) noexcept;
+        constexpr explicit static_string(std::string_view str);
+
+        constexpr static_string(static_string const& other) noexcept = default;
+        constexpr static_string(static_string&& other) noexcept = default;
+
+        constexpr static_string& operator=(static_string const& other) & noexcept;
+        constexpr static_string& operator=(static_string&& other) & noexcept;
+
+        constexpr operator std::string_view() const noexcept;
+        constexpr std::string_view view() const noexcept;
+        constexpr char const* c_str() const noexcept;
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        constexpr pointer data() noexcept;
+        constexpr const_pointer data() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type length() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(static_string& other) noexcept;
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size, char ch = '\0') noexcept;
+
+        constexpr bool assign(std::string_view str) noexcept;
+        constexpr bool append(std::string_view str) noexcept;
+        constexpr bool append(size_type count, char ch) noexcept;
+        constexpr bool push_back(char ch) noexcept;
+        constexpr void pop_back() noexcept;
+
+        constexpr bool insert(size_type pos, std::string_view str) noexcept;
+        constexpr bool insert(size_type pos, size_type count, char ch) noexcept;
+        constexpr bool replace(size_type pos, size_type count, std::string_view str) noexcept;
+        constexpr static_string& erase(size_type pos = 0u, size_type count = npos) noexcept;
+
+        template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+        bool append_number(T value, int base = 10) noexcept;
+        template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>, typename = void>
+        bool append_number(T value) noexcept;
+        template <typename T>
+        std::from_chars_result parse_number(T& value, size_type pos = 0u) const noexcept;
+
+        constexpr size_type find(std::string_view str, size_type pos = 0u) const noexcept;
+        constexpr size_type find(char ch, size_type pos = 0u) const noexcept;
+        constexpr size_type rfind(std::string_view str, size_type pos = npos) const noexcept;
+        constexpr bool contains(std::string_view str) const noexcept;
+        constexpr bool starts_with(std::string_view str) const noexcept;
+        constexpr bool ends_with(std::string_view str) const noexcept;
+        constexpr int compare(std::string_view str) const noexcept;
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        buffer_type buf_{};
+
+        constexpr void set_size(size_type size) noexcept;
+        constexpr size_type offset_of(char const* ptr) const noexcept;
+};
+
+template <std::size_t M>
+static_string(char const (&)[M]) -> static_string<M - 1u>;
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator==(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+template <std::size_t N, std::size_t M>
+constexpr bool operator!=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+template <std::size_t N, std::size_t M>
+constexpr bool operator<(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+template <std::size_t N, std::size_t M>
+constexpr bool operator>(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+template <std::size_t N, std::size_t M>
+constexpr bool operator<=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+template <std::size_t N, std::size_t M>
+constexpr bool operator>=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept;
+
+template <std::size_t N>
+constexpr bool operator==(static_string<N> const& lhs, std::string_view rhs) noexcept;
+template <std::size_t N>
+constexpr bool operator==(std::string_view lhs, static_string<N> const& rhs) noexcept;
+template <std::size_t N>
+constexpr bool operator!=(static_string<N> const& lhs, std::string_view rhs) noexcept;
+template <std::size_t N>
+constexpr bool operator!=(std::string_view lhs, static_string<N> const& rhs) noexcept;
+
+namespace detail {
+
+constexpr void string_copy(char* dst, char const* src, std::size_t n) noexcept {
+    if(!__builtin_is_constant_evaluated()) {
+        if(n) {
+            std::memcpy(dst, src, n);
+        }
+        return;
+    }
+    for(std::size_t i = 0u; i < n; i++) {
+        dst[i] = src[i];
+    }
+}
+
+constexpr void string_move(char* dst, char const* src, std::size_t n) noexcept {
+    if(!__builtin_is_constant_evaluated()) {
+        if(n) {
+            std::memmove(dst, src, n);
+        }
+        return;
+    }
+    if(dst < src) {
+        for(std::size_t i = 0u; i < n; i++) {
+            dst[i] = src[i];
+        }
+    }
+    else {
+        for(std::size_t i = n; i > 0u; i--) {
+            dst[i - 1u] = src[i - 1u];
+        }
+    }
+}
+
+#ifdef __SSE2__
+/* Bit i is set if data[i] == ch, for the simd_string_width characters at data */
+inline std::uint32_t simd_char_mask(char const* data, char ch) noexcept {
+#ifdef __AVX2__
+    auto const chars = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(ch))));
+#else
+    auto const chars = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(ch))));
+#endif
+}
+
+/* Candidate positions are those where both the first and the last character of the needle match, found a vector at
+ * a time, and only those are compared in full. Expects a needle of at least two characters */
+inline std::size_t simd_find(char const* data, std::size_t size, std::string_view needle, std::size_t pos) noexcept {
+    auto const last = needle.size() - 1u;
+    for(; pos + last + simd_string_width <= size; pos += simd_string_width) {
+        auto mask = simd_char_mask(data + pos, needle[0]) & simd_char_mask(data + pos + last, needle[last]);
+        while(mask) {
+            auto const candidate = pos + static_cast<std::size_t>(__builtin_ctz(mask));
+            if(!std::memcmp(data + candidate + 1u, needle.data() + 1u, last - 1u)) {
+                return candidate;
+            }
+            mask &= mask - 1u;
+        }
+    }
+    return std::string_view{data, size}.find(needle, pos);
+}
+#endif
+
+} // namespace detail
+
+template <std::size_t N>
+template <std::size_t M>
+constexpr static_string<N>::static_string(char const (&str)[M]) noexcept {
+    static_assert(M - 1u <= N, "string literal exceeds the capacity");
+    detail::string_copy(buf_.data(), str, M - 1u);
+    set_size(M - 1u);
+}
+
+/* Throws std::length_error if str is longer than N */
+template <std::size_t N>
+constexpr static_string<N>::static_string(std::string_view str) {
+    if(!assign(str)) {
+        throw std::length_error("String of length " + std::to_string(str.size()) + " exceeds capacity " + std::to_string(N));
+    }
+}
+
+template <std::size_t N>
+constexpr static_string<N>::operator std::string_view() const noexcept {
+    return view();
+}
+
+template <std::size_t N>
+constexpr std::string_view static_string<N>::view() const noexcept {
+    return std::string_view{buf_.data(), buf_.size()};
+}
+
+template <std::size_t N>
+constexpr char const* static_string<N>::c_str() const noexcept {
+    return buf_.data();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reference static_string<N>::operator[](size_type i) noexcept {
+    return buf_[i];
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reference static_string<N>::operator[](size_type i) const noexcept {
+    return buf_[i];
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reference static_string<N>::at(size_type i) {
+    return buf_.at(i);
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reference static_string<N>::at(size_type i) const {
+    return buf_.at(i);
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reference static_string<N>::front() noexcept {
+    return buf_.front();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reference static_string<N>::front() const noexcept {
+    return buf_.front();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reference static_string<N>::back() noexcept {
+    return buf_.back();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reference static_string<N>::back() const noexcept {
+    return buf_.back();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::pointer static_string<N>::data() noexcept {
+    return buf_.data();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_pointer static_string<N>::data() const noexcept {
+    return buf_.data();
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::empty() const noexcept {
+    return buf_.empty();
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::full() const noexcept {
+    return buf_.size() == N;
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::size() const noexcept {
+    return buf_.size();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::length() const noexcept {
+    return buf_.size();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::max_size() const noexcept {
+    return N;
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::capacity() const noexcept {
+    return N;
+}
+
+/* The buffer's own assignment copies only size() characters, leaving the terminator behind for long strings */
+template <std::size_t N>
+constexpr static_string<N>& static_string<N>::operator=(static_string const& other) & noexcept {
+    assign(other.view());
+    return *this;
+}
+
+template <std::size_t N>
+constexpr static_string<N>& static_string<N>::operator=(static_string&& other) & noexcept {
+    assign(other.view());
+    return *this;
+}
+
+template <std::size_t N>
+constexpr void static_string<N>::swap(static_string& other) noexcept {
+    buf_.swap(other.buf_);
+}
+
+template <std::size_t N>
+constexpr void static_string<N>::clear() noexcept {
+    set_size(0u);
+}
+
+/* Truncates or pads with ch to size characters. Returns false if size exceeds N */
+template <std::size_t N>
+constexpr bool static_string<N>::resize(size_type size, char ch) noexcept {
+    if(size > N) {
+        return false;
+    }
+    for(auto i = this->size(); i < size; i++) {
+        buf_.data()[i] = ch;
+    }
+    set_size(size);
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::assign(std::string_view str) noexcept {
+    if(str.size() > N) {
+        return false;
+    }
+    if(offset_of(str.data()) == npos) {
+        detail::string_copy(buf_.data(), str.data(), str.size());
+    }
+    else {
+        detail::string_move(buf_.data(), str.data(), str.size());
+    }
+    set_size(str.size());
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::append(std::string_view str) noexcept {
+    return replace(size(), 0u, str);
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::append(size_type count, char ch) noexcept {
+    return insert(size(), count, ch);
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::push_back(char ch) noexcept {
+    if(full()) {
+        return false;
+    }
+    buf_.data()[size()] = ch;
+    set_size(size() + 1u);
+    return true;
+}
+
+template <std::size_t N>
+constexpr void static_string<N>::pop_back() noexcept {
+    set_size(size() - 1u);
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::insert(size_type pos, std::string_view str) noexcept {
+    return replace(pos, 0u, str);
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::insert(size_type pos, size_type count, char ch) noexcept {
+    if(count > N - size()) {
+        return false;
+    }
+    auto* const chars = buf_.data();
+    detail::string_move(chars + pos + count, chars + pos, size() - pos);
+    for(size_type i = 0u; i < count; i++) {
+        chars[pos + i] = ch;
+    }
+    set_size(size() + count);
+    return true;
+}
+
+/* Replaces the up to count characters at pos with str, which may be a view of this string. Returns false if the
+ * result would exceed N characters */
+template <std::size_t N>
+constexpr bool static_string<N>::replace(size_type pos, size_type count, std::string_view str) noexcept {
+    count = count < size() - pos ? count : size() - pos;
+    auto const length = str.size();
+    if(length > N - size() + count) {
+        return false;
+    }
+    auto* const chars = buf_.data();
+    auto const source = offset_of(str.data());
+    auto const tail = size() - pos - count;
+    if(length <= count) {
+        if(source == npos) {
+            detail::string_copy(chars + pos, str.data(), length);
+        }
+        else {
+            detail::string_move(chars + pos, chars + source, length);
+        }
+        detail::string_move(chars + pos + length, chars + pos + count, tail);
+    }
+    else {
+        detail::string_move(chars + pos + length, chars + pos + count, tail);
+        if(source == npos) {
+            detail::string_copy(chars + pos, str.data(), length);
+        }
+        else {
+            /* The part of str before the replaced range stayed put, the part after it moved with the tail */
+            auto const before = source < pos + count ? (length < pos + count - source ? length : pos + count - source) : 0u;
+            detail::string_move(chars + pos, chars + source, before);
+            detail::string_move(chars + pos + before, chars + source + before + length - count, length - before);
+        }
+    }
+    set_size(size() - count + length);
+    return true;
+}
+
+template <std::size_t N>
+constexpr static_string<N>& static_string<N>::erase(size_type pos, size_type count) noexcept {
+    count = count < size() - pos ? count : size() - pos;
+    detail::string_move(buf_.data() + pos, buf_.data() + pos + count, size() - pos - count);
+    set_size(size() - count);
+    return *this;
+}
+
+/* Appends value as formatted by std::to_chars in the given base. Returns false if it does not fit */
+template <std::size_t N>
+template <typename T, typename>
+bool static_string<N>::append_number(T value, int base) noexcept {
+    auto const result = std::to_chars(buf_.data() + size(), buf_.data() + N, value, base);
+    if(result.ec != std::errc{}) {
+        buf_.data()[size()] = '\0';
+        return false;
+    }
+    set_size(static_cast<size_type>(result.ptr - buf_.data()));
+    return true;
+}
+
+/* Appends the shortest representation of value that std::from_chars reads back exactly */
+template <std::size_t N>
+template <typename T, typename, typename>
+bool static_string<N>::append_number(T value) noexcept {
+    auto const result = std::to_chars(buf_.data() + size(), buf_.data() + N, value);
+    if(result.ec != std::errc{}) {
+        buf_.data()[size()] = '\0';
+        return false;
+    }
+    set_size(static_cast<size_type>(result.ptr - buf_.data()));
+    return true;
+}
+
+/* Parses a number starting at pos with std::from_chars, base 10 for integers */
+template <std::size_t N>
+template <typename T>
+std::from_chars_result static_string<N>::parse_number(T& value, size_type pos) const noexcept {
+    return std::from_chars(buf_.data() + pos, buf_.data() + size(), value);
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::find(std::string_view str, size_type pos) const noexcept {
+#ifdef __SSE2__
+    if(!__builtin_is_constant_evaluated() && str.size() > 1u) {
+        return pos < size() ? detail::simd_find(buf_.data(), size(), str, pos) : npos;
+    }
+#endif
+    if(str.size() == 1u) {
+        return find(str[0], pos);
+    }
+    return view().find(str, pos);
+}
+
+/* std::string_view defers to memchr, which is already vectorized */
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::find(char ch, size_type pos) const noexcept {
+    return view().find(ch, pos);
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::rfind(std::string_view str, size_type pos) const noexcept {
+    return view().rfind(str, pos);
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::contains(std::string_view str) const noexcept {
+    return find(str) != npos;
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::starts_with(std::string_view str) const noexcept {
+    return size() >= str.size() && view().substr(0u, str.size()) == str;
+}
+
+template <std::size_t N>
+constexpr bool static_string<N>::ends_with(std::string_view str) const noexcept {
+    return size() >= str.size() && view().substr(size() - str.size()) == str;
+}
+
+template <std::size_t N>
+constexpr int static_string<N>::compare(std::string_view str) const noexcept {
+    return view().compare(str);
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::iterator static_string<N>::begin() noexcept {
+    return buf_.begin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::iterator static_string<N>::end() noexcept {
+    return buf_.end();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_iterator static_string<N>::begin() const noexcept {
+    return buf_.begin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_iterator static_string<N>::end() const noexcept {
+    return buf_.end();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_iterator static_string<N>::cbegin() const noexcept {
+    return buf_.cbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_iterator static_string<N>::cend() const noexcept {
+    return buf_.cend();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reverse_iterator static_string<N>::rbegin() noexcept {
+    return buf_.rbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::reverse_iterator static_string<N>::rend() noexcept {
+    return buf_.rend();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reverse_iterator static_string<N>::rbegin() const noexcept {
+    return buf_.rbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reverse_iterator static_string<N>::rend() const noexcept {
+    return buf_.rend();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reverse_iterator static_string<N>::crbegin() const noexcept {
+    return buf_.crbegin();
+}
+
+template <std::size_t N>
+constexpr typename static_string<N>::const_reverse_iterator static_string<N>::crend() const noexcept {
+    return buf_.crend();
+}
+
+/* Sets the length and writes the null terminator after it */
+template <std::size_t N>
+constexpr void static_string<N>::set_size(size_type size) noexcept {
+    buf_.resize(size);
+    buf_.data()[size] = '\0';
+}
+
+/* Offset of ptr into the characters of this string, or npos if it points elsewhere */
+template <std::size_t N>
+constexpr typename static_string<N>::size_type static_string<N>::offset_of(char const* ptr) const noexcept {
+    if(!__builtin_is_constant_evaluated()) {
+        std::less_equal<char const*> const before{};
+        return before(buf_.data(), ptr) && before(ptr, buf_.data() + size()) ? static_cast<size_type>(ptr - buf_.data()) : npos;
+    }
+    for(size_type i = 0u; i <= size(); i++) {
+        if(buf_.data() + i == ptr) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator==(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return lhs.view() == rhs.view();
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator!=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator<(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return lhs.view() < rhs.view();
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator>(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return rhs < lhs;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator<=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return !(rhs < lhs);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator>=(static_string<N> const& lhs, static_string<M> const& rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template <std::size_t N>
+constexpr bool operator==(static_string<N> const& lhs, std::string_view rhs) noexcept {
+    return lhs.view() == rhs;
+}
+
+template <std::size_t N>
+constexpr bool operator==(std::string_view lhs, static_string<N> const& rhs) noexcept {
+    return lhs == rhs.view();
+}
+
+template <std::size_t N>
+constexpr bool operator!=(static_string<N> const& lhs, std::string_view rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+constexpr bool operator!=(std::string_view lhs, static_string<N> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* STATIC_STRING_H */
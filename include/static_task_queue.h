@@ -0,0 +1,208 @@
+#ifndef STATIC_TASK_QUEUE_H
+#define STATIC_TASK_QUEUE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+
+/* Prefix of every record in a static_task_queue, the callable follows at the next address aligned for it */
+struct task_header {
+    void (*run)(task_header*);
+    void (*destroy)(task_header*) noexcept;
+    std::size_t size;
+};
+
+inline std::size_t constexpr align_up(std::size_t offset, std::size_t alignment) noexcept {
+    return (offset + alignment - 1u) & ~(alignment - 1u);
+}
+
+template <typename F>
+void* task_storage(task_header* header) noexcept {
+    auto const address = reinterpret_cast<std::uintptr_t>(header) + sizeof(task_header);
+    return reinterpret_cast<void*>(align_up(address, alignof(F)));
+}
+
+template <typename F>
+void task_run(task_header* header) {
+    (*std::launder(static_cast<F*>(task_storage<F>(header))))();
+}
+
+template <typename F>
+void task_destroy(task_header* header) noexcept {
+    std::launder(static_cast<F*>(task_storage<F>(header)))->~F();
+}
+
+} // namespace detail
+
+/* First in, first out queue of type-erased callables, stored inline in a ring of Bytes bytes aligned to Align. Each
+ * task is one record, a header holding its run and destroy functions and its record size, followed by the callable.
+ * Records never straddle the end of the ring, a record that does not fit before the end starts over at offset 0.
+ * Nothing is allocated and tasks are never moved once emplaced */
+template <std::size_t Bytes, std::size_t Align = alignof(std::max_align_t)>
+class static_task_queue {
+    static_assert(Align >= alignof(detail::task_header) && !(Align & (Align - 1u)));
+    static_assert(Bytes >= sizeof(detail::task_header) && !(Bytes % alignof(detail::task_header)));
+
+    public:
+        using size_type = std::size_t;
+
+        static_task_queue() noexcept = default;
+        static_task_queue(static_task_queue const&) = delete;
+        static_task_queue& operator=(static_task_queue const&) = delete;
+
+        ~static_task_queue();
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type bytes_used() const noexcept;
+        size_type byte_capacity() const noexcept;
+
+        template <typename F>
+        bool emplace(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>);
+
+        bool run_one();
+        size_type run_all();
+
+        void clear() noexcept;
+
+    private:
+        alignas(Align) std::array<unsigned char, Bytes> buf_;
+        size_type head_{};
+        size_type tail_{};
+        size_type end_{};
+        size_type size_{};
+        bool wrapped_{};
+
+        template <typename F>
+        static constexpr size_type record_size(size_type offset) noexcept;
+        detail::task_header* header(size_type offset) noexcept;
+        void pop() noexcept;
+};
+
+template <std::size_t Bytes, std::size_t Align>
+static_task_queue<Bytes, Align>::~static_task_queue() {
+    clear();
+}
+
+template <std::size_t Bytes, std::size_t Align>
+bool static_task_queue<Bytes, Align>::empty() const noexcept {
+    return !size_;
+}
+
+template <std::size_t Bytes, std::size_t Align>
+typename static_task_queue<Bytes, Align>::size_type static_task_queue<Bytes, Align>::size() const noexcept {
+    return size_;
+}
+
+/* Bytes taken by queued records, not counting the unused tail skipped when the ring wrapped */
+template <std::size_t Bytes, std::size_t Align>
+typename static_task_queue<Bytes, Align>::size_type static_task_queue<Bytes, Align>::bytes_used() const noexcept {
+    return wrapped_ ? end_ - head_ + tail_ : tail_ - head_;
+}
+
+template <std::size_t Bytes, std::size_t Align>
+typename static_task_queue<Bytes, Align>::size_type static_task_queue<Bytes, Align>::byte_capacity() const noexcept {
+    return Bytes;
+}
+
+/* Constructs a decayed copy of f at the back of the queue. Returns false, leaving f untouched, if its record does not
+ * fit in the free part of the ring */
+template <std::size_t Bytes, std::size_t Align>
+template <typename F>
+bool static_task_queue<Bytes, Align>::emplace(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>) {
+    using callable_type = std::decay_t<F>;
+    static_assert(std::is_invocable_v<callable_type&>);
+    static_assert(alignof(callable_type) <= Align && record_size<callable_type>(0u) <= Bytes);
+    auto offset = tail_;
+    auto const limit = wrapped_ ? head_ : Bytes;
+    if(offset + record_size<callable_type>(offset) > limit) {
+        if(wrapped_ || record_size<callable_type>(0u) > head_) {
+            return false;
+        }
+        offset = 0u;
+    }
+    auto* const record = reinterpret_cast<detail::task_header*>(buf_.data() + offset);
+    ::new(detail::task_storage<callable_type>(record)) callable_type(std::forward<F>(f));
+    ::new(static_cast<void*>(record))
+        detail::task_header{&detail::task_run<callable_type>, &detail::task_destroy<callable_type>, record_size<callable_type>(offset)};
+    if(offset != tail_) {
+        end_ = tail_;
+        wrapped_ = true;
+    }
+    tail_ = offset + header(offset)->size;
+    ++size_;
+    return true;
+}
+
+/* Runs and destroys the task at the front. Returns false if the queue is empty. The task may emplace further tasks
+ * while it runs, and is destroyed and removed even if it throws */
+template <std::size_t Bytes, std::size_t Align>
+bool static_task_queue<Bytes, Align>::run_one() {
+    if(!size_) {
+        return false;
+    }
+    struct guard {
+        static_task_queue& queue;
+        ~guard() {
+            auto* const record = queue.header(queue.head_);
+            record->destroy(record);
+            queue.pop();
+        }
+    } const pop_guard{*this};
+    auto* const record = header(head_);
+    record->run(record);
+    return true;
+}
+
+/* Runs the tasks queued at the time of the call, in order, and returns how many ran. Tasks emplaced by them are left
+ * for the next call */
+template <std::size_t Bytes, std::size_t Align>
+typename static_task_queue<Bytes, Align>::size_type static_task_queue<Bytes, Align>::run_all() {
+    auto const count = size_;
+    for(size_type i = 0u; i < count; i++) {
+        run_one();
+    }
+    return count;
+}
+
+/* Destroys all tasks without running them */
+template <std::size_t Bytes, std::size_t Align>
+void static_task_queue<Bytes, Align>::clear() noexcept {
+    while(size_) {
+        auto* const record = header(head_);
+        record->destroy(record);
+        pop();
+    }
+}
+
+template <std::size_t Bytes, std::size_t Align>
+template <typename F>
+constexpr typename static_task_queue<Bytes, Align>::size_type static_task_queue<Bytes, Align>::record_size(size_type offset) noexcept {
+    auto const start = detail::align_up(offset + sizeof(detail::task_header), alignof(F));
+    return detail::align_up(start + sizeof(F), alignof(detail::task_header)) - offset;
+}
+
+template <std::size_t Bytes, std::size_t Align>
+detail::task_header* static_task_queue<Bytes, Align>::header(size_type offset) noexcept {
+    return std::launder(reinterpret_cast<detail::task_header*>(buf_.data() + offset));
+}
+
+template <std::size_t Bytes, std::size_t Align>
+void static_task_queue<Bytes, Align>::pop() noexcept {
+    head_ += header(head_)->size;
+    if(wrapped_ && head_ == end_) {
+        head_ = 0u;
+        wrapped_ = false;
+    }
+    if(!--size_) {
+        head_ = tail_ = 0u;
+        wrapped_ = false;
+    }
+}
+
+#endif /* STATIC_TASK_QUEUE_H */
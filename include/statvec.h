@@ -4,15 +4,27 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 template <typename T, std::size_t N>
 class statvec;
 
+template <typename T, std::size_t N>
+class static_devector;
+
+template <typename T, std::size_t N>
+class small_vector;
+
 namespace detail {
 
 template <typename Derived, typename Pointer>
@@ -59,6 +71,10 @@ class iterbase {
 
         template <typename, std::size_t>
         friend class ::statvec;
+        template <typename, std::size_t>
+        friend class ::static_devector;
+        template <typename, std::size_t>
+        friend class ::small_vector;
 };
 
 template <typename T>
@@ -142,6 +158,43 @@ struct const_iterator : iterbase<const_iterator<T>, typename T::const_pointer> {
     friend constexpr typename const_iterator<U>::difference_type operator-(const_iterator<U> const& lhs, const_iterator<U> const& rhs) noexcept;
 };
 
+/* Non-owning view of a contiguous range, standing in for C++20's std::span */
+template <typename T>
+class span {
+    public:
+        using element_type    = T;
+        using value_type      = std::remove_cv_t<T>;
+        using size_type       = std::size_t;
+        using reference       = T&;
+        using pointer         = T*;
+        using iterator        = T*;
+
+        constexpr span() noexcept = default;
+        constexpr span(T* data, size_type size) noexcept;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, T> && !std::is_same_v<U, T>>>
+        constexpr span(span<U> const& other) noexcept;
+
+        constexpr reference operator[](size_type i) const noexcept;
+        constexpr pointer data() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr bool empty() const noexcept;
+
+        constexpr iterator begin() const noexcept;
+        constexpr iterator end() const noexcept;
+
+    private:
+        T* data_{};
+        size_type size_{};
+};
+
+/* Holds the pair of references an iterator dereferences to, so that operator-> has an address to return */
+template <typename Reference>
+struct arrow_proxy {
+    Reference ref;
+
+    constexpr Reference const* operator->() const noexcept;
+};
+
 template <typename>
 struct is_std_array : std::false_type { };
 
@@ -184,6 +237,42 @@ inline bool constexpr is_input_iterator_v = is_input_iterator<T>::value;
 template <typename T, typename U = void>
 using enable_if_input_iterator_t = std::enable_if_t<is_input_iterator_v<T>, U>;
 
+inline std::size_t constexpr tiny_buffer_size = 64u;
+
+template <typename T, std::size_t N>
+inline bool constexpr is_tiny_v = std::is_trivially_copyable_v<T> && N * sizeof(T) <= tiny_buffer_size;
+
+template <typename T, std::size_t N>
+inline bool constexpr is_tiny_comparable_v = is_tiny_v<T, N> && (std::is_integral_v<T> || std::is_enum_v<T>);
+
+#ifndef STATVEC_STREAMING_THRESHOLD
+#define STATVEC_STREAMING_THRESHOLD 1048576u
+#endif
+
+inline std::size_t constexpr streaming_threshold = STATVEC_STREAMING_THRESHOLD;
+
+#ifdef __SSE2__
+template <typename T, std::size_t N>
+inline bool constexpr is_streamable_v = std::is_trivially_copyable_v<T> && N * sizeof(T) >= streaming_threshold;
+#else
+template <typename T, std::size_t N>
+inline bool constexpr is_streamable_v = false;
+#endif
+
+template <typename T>
+void stream_fill(T* dst, std::size_t count, T const& value) noexcept;
+template <typename T>
+void stream_copy(T* dst, T const* src, std::size_t count) noexcept;
+
+template <typename T, std::size_t N>
+constexpr void tiny_insert(std::array<T, N>& buf, std::size_t pos, T const& value) noexcept;
+template <typename T, std::size_t N>
+constexpr void tiny_erase(std::array<T, N>& buf, std::size_t pos, std::size_t count) noexcept;
+template <typename T, std::size_t N>
+constexpr bool tiny_equal(std::array<T, N> const& lhs, std::array<T, N> const& rhs, std::size_t size) noexcept;
+template <typename T, std::size_t N>
+constexpr std::size_t tiny_mismatch(std::array<T, N> const& lhs, std::array<T, N> const& rhs, std::size_t size) noexcept;
+
 } // namespace detail
 
 template <typename T, std::size_t N>
@@ -376,14 +465,38 @@ constexpr statvec<T, N>::statvec(std::array<T, M>&& array) noexcept(std::is_noth
 
 template <typename T, std::size_t N>
 constexpr statvec<T, N>& statvec<T, N>::operator=(statvec const& other) & noexcept(std::is_nothrow_copy_assignable_v<T>) {
-    std::copy(std::begin(other), std::end(other), std::begin(*this));
+    if constexpr(detail::is_tiny_v<T, N>) {
+        buf_ = other.buf_;
+    }
+    else {
+        if constexpr(detail::is_streamable_v<T, N>) {
+            if(!__builtin_is_constant_evaluated() && other.size_ * sizeof(T) >= detail::streaming_threshold) {
+                detail::stream_copy(buf_.data(), other.buf_.data(), other.size_);
+                size_ = other.size_;
+                return *this;
+            }
+        }
+        std::copy(std::begin(other), std::end(other), std::begin(*this));
+    }
     size_ = other.size_;
     return *this;
 }
 
 template <typename T, std::size_t N>
 constexpr statvec<T, N>& statvec<T, N>::operator=(statvec&& other) & noexcept(std::is_nothrow_move_assignable_v<T>) {
-    std::move(std::begin(other), std::end(other), std::begin(*this));
+    if constexpr(detail::is_tiny_v<T, N>) {
+        buf_ = other.buf_;
+    }
+    else {
+        if constexpr(detail::is_streamable_v<T, N>) {
+            if(!__builtin_is_constant_evaluated() && other.size_ * sizeof(T) >= detail::streaming_threshold) {
+                detail::stream_copy(buf_.data(), other.buf_.data(), other.size_);
+                size_ = other.size_;
+                return *this;
+            }
+        }
+        std::move(std::begin(other), std::end(other), std::begin(*this));
+    }
     size_ = other.size_;
     return *this;
 }
@@ -404,6 +517,14 @@ constexpr statvec<T, N>& statvec<T, N>::operator=(std::array<T, N>&& other) & no
 
 template <typename T, std::size_t N>
 constexpr bool statvec<T, N>::assign(size_type count, T const& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+    if constexpr(detail::is_streamable_v<T, N>) {
+        auto const size = std::min(count, capacity());
+        if(!__builtin_is_constant_evaluated() && size * sizeof(T) >= detail::streaming_threshold) {
+            detail::stream_fill(buf_.data(), size, value);
+            size_ = size;
+            return count <= capacity();
+        }
+    }
     if(count > capacity()) {
         for(size_ = 0u;  size_ < capacity(); ++size_) {
             buf_[size_] = value;
@@ -562,6 +683,12 @@ statvec<T, N>::insert(const_iterator pos, T const& value) noexcept(std::is_nothr
     if(size() == capacity()) {
         return end();
     }
+    if constexpr(detail::is_tiny_v<T, N>) {
+        size_type const i = std::distance(cbegin(), pos);
+        detail::tiny_insert(buf_, i, T{value});
+        ++size_;
+        return begin() + i;
+    }
     ++size_;
     auto it = begin() + std::distance(cbegin(), pos);
     std::move_backward(it, end(), end() + 1);
@@ -575,6 +702,12 @@ statvec<T, N>::insert(const_iterator pos, T&& value) noexcept(std::is_nothrow_mo
     if(size() == capacity()) {
         return end();
     }
+    if constexpr(detail::is_tiny_v<T, N>) {
+        size_type const i = std::distance(cbegin(), pos);
+        detail::tiny_insert(buf_, i, T{value});
+        ++size_;
+        return begin() + i;
+    }
     auto it = begin() + std::distance(cbegin(), pos);
     std::move_backward(it, end(), end() + 1);
     *it = std::move(value);
@@ -671,6 +804,12 @@ constexpr T statvec<T, N>::pop_back() noexcept(std::is_nothrow_copy_constructibl
 template <typename T, std::size_t N>
 constexpr typename statvec<T, N>::iterator
 statvec<T, N>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if constexpr(detail::is_tiny_v<T, N>) {
+        size_type const i = std::distance(cbegin(), pos);
+        detail::tiny_erase(buf_, i, 1u);
+        --size_;
+        return begin() + i;
+    }
     auto it = begin() + std::distance(cbegin(), pos);
     std::move(it + 1, end(), it);
     --size_;
@@ -680,6 +819,13 @@ statvec<T, N>::erase(const_iterator pos) noexcept(std::is_nothrow_move_assignabl
 template <typename T, std::size_t N>
 constexpr typename statvec<T, N>::iterator
 statvec<T, N>::erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if constexpr(detail::is_tiny_v<T, N>) {
+        size_type const i = std::distance(cbegin(), first);
+        size_type const count = std::distance(first, last);
+        detail::tiny_erase(buf_, i, count);
+        size_ -= count;
+        return begin() + i;
+    }
     auto dst = begin() + std::distance(cbegin(), first);
     auto src = begin() + std::distance(cbegin(), last);
     std::move(src, end(), dst);
@@ -766,6 +912,9 @@ constexpr std::array<T, M> statvec<T, N>::forward_array(Array&& array, std::inde
 
 template <typename T, std::size_t N, std::size_t M>
 constexpr bool operator==(statvec<T, N> const& lhs, statvec<T, M> const& rhs) noexcept {
+    if constexpr(N == M && detail::is_tiny_comparable_v<T, N>) {
+        return (lhs.size_ == rhs.size_) & detail::tiny_equal(lhs.buf_, rhs.buf_, lhs.size_);
+    }
     return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
 }
 
@@ -786,12 +935,17 @@ constexpr bool operator>=(statvec<T, N> const& lhs, statvec<T, M> const& rhs) no
 
 template <typename T, std::size_t N, std::size_t M>
 constexpr bool operator<(statvec<T, N> const& lhs, statvec<T, M> const& rhs) noexcept {
+    if constexpr(N == M && detail::is_tiny_comparable_v<T, N>) {
+        auto const size = std::min(lhs.size_, rhs.size_);
+        auto const i = detail::tiny_mismatch(lhs.buf_, rhs.buf_, size);
+        return i < size ? lhs.buf_[i] < rhs.buf_[i] : lhs.size_ < rhs.size_;
+    }
     return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
 }
 
 template <typename T, std::size_t N, std::size_t M>
 constexpr bool operator>(statvec<T, N> const& lhs, statvec<T, M> const& rhs) noexcept {
-    return std::lexicographical_compare(std::begin(rhs), std::end(rhs), std::begin(lhs), std::end(lhs));
+    return rhs < lhs;
 }
 
 template <std::size_t M, typename Vec>
@@ -801,6 +955,308 @@ template <std::size_t M, typename Vec>
 
 namespace detail {
 
+#ifdef __SSE2__
+/* Non-temporal stores bypass the cache hierarchy, keeping large bulk writes from evicting the
+ * working set of the rest of the program. They require 16-byte aligned destinations, so the
+ * unaligned head and tail are written using regular stores */
+inline std::size_t stream_head(unsigned char const* dst, std::size_t size) noexcept {
+    return std::min(size, (16u - reinterpret_cast<std::uintptr_t>(dst) % 16u) % 16u);
+}
+
+inline void stream_pattern(unsigned char* dst, unsigned char const (&pattern)[16], std::size_t size) noexcept {
+    auto const head = stream_head(dst, size);
+    std::memcpy(dst, pattern, head);
+
+    unsigned char rotated[16];
+    for(std::size_t i = 0u; i < sizeof(rotated); i++) {
+        rotated[i] = pattern[(i + head) % sizeof(rotated)];
+    }
+    __m128i const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(rotated));
+
+    std::size_t i = head;
+    for(; i + 16u <= size; i += 16u) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), chunk);
+    }
+    std::memcpy(dst + i, rotated, size - i);
+    _mm_sfence();
+}
+
+inline void stream_bytes(unsigned char* dst, unsigned char const* src, std::size_t size) noexcept {
+    auto const head = stream_head(dst, size);
+    std::memcpy(dst, src, head);
+
+    std::size_t i = head;
+    for(; i + 16u <= size; i += 16u) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i)));
+    }
+    std::memcpy(dst + i, src + i, size - i);
+    _mm_sfence();
+}
+
+template <typename T>
+void stream_fill(T* dst, std::size_t count, T const& value) noexcept {
+    if constexpr(16u % sizeof(T)) {
+        std::fill_n(dst, count, value);
+    }
+    else {
+        unsigned char pattern[16];
+        for(std::size_t i = 0u; i < sizeof(pattern); i += sizeof(T)) {
+            std::memcpy(pattern + i, &value, sizeof(T));
+        }
+        stream_pattern(reinterpret_cast<unsigned char*>(dst), pattern, count * sizeof(T));
+    }
+}
+
+template <typename T>
+void stream_copy(T* dst, T const* src, std::size_t count) noexcept {
+    stream_bytes(reinterpret_cast<unsigned char*>(dst), reinterpret_cast<unsigned char const*>(src), count * sizeof(T));
+}
+#endif
+
+/* The tiny kernels operate on the whole buffer at once. Element shifts are performed entirely in
+ * registers, either in a single 64-bit word or in 128-bit vectors, and then blended with the
+ * original contents using a byte mask. Keeping the shift in registers matters, as bouncing the
+ * buffer through the stack and reloading it at an element offset defeats store forwarding */
+template <typename T, std::size_t N>
+struct tiny_kernel {
+    static std::size_t constexpr bytes = N * sizeof(T);
+    static bool constexpr word = N > 1u && bytes <= 8u && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#ifdef __SSE2__
+    static bool constexpr simd = N > 1u && bytes % 16u == 0u;
+    static std::size_t constexpr lanes = bytes / 16u;
+    static std::size_t constexpr lane_shift = sizeof(T) / 16u;
+    static int constexpr byte_shift = sizeof(T) % 16u;
+#else
+    static bool constexpr simd = false;
+#endif
+    static bool constexpr enabled = word || simd;
+
+    static constexpr std::array<unsigned char, 2u * bytes> make_ramp() noexcept;
+
+    /* ramp + bytes - cut is a mask selecting the bytes at offsets >= cut */
+    static constexpr std::array<unsigned char, 2u * bytes> ramp = make_ramp();
+
+    static std::uint64_t word_mask(std::size_t cut) noexcept;
+    static std::uint64_t load_word(void const* src, std::size_t size = bytes) noexcept;
+    static void store_word(T* buf, std::uint64_t word) noexcept;
+
+#ifdef __SSE2__
+    template <typename F, std::size_t... Is>
+    static void unroll(F&& f, std::index_sequence<Is...>) noexcept;
+    static __m128i broadcast(T const& value) noexcept;
+    static __m128i mask(std::size_t cut, std::size_t lane) noexcept;
+#endif
+
+    static void insert(T* buf, std::size_t pos, T const& value) noexcept;
+    static void erase(T* buf, std::size_t pos, std::size_t count) noexcept;
+    static std::uint64_t mismatch_mask(T const* lhs, T const* rhs, std::size_t size) noexcept;
+};
+
+template <typename T, std::size_t N>
+constexpr std::array<unsigned char, 2u * tiny_kernel<T, N>::bytes> tiny_kernel<T, N>::make_ramp() noexcept {
+    std::array<unsigned char, 2u * bytes> ramp{};
+    for(std::size_t i = bytes; i < 2u * bytes; i++) {
+        ramp[i] = 0xffu;
+    }
+    return ramp;
+}
+
+template <typename T, std::size_t N>
+std::uint64_t tiny_kernel<T, N>::word_mask(std::size_t cut) noexcept {
+    /* Split in two to stay well-defined for cut == 8 */
+    return (~std::uint64_t{} << (4u * cut)) << (4u * cut);
+}
+
+template <typename T, std::size_t N>
+std::uint64_t tiny_kernel<T, N>::load_word(void const* src, std::size_t size) noexcept {
+    std::uint64_t word{};
+    std::memcpy(&word, src, size);
+    return word;
+}
+
+template <typename T, std::size_t N>
+void tiny_kernel<T, N>::store_word(T* buf, std::uint64_t word) noexcept {
+    std::memcpy(static_cast<void*>(buf), &word, bytes);
+}
+
+#ifdef __SSE2__
+template <typename T, std::size_t N>
+template <typename F, std::size_t... Is>
+void tiny_kernel<T, N>::unroll(F&& f, std::index_sequence<Is...>) noexcept {
+    (f(std::integral_constant<std::size_t, Is>{}), ...);
+}
+
+template <typename T, std::size_t N>
+__m128i tiny_kernel<T, N>::broadcast(T const& value) noexcept {
+    if constexpr(sizeof(T) == 1u) {
+        return _mm_set1_epi8(static_cast<char>(load_word(&value, 1u)));
+    }
+    else if constexpr(sizeof(T) == 2u) {
+        return _mm_set1_epi16(static_cast<short>(load_word(&value, 2u)));
+    }
+    else if constexpr(sizeof(T) == 4u) {
+        return _mm_set1_epi32(static_cast<int>(load_word(&value, 4u)));
+    }
+    else if constexpr(sizeof(T) == 8u) {
+        return _mm_set1_epi64x(static_cast<long long>(load_word(&value, 8u)));
+    }
+    else {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(&value));
+    }
+}
+
+template <typename T, std::size_t N>
+__m128i tiny_kernel<T, N>::mask(std::size_t cut, std::size_t lane) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(ramp.data() + bytes - cut) + lane);
+}
+#endif
+
+template <typename T, std::size_t N>
+void tiny_kernel<T, N>::insert(T* buf, std::size_t pos, T const& value) noexcept {
+    if constexpr(word) {
+        auto const src = load_word(buf);
+        auto const shifted = word_mask((pos + 1u) * sizeof(T));
+        auto const slot = word_mask(pos * sizeof(T)) & ~shifted;
+        auto const elem = load_word(&value, sizeof(T)) << (8u * pos * sizeof(T));
+        store_word(buf, ((src << (8u * sizeof(T))) & shifted) | (elem & slot) | (src & ~(shifted | slot)));
+    }
+#ifdef __SSE2__
+    else if constexpr(simd) {
+        /* The value is blended in directly when it can be broadcast to a whole vector */
+        bool constexpr fused = sizeof(T) <= 16u && !(16u % sizeof(T));
+        auto* const vec = reinterpret_cast<__m128i*>(buf);
+        __m128i src[lanes];
+        unroll([&](auto i) { src[i] = _mm_loadu_si128(vec + i); }, std::make_index_sequence<lanes>{});
+        __m128i elem{};
+        if constexpr(fused) {
+            elem = broadcast(value);
+        }
+        unroll([&](auto i) {
+            __m128i hi{};
+            if constexpr(i >= lane_shift) {
+                hi = _mm_slli_si128(src[i - lane_shift], byte_shift);
+            }
+            if constexpr(i >= lane_shift + 1u) {
+                hi = _mm_or_si128(hi, _mm_srli_si128(src[i - lane_shift - 1u], 16 - byte_shift));
+            }
+            __m128i const shifted = mask((pos + 1u) * sizeof(T), i);
+            __m128i res = _mm_or_si128(_mm_and_si128(shifted, hi), _mm_andnot_si128(shifted, src[i]));
+            if constexpr(fused) {
+                __m128i const slot = _mm_andnot_si128(shifted, mask(pos * sizeof(T), i));
+                res = _mm_or_si128(_mm_and_si128(slot, elem), _mm_andnot_si128(slot, res));
+            }
+            _mm_storeu_si128(vec + i, res);
+        }, std::make_index_sequence<lanes>{});
+        if constexpr(!fused) {
+            std::memcpy(static_cast<void*>(buf + pos), &value, sizeof(T));
+        }
+    }
+#endif
+}
+
+template <typename T, std::size_t N>
+void tiny_kernel<T, N>::erase(T* buf, std::size_t pos, std::size_t count) noexcept {
+    if constexpr(word) {
+        auto const src = load_word(buf);
+        auto const shift = 4u * count * sizeof(T);
+        auto const keep = word_mask(pos * sizeof(T));
+        store_word(buf, (((src >> shift) >> shift) & keep) | (src & ~keep));
+    }
+#ifdef __SSE2__
+    else if constexpr(simd) {
+        /* Vector byte shifts take immediate operands, callers only get here for count == 1 */
+        (void)count;
+        auto* const vec = reinterpret_cast<__m128i*>(buf);
+        __m128i src[lanes];
+        unroll([&](auto i) { src[i] = _mm_loadu_si128(vec + i); }, std::make_index_sequence<lanes>{});
+        unroll([&](auto i) {
+            __m128i lo{};
+            if constexpr(i + lane_shift < lanes) {
+                lo = _mm_srli_si128(src[i + lane_shift], byte_shift);
+            }
+            if constexpr(i + lane_shift + 1u < lanes) {
+                lo = _mm_or_si128(lo, _mm_slli_si128(src[i + lane_shift + 1u], 16 - byte_shift));
+            }
+            __m128i const shifted = mask(pos * sizeof(T), i);
+            _mm_storeu_si128(vec + i, _mm_or_si128(_mm_and_si128(shifted, lo), _mm_andnot_si128(shifted, src[i])));
+        }, std::make_index_sequence<lanes>{});
+    }
+#endif
+}
+
+template <typename T, std::size_t N>
+std::uint64_t tiny_kernel<T, N>::mismatch_mask(T const* lhs, T const* rhs, std::size_t size) noexcept {
+    std::uint64_t mask{};
+    if constexpr(word) {
+        auto const diff = load_word(lhs) ^ load_word(rhs);
+        for(std::size_t i = 0u; i < bytes; i++) {
+            mask |= std::uint64_t{((diff >> (8u * i)) & 0xffu) != 0u} << i;
+        }
+    }
+#ifdef __SSE2__
+    else if constexpr(simd) {
+        auto const* const l = reinterpret_cast<__m128i const*>(lhs);
+        auto const* const r = reinterpret_cast<__m128i const*>(rhs);
+        unroll([&](auto i) {
+            auto const eq = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(l + i), _mm_loadu_si128(r + i)));
+            mask |= std::uint64_t{~static_cast<unsigned>(eq) & 0xffffu} << (16u * i);
+        }, std::make_index_sequence<lanes>{});
+    }
+#endif
+    auto const valid = size * sizeof(T);
+    return valid < 64u ? mask & ((std::uint64_t{1u} << valid) - 1u) : mask;
+}
+
+template <typename T, std::size_t N>
+constexpr void tiny_insert(std::array<T, N>& buf, std::size_t pos, T const& value) noexcept {
+    if constexpr(tiny_kernel<T, N>::enabled) {
+        if(!__builtin_is_constant_evaluated()) {
+            tiny_kernel<T, N>::insert(buf.data(), pos, value);
+            return;
+        }
+    }
+    for(std::size_t i = N - 1u; i > pos; i--) {
+        buf[i] = buf[i - 1u];
+    }
+    buf[pos] = value;
+}
+
+template <typename T, std::size_t N>
+constexpr void tiny_erase(std::array<T, N>& buf, std::size_t pos, std::size_t count) noexcept {
+    if constexpr(tiny_kernel<T, N>::enabled) {
+        if(!__builtin_is_constant_evaluated() && (tiny_kernel<T, N>::word || count == 1u)) {
+            tiny_kernel<T, N>::erase(buf.data(), pos, count);
+            return;
+        }
+    }
+    for(std::size_t i = pos; i + count < N; i++) {
+        buf[i] = buf[i + count];
+    }
+}
+
+template <typename T, std::size_t N, std::size_t... Is>
+constexpr std::uint64_t tiny_mismatch_mask(std::array<T, N> const& lhs, std::array<T, N> const& rhs, std::size_t size, std::index_sequence<Is...>) noexcept {
+    std::uint64_t const valid = size < 64u ? (std::uint64_t{1u} << size) - 1u : ~std::uint64_t{};
+    return ((std::uint64_t{lhs[Is] != rhs[Is]} << Is) | ...) & valid;
+}
+
+template <typename T, std::size_t N>
+constexpr std::size_t tiny_mismatch(std::array<T, N> const& lhs, std::array<T, N> const& rhs, std::size_t size) noexcept {
+    if constexpr(tiny_kernel<T, N>::enabled) {
+        if(!__builtin_is_constant_evaluated()) {
+            auto const mask = tiny_kernel<T, N>::mismatch_mask(lhs.data(), rhs.data(), size);
+            return mask ? static_cast<std::size_t>(__builtin_ctzll(mask)) / sizeof(T) : N;
+        }
+    }
+    auto const mask = tiny_mismatch_mask(lhs, rhs, size, std::make_index_sequence<N>{});
+    return mask ? static_cast<std::size_t>(__builtin_ctzll(mask)) : N;
+}
+
+template <typename T, std::size_t N>
+constexpr bool tiny_equal(std::array<T, N> const& lhs, std::array<T, N> const& rhs, std::size_t size) noexcept {
+    return tiny_mismatch(lhs, rhs, size) == N;
+}
+
 template <typename T, typename P>
 constexpr iterbase<T, P>::iterbase(P ptr) noexcept
     : ptr_{ptr} { }
@@ -999,6 +1455,50 @@ constexpr typename const_iterator<T>::difference_type operator-(const_iterator<T
     return lhs.ptr_ - rhs.ptr_;
 }
 
+template <typename T>
+constexpr span<T>::span(T* data, size_type size) noexcept
+    : data_{data}, size_{size} { }
+
+template <typename T>
+template <typename U, typename>
+constexpr span<T>::span(span<U> const& other) noexcept
+    : data_{other.data()}, size_{other.size()} { }
+
+template <typename T>
+constexpr typename span<T>::reference span<T>::operator[](size_type i) const noexcept {
+    return data_[i];
+}
+
+template <typename T>
+constexpr typename span<T>::pointer span<T>::data() const noexcept {
+    return data_;
+}
+
+template <typename T>
+constexpr typename span<T>::size_type span<T>::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+constexpr bool span<T>::empty() const noexcept {
+    return !size_;
+}
+
+template <typename T>
+constexpr typename span<T>::iterator span<T>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T>
+constexpr typename span<T>::iterator span<T>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename Reference>
+constexpr Reference const* arrow_proxy<Reference>::operator->() const noexcept {
+    return &ref;
+}
+
 } // namespace detail
 
 #endif /* STATVEC_H */
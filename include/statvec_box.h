@@ -0,0 +1,138 @@
+#ifndef STATVEC_BOX_H
+#define STATVEC_BOX_H
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace detail {
+
+inline std::size_t constexpr huge_page_size = 2u << 20;
+inline std::size_t constexpr cache_line_size = 64u;
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+class statvec_box {
+    public:
+        using vector_type = statvec<T, N>;
+
+        static std::size_t constexpr alignment = sizeof(vector_type) >= detail::huge_page_size ? detail::huge_page_size
+                                                                                                : std::max(alignof(vector_type), detail::cache_line_size);
+        static std::size_t constexpr allocation_size = (sizeof(vector_type) + alignment - 1u) / alignment * alignment;
+
+        statvec_box();
+        statvec_box(statvec_box const&) = delete;
+        statvec_box(statvec_box&& other) noexcept;
+
+        statvec_box& operator=(statvec_box const&) = delete;
+        statvec_box& operator=(statvec_box&& other) & noexcept;
+
+        ~statvec_box();
+
+        vector_type& operator*() noexcept;
+        vector_type const& operator*() const noexcept;
+
+        vector_type* operator->() noexcept;
+        vector_type const* operator->() const noexcept;
+
+        vector_type* get() noexcept;
+        vector_type const* get() const noexcept;
+
+        explicit operator bool() const noexcept;
+
+        void swap(statvec_box& other) noexcept;
+
+    private:
+        vector_type* vec_{};
+
+        static void* allocate();
+};
+
+template <typename T, std::size_t N>
+statvec_box<T, N>::statvec_box()
+    : vec_{::new(allocate()) vector_type()} { }
+
+template <typename T, std::size_t N>
+statvec_box<T, N>::statvec_box(statvec_box&& other) noexcept
+    : vec_{std::exchange(other.vec_, nullptr)} { }
+
+template <typename T, std::size_t N>
+statvec_box<T, N>& statvec_box<T, N>::operator=(statvec_box&& other) & noexcept {
+    statvec_box{std::move(other)}.swap(*this);
+    return *this;
+}
+
+template <typename T, std::size_t N>
+statvec_box<T, N>::~statvec_box() {
+    if(vec_) {
+        vec_->~vector_type();
+        std::free(vec_);
+    }
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type& statvec_box<T, N>::operator*() noexcept {
+    return *vec_;
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type const& statvec_box<T, N>::operator*() const noexcept {
+    return *vec_;
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type* statvec_box<T, N>::operator->() noexcept {
+    return vec_;
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type const* statvec_box<T, N>::operator->() const noexcept {
+    return vec_;
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type* statvec_box<T, N>::get() noexcept {
+    return vec_;
+}
+
+template <typename T, std::size_t N>
+typename statvec_box<T, N>::vector_type const* statvec_box<T, N>::get() const noexcept {
+    return vec_;
+}
+
+template <typename T, std::size_t N>
+statvec_box<T, N>::operator bool() const noexcept {
+    return vec_;
+}
+
+template <typename T, std::size_t N>
+void statvec_box<T, N>::swap(statvec_box& other) noexcept {
+    std::swap(vec_, other.vec_);
+}
+
+template <typename T, std::size_t N>
+void* statvec_box<T, N>::allocate() {
+    void* mem = std::aligned_alloc(alignment, allocation_size);
+    if(!mem) {
+        throw std::bad_alloc{};
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if constexpr(alignment == detail::huge_page_size) {
+        /* Purely advisory, failure only means that the buffer is backed by regular pages */
+        ::madvise(mem, allocation_size, MADV_HUGEPAGE);
+    }
+#endif
+    return mem;
+}
+
+#endif /* STATVEC_BOX_H */
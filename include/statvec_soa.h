@@ -0,0 +1,743 @@
+#ifndef STATVEC_SOA_H
+#define STATVEC_SOA_H
+
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+class statvec_aosoa;
+
+namespace detail {
+
+/* One array of Block elements per field. A recursive aggregate rather than a std::tuple of arrays, which GCC fails to
+ * copy in constant expressions */
+template <std::size_t Block, typename... Ts>
+struct soa_block { };
+
+template <std::size_t Block, typename T, typename... Ts>
+struct soa_block<Block, T, Ts...> {
+    std::array<T, Block> head{};
+    soa_block<Block, Ts...> tail{};
+};
+
+template <std::size_t I, std::size_t Block, typename T, typename... Ts>
+constexpr auto& soa_column(soa_block<Block, T, Ts...>& block) noexcept;
+template <std::size_t I, std::size_t Block, typename T, typename... Ts>
+constexpr auto const& soa_column(soa_block<Block, T, Ts...> const& block) noexcept;
+
+/* Random access iterator over the rows of a statvec_aosoa, dereferencing to a tuple of references to the fields */
+template <typename Container>
+class soa_iterator {
+    public:
+        using value_type        = typename Container::value_type;
+        using reference         = std::conditional_t<std::is_const_v<Container>, typename Container::const_reference,
+                                                     typename Container::reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr soa_iterator() noexcept = default;
+        template <typename U, typename = std::enable_if_t<std::is_same_v<U const, Container> && !std::is_same_v<U, Container>>>
+        constexpr soa_iterator(soa_iterator<U> const& other) noexcept;
+
+        constexpr reference operator*() const noexcept;
+        constexpr reference operator[](difference_type i) const noexcept;
+
+        constexpr soa_iterator& operator++() noexcept;
+        constexpr soa_iterator operator++(int) noexcept;
+
+        constexpr soa_iterator& operator--() noexcept;
+        constexpr soa_iterator operator--(int) noexcept;
+
+        constexpr soa_iterator& operator+=(difference_type n) noexcept;
+        constexpr soa_iterator& operator-=(difference_type n) noexcept;
+
+        template <typename U>
+        friend constexpr bool operator==(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator!=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator<(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+        template <typename U>
+        friend constexpr bool operator>(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+
+        template <typename U>
+        friend constexpr soa_iterator<U> operator+(soa_iterator<U> const& it, typename soa_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr soa_iterator<U> operator+(typename soa_iterator<U>::difference_type n, soa_iterator<U> const& it) noexcept;
+        template <typename U>
+        friend constexpr soa_iterator<U> operator-(soa_iterator<U> const& it, typename soa_iterator<U>::difference_type n) noexcept;
+        template <typename U>
+        friend constexpr typename soa_iterator<U>::difference_type operator-(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept;
+
+    private:
+        Container* container_{};
+        difference_type index_{};
+
+        constexpr soa_iterator(Container* container, difference_type index) noexcept;
+
+        template <typename>
+        friend class soa_iterator;
+        template <std::size_t, std::size_t, typename...>
+        friend class ::statvec_aosoa;
+};
+
+} // namespace detail
+
+/* Fixed-capacity vector of rows of Ts..., stored field by field. The rows are grouped into blocks of Block rows, each
+ * block holding one array per field. With Block equal to N there is a single block and every field is one contiguous
+ * array, see statvec_soa. Smaller blocks keep the fields of nearby rows close together while still letting a loop over
+ * one block process each field with contiguous vector loads */
+template <std::size_t N, std::size_t Block, typename... Ts>
+class statvec_aosoa {
+    static_assert(sizeof...(Ts), "At least one field is required");
+    static_assert(N && Block && Block <= N);
+    static_assert((!std::is_reference_v<Ts> && ...));
+
+    static std::size_t constexpr blocks = (N + Block - 1u) / Block;
+    static bool constexpr nothrow_move = (std::is_nothrow_move_assignable_v<Ts> && ...);
+
+    using fields = std::index_sequence_for<Ts...>;
+
+    public:
+        template <std::size_t I>
+        using field_type             = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        using value_type             = std::tuple<Ts...>;
+        using reference              = std::tuple<Ts&...>;
+        using const_reference        = std::tuple<Ts const&...>;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+
+        using iterator               = detail::soa_iterator<statvec_aosoa>;
+        using const_iterator         = detail::soa_iterator<statvec_aosoa const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static size_type constexpr block_size = Block;
+
+        constexpr statvec_aosoa() noexcept((std::is_nothrow_default_constructible_v<Ts> && ...)) = default;
+
+        constexpr reference operator[](size_type i) noexcept;
+        constexpr const_reference operator[](size_type i) const noexcept;
+
+        constexpr reference at(size_type i);
+        constexpr const_reference at(size_type i) const;
+
+        constexpr reference front() noexcept;
+        constexpr const_reference front() const noexcept;
+
+        constexpr reference back() noexcept;
+        constexpr const_reference back() const noexcept;
+
+        template <std::size_t I>
+        constexpr field_type<I>& get(size_type i) noexcept;
+        template <std::size_t I>
+        constexpr field_type<I> const& get(size_type i) const noexcept;
+
+        template <std::size_t I>
+        constexpr detail::span<field_type<I>> field() noexcept;
+        template <std::size_t I>
+        constexpr detail::span<field_type<I> const> field() const noexcept;
+
+        template <std::size_t I>
+        constexpr detail::span<field_type<I>> field(size_type block) noexcept;
+        template <std::size_t I>
+        constexpr detail::span<field_type<I> const> field(size_type block) const noexcept;
+
+        template <std::size_t I>
+        constexpr std::array<field_type<I>, Block>& lanes(size_type block) noexcept;
+        template <std::size_t I>
+        constexpr std::array<field_type<I>, Block> const& lanes(size_type block) const noexcept;
+
+        constexpr size_type block_count() const noexcept;
+
+        constexpr bool empty() const noexcept;
+        constexpr bool full() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr size_type capacity() const noexcept;
+
+        constexpr void swap(statvec_aosoa& other) noexcept(nothrow_move);
+
+        constexpr void clear() noexcept;
+        constexpr bool resize(size_type size) noexcept;
+
+        template <typename... Us>
+        constexpr iterator insert(const_iterator pos, Us&&... values) noexcept(nothrow_move &&
+                                                                               (std::is_nothrow_assignable_v<Ts&, Us&&> && ...));
+        template <typename... Us>
+        constexpr bool push_back(Us&&... values) noexcept((std::is_nothrow_assignable_v<Ts&, Us&&> && ...));
+        constexpr value_type pop_back() noexcept((std::is_nothrow_copy_constructible_v<Ts> && ...));
+
+        constexpr iterator erase(const_iterator pos) noexcept(nothrow_move);
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept(nothrow_move);
+        constexpr iterator swap_remove(const_iterator pos) noexcept(nothrow_move);
+
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+        constexpr reverse_iterator rbegin() noexcept;
+        constexpr reverse_iterator rend() noexcept;
+
+        constexpr const_reverse_iterator rbegin() const noexcept;
+        constexpr const_reverse_iterator rend() const noexcept;
+
+        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept;
+
+    private:
+        std::array<detail::soa_block<Block, Ts...>, blocks> blocks_{};
+        size_type size_{};
+
+        template <std::size_t... Is>
+        constexpr reference row(size_type i, std::index_sequence<Is...>) noexcept;
+        template <std::size_t... Is>
+        constexpr const_reference row(size_type i, std::index_sequence<Is...>) const noexcept;
+
+        template <typename... Us, std::size_t... Is>
+        constexpr void assign_row(size_type i, std::index_sequence<Is...>, Us&&... values)
+            noexcept((std::is_nothrow_assignable_v<Ts&, Us&&> && ...));
+        template <std::size_t... Is>
+        constexpr void move_row(size_type to, size_type from, std::index_sequence<Is...>) noexcept(nothrow_move);
+        template <std::size_t... Is>
+        constexpr void swap_rows(statvec_aosoa& other, size_type i, std::index_sequence<Is...>) noexcept(nothrow_move);
+        template <std::size_t... Is>
+        constexpr bool equal_rows(statvec_aosoa const& other, size_type i, std::index_sequence<Is...>) const noexcept;
+
+        template <std::size_t M, std::size_t B, typename... Us>
+        friend constexpr bool operator==(statvec_aosoa<M, B, Us...> const& lhs, statvec_aosoa<M, B, Us...> const& rhs) noexcept;
+};
+
+template <std::size_t N, typename... Ts>
+using statvec_soa = statvec_aosoa<N, N, Ts...>;
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool operator==(statvec_aosoa<N, Block, Ts...> const& lhs, statvec_aosoa<N, Block, Ts...> const& rhs) noexcept;
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool operator!=(statvec_aosoa<N, Block, Ts...> const& lhs, statvec_aosoa<N, Block, Ts...> const& rhs) noexcept;
+
+namespace detail {
+
+template <std::size_t I, std::size_t Block, typename T, typename... Ts>
+constexpr auto& soa_column(soa_block<Block, T, Ts...>& block) noexcept {
+    if constexpr(I == 0u) {
+        return block.head;
+    }
+    else {
+        return soa_column<I - 1u>(block.tail);
+    }
+}
+
+template <std::size_t I, std::size_t Block, typename T, typename... Ts>
+constexpr auto const& soa_column(soa_block<Block, T, Ts...> const& block) noexcept {
+    if constexpr(I == 0u) {
+        return block.head;
+    }
+    else {
+        return soa_column<I - 1u>(block.tail);
+    }
+}
+
+template <typename Container>
+template <typename U, typename>
+constexpr soa_iterator<Container>::soa_iterator(soa_iterator<U> const& other) noexcept
+    : container_{other.container_}, index_{other.index_} { }
+
+template <typename Container>
+constexpr soa_iterator<Container>::soa_iterator(Container* container, difference_type index) noexcept
+    : container_{container}, index_{index} { }
+
+template <typename Container>
+constexpr typename soa_iterator<Container>::reference soa_iterator<Container>::operator*() const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_)];
+}
+
+template <typename Container>
+constexpr typename soa_iterator<Container>::reference soa_iterator<Container>::operator[](difference_type i) const noexcept {
+    return (*container_)[static_cast<std::size_t>(index_ + i)];
+}
+
+template <typename Container>
+constexpr soa_iterator<Container>& soa_iterator<Container>::operator++() noexcept {
+    ++index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr soa_iterator<Container> soa_iterator<Container>::operator++(int) noexcept {
+    auto const it = *this;
+    ++index_;
+    return it;
+}
+
+template <typename Container>
+constexpr soa_iterator<Container>& soa_iterator<Container>::operator--() noexcept {
+    --index_;
+    return *this;
+}
+
+template <typename Container>
+constexpr soa_iterator<Container> soa_iterator<Container>::operator--(int) noexcept {
+    auto const it = *this;
+    --index_;
+    return it;
+}
+
+template <typename Container>
+constexpr soa_iterator<Container>& soa_iterator<Container>::operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+}
+
+template <typename Container>
+constexpr soa_iterator<Container>& soa_iterator<Container>::operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+}
+
+template <typename U>
+constexpr bool operator==(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator!=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename U>
+constexpr bool operator<=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>=(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator<(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+}
+
+template <typename U>
+constexpr bool operator>(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+}
+
+template <typename U>
+constexpr soa_iterator<U> operator+(soa_iterator<U> const& it, typename soa_iterator<U>::difference_type n) noexcept {
+    return soa_iterator<U>{it.container_, it.index_ + n};
+}
+
+template <typename U>
+constexpr soa_iterator<U> operator+(typename soa_iterator<U>::difference_type n, soa_iterator<U> const& it) noexcept {
+    return it + n;
+}
+
+template <typename U>
+constexpr soa_iterator<U> operator-(soa_iterator<U> const& it, typename soa_iterator<U>::difference_type n) noexcept {
+    return soa_iterator<U>{it.container_, it.index_ - n};
+}
+
+template <typename U>
+constexpr typename soa_iterator<U>::difference_type operator-(soa_iterator<U> const& lhs, soa_iterator<U> const& rhs) noexcept {
+    return lhs.index_ - rhs.index_;
+}
+
+} // namespace detail
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reference statvec_aosoa<N, Block, Ts...>::operator[](size_type i) noexcept {
+    return row(i, fields{});
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reference statvec_aosoa<N, Block, Ts...>::operator[](size_type i) const noexcept {
+    return row(i, fields{});
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reference statvec_aosoa<N, Block, Ts...>::at(size_type i) {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reference statvec_aosoa<N, Block, Ts...>::at(size_type i) const {
+    using namespace std::string_literals;
+    if(i >= size()) {
+        throw std::out_of_range("Cannot access element at index"s + std::to_string(i));
+    }
+    return (*this)[i];
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reference statvec_aosoa<N, Block, Ts...>::front() noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reference statvec_aosoa<N, Block, Ts...>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reference statvec_aosoa<N, Block, Ts...>::back() noexcept {
+    return (*this)[size_ - 1u];
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reference statvec_aosoa<N, Block, Ts...>::back() const noexcept {
+    return (*this)[size_ - 1u];
+}
+
+/* Field I of row i */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr typename statvec_aosoa<N, Block, Ts...>::template field_type<I>& statvec_aosoa<N, Block, Ts...>::get(size_type i) noexcept {
+    if constexpr(blocks == 1u) {
+        return detail::soa_column<I>(blocks_[0])[i];
+    }
+    else {
+        return detail::soa_column<I>(blocks_[i / Block])[i % Block];
+    }
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr typename statvec_aosoa<N, Block, Ts...>::template field_type<I> const& statvec_aosoa<N, Block, Ts...>::get(size_type i) const noexcept {
+    if constexpr(blocks == 1u) {
+        return detail::soa_column<I>(blocks_[0])[i];
+    }
+    else {
+        return detail::soa_column<I>(blocks_[i / Block])[i % Block];
+    }
+}
+
+/* Field I of all rows, only available with a single block */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr detail::span<typename statvec_aosoa<N, Block, Ts...>::template field_type<I>> statvec_aosoa<N, Block, Ts...>::field() noexcept {
+    static_assert(blocks == 1u, "Fields are only contiguous across all rows with a single block, use field<I>(block)");
+    return field<I>(0u);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr detail::span<typename statvec_aosoa<N, Block, Ts...>::template field_type<I> const>
+statvec_aosoa<N, Block, Ts...>::field() const noexcept {
+    static_assert(blocks == 1u, "Fields are only contiguous across all rows with a single block, use field<I>(block)");
+    return field<I>(0u);
+}
+
+/* Field I of the rows in use in the given block, empty for blocks past block_count() */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr detail::span<typename statvec_aosoa<N, Block, Ts...>::template field_type<I>>
+statvec_aosoa<N, Block, Ts...>::field(size_type block) noexcept {
+    auto const first = block * Block;
+    auto const rows = first >= size_ ? 0u : size_ - first < Block ? size_ - first : Block;
+    return detail::span<field_type<I>>{detail::soa_column<I>(blocks_[block]).data(), rows};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr detail::span<typename statvec_aosoa<N, Block, Ts...>::template field_type<I> const>
+statvec_aosoa<N, Block, Ts...>::field(size_type block) const noexcept {
+    auto const first = block * Block;
+    auto const rows = first >= size_ ? 0u : size_ - first < Block ? size_ - first : Block;
+    return detail::span<field_type<I> const>{detail::soa_column<I>(blocks_[block]).data(), rows};
+}
+
+/* All Block lanes of field I in the given block, including those past size(). Loops over them have a trip count
+ * known at compile time, which lets the compiler vectorize them without a scalar remainder */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr std::array<typename statvec_aosoa<N, Block, Ts...>::template field_type<I>, Block>&
+statvec_aosoa<N, Block, Ts...>::lanes(size_type block) noexcept {
+    return detail::soa_column<I>(blocks_[block]);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t I>
+constexpr std::array<typename statvec_aosoa<N, Block, Ts...>::template field_type<I>, Block> const&
+statvec_aosoa<N, Block, Ts...>::lanes(size_type block) const noexcept {
+    return detail::soa_column<I>(blocks_[block]);
+}
+
+/* Number of blocks holding at least one row */
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::size_type statvec_aosoa<N, Block, Ts...>::block_count() const noexcept {
+    return (size_ + Block - 1u) / Block;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool statvec_aosoa<N, Block, Ts...>::empty() const noexcept {
+    return !size_;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool statvec_aosoa<N, Block, Ts...>::full() const noexcept {
+    return size_ == N;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::size_type statvec_aosoa<N, Block, Ts...>::size() const noexcept {
+    return size_;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::size_type statvec_aosoa<N, Block, Ts...>::max_size() const noexcept {
+    return capacity();
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::size_type statvec_aosoa<N, Block, Ts...>::capacity() const noexcept {
+    return N;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr void statvec_aosoa<N, Block, Ts...>::swap(statvec_aosoa& other) noexcept(nothrow_move) {
+    auto const rows = size_ > other.size_ ? size_ : other.size_;
+    for(size_type i = 0u; i < rows; i++) {
+        swap_rows(other, i, fields{});
+    }
+    auto const size = size_;
+    size_ = other.size_;
+    other.size_ = size;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr void statvec_aosoa<N, Block, Ts...>::clear() noexcept {
+    size_ = 0u;
+}
+
+/* Rows gained keep whatever values they held. Returns false if size exceeds the capacity, in which case the vector
+ * is resized to capacity */
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool statvec_aosoa<N, Block, Ts...>::resize(size_type size) noexcept {
+    if(size > capacity()) {
+        size_ = capacity();
+        return false;
+    }
+    size_ = size;
+    return true;
+}
+
+/* Inserts a row with one value per field before pos. Returns end() if the vector is full */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <typename... Us>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator
+statvec_aosoa<N, Block, Ts...>::insert(const_iterator pos, Us&&... values) noexcept(nothrow_move &&
+                                                                                   (std::is_nothrow_assignable_v<Ts&, Us&&> && ...))
+{
+    static_assert(sizeof...(Us) == sizeof...(Ts), "A value is required for every field");
+    if(full()) {
+        return end();
+    }
+    auto const i = static_cast<size_type>(pos - cbegin());
+    for(auto k = size_; k > i; k--) {
+        move_row(k, k - 1u, fields{});
+    }
+    assign_row(i, fields{}, std::forward<Us>(values)...);
+    ++size_;
+    return begin() + static_cast<difference_type>(i);
+}
+
+/* Appends a row with one value per field. Returns false if the vector is full */
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <typename... Us>
+constexpr bool statvec_aosoa<N, Block, Ts...>::push_back(Us&&... values) noexcept((std::is_nothrow_assignable_v<Ts&, Us&&> && ...)) {
+    static_assert(sizeof...(Us) == sizeof...(Ts), "A value is required for every field");
+    if(full()) {
+        return false;
+    }
+    assign_row(size_++, fields{}, std::forward<Us>(values)...);
+    return true;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::value_type
+statvec_aosoa<N, Block, Ts...>::pop_back() noexcept((std::is_nothrow_copy_constructible_v<Ts> && ...)) {
+    return value_type{(*this)[--size_]};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator statvec_aosoa<N, Block, Ts...>::erase(const_iterator pos) noexcept(nothrow_move) {
+    return erase(pos, pos + 1);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator
+statvec_aosoa<N, Block, Ts...>::erase(const_iterator first, const_iterator last) noexcept(nothrow_move) {
+    auto const i = static_cast<size_type>(first - cbegin());
+    auto const count = static_cast<size_type>(last - first);
+    if(!count) {
+        /* Moving the rows onto themselves would leave them in a moved-from state */
+        return begin() + static_cast<difference_type>(i);
+    }
+    for(auto k = i + count; k < size_; k++) {
+        move_row(k - count, k, fields{});
+    }
+    size_ -= count;
+    return begin() + static_cast<difference_type>(i);
+}
+
+/* Erases the row at pos by moving the last row into its place, in constant time but without preserving order.
+ * Returns an iterator to pos, which holds the former last row unless pos was the last row */
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator statvec_aosoa<N, Block, Ts...>::swap_remove(const_iterator pos) noexcept(nothrow_move) {
+    auto const i = static_cast<size_type>(pos - cbegin());
+    if(i != --size_) {
+        move_row(i, size_, fields{});
+    }
+    return begin() + static_cast<difference_type>(i);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator statvec_aosoa<N, Block, Ts...>::begin() noexcept {
+    return iterator{this, 0};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::iterator statvec_aosoa<N, Block, Ts...>::end() noexcept {
+    return iterator{this, static_cast<difference_type>(size_)};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_iterator statvec_aosoa<N, Block, Ts...>::begin() const noexcept {
+    return cbegin();
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_iterator statvec_aosoa<N, Block, Ts...>::end() const noexcept {
+    return cend();
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_iterator statvec_aosoa<N, Block, Ts...>::cbegin() const noexcept {
+    return const_iterator{this, 0};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_iterator statvec_aosoa<N, Block, Ts...>::cend() const noexcept {
+    return const_iterator{this, static_cast<difference_type>(size_)};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reverse_iterator statvec_aosoa<N, Block, Ts...>::rbegin() noexcept {
+    return reverse_iterator{end()};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reverse_iterator statvec_aosoa<N, Block, Ts...>::rend() noexcept {
+    return reverse_iterator{begin()};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reverse_iterator statvec_aosoa<N, Block, Ts...>::rbegin() const noexcept {
+    return crbegin();
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reverse_iterator statvec_aosoa<N, Block, Ts...>::rend() const noexcept {
+    return crend();
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reverse_iterator statvec_aosoa<N, Block, Ts...>::crbegin() const noexcept {
+    return const_reverse_iterator{cend()};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reverse_iterator statvec_aosoa<N, Block, Ts...>::crend() const noexcept {
+    return const_reverse_iterator{cbegin()};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t... Is>
+constexpr typename statvec_aosoa<N, Block, Ts...>::reference
+statvec_aosoa<N, Block, Ts...>::row(size_type i, std::index_sequence<Is...>) noexcept {
+    return reference{get<Is>(i)...};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t... Is>
+constexpr typename statvec_aosoa<N, Block, Ts...>::const_reference
+statvec_aosoa<N, Block, Ts...>::row(size_type i, std::index_sequence<Is...>) const noexcept {
+    return const_reference{get<Is>(i)...};
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <typename... Us, std::size_t... Is>
+constexpr void statvec_aosoa<N, Block, Ts...>::assign_row(size_type i, std::index_sequence<Is...>, Us&&... values)
+    noexcept((std::is_nothrow_assignable_v<Ts&, Us&&> && ...))
+{
+    ((get<Is>(i) = std::forward<Us>(values)), ...);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t... Is>
+constexpr void statvec_aosoa<N, Block, Ts...>::move_row(size_type to, size_type from, std::index_sequence<Is...>) noexcept(nothrow_move) {
+    ((get<Is>(to) = std::move(get<Is>(from))), ...);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t... Is>
+constexpr void statvec_aosoa<N, Block, Ts...>::swap_rows(statvec_aosoa& other, size_type i, std::index_sequence<Is...>) noexcept(nothrow_move) {
+    auto const swap_field = [](auto& lhs, auto& rhs) {
+        auto value = std::move(lhs);
+        lhs = std::move(rhs);
+        rhs = std::move(value);
+    };
+    (swap_field(get<Is>(i), other.template get<Is>(i)), ...);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+template <std::size_t... Is>
+constexpr bool statvec_aosoa<N, Block, Ts...>::equal_rows(statvec_aosoa const& other, size_type i, std::index_sequence<Is...>) const noexcept {
+    return ((get<Is>(i) == other.template get<Is>(i)) && ...);
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool operator==(statvec_aosoa<N, Block, Ts...> const& lhs, statvec_aosoa<N, Block, Ts...> const& rhs) noexcept {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0u; i < lhs.size(); i++) {
+        if(!lhs.equal_rows(rhs, i, std::index_sequence_for<Ts...>{})) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N, std::size_t Block, typename... Ts>
+constexpr bool operator!=(statvec_aosoa<N, Block, Ts...> const& lhs, statvec_aosoa<N, Block, Ts...> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+#endif /* STATVEC_SOA_H */
@@ -0,0 +1,199 @@
+#include <catch.hpp>
+
+#include "static_bitvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <std::size_t N>
+bool same(static_bitvec<N> const& vec, std::vector<bool> const& ref) {
+    return vec.size() == ref.size() && std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()) &&
+           std::equal(vec.rbegin(), vec.rend(), ref.rbegin(), ref.rend());
+}
+
+} // namespace
+
+TEST_CASE("Bitvec Matches std::vector<bool>", "[bitvec]") {
+    static_bitvec<300> vec{};
+    std::vector<bool> ref{};
+    unsigned state = 13u;
+    for(int step = 0; step < 6000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const value = ((state >> 20) & 1u) == 1u;
+        auto const pos = ref.empty() ? 0u : (state >> 8) % (ref.size() + 1u);
+        auto const count = (state >> 4) % 90u;
+        switch(state % 8u) {
+            case 0u: {
+                auto const last = std::min<std::size_t>(pos + count, ref.size());
+                auto const it = vec.erase(vec.cbegin() + pos, vec.cbegin() + last);
+                ref.erase(ref.begin() + pos, ref.begin() + last);
+                REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                break;
+            }
+            case 1u: {
+                auto const it = vec.insert(vec.cbegin() + pos, count, value);
+                if(ref.size() + count <= 300u) {
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                    ref.insert(ref.begin() + pos, count, value);
+                }
+                else {
+                    REQUIRE(it == vec.end());
+                }
+                break;
+            }
+            case 2u:
+                if(pos < ref.size()) {
+                    vec.erase(vec.cbegin() + pos);
+                    ref.erase(ref.begin() + pos);
+                }
+                break;
+            case 3u:
+                if(pos < ref.size()) {
+                    vec.flip(pos);
+                    ref[pos] = !ref[pos];
+                }
+                break;
+            case 4u: {
+                auto const size = (state >> 6) % 310u;
+                REQUIRE(vec.resize(size, value) == (size <= 300u));
+                ref.resize(std::min(size, 300u), value);
+                break;
+            }
+            case 5u:
+                if(!ref.empty()) {
+                    REQUIRE(vec.pop_back() == ref.back());
+                    ref.pop_back();
+                }
+                break;
+            default:
+                REQUIRE(vec.push_back(value) == (ref.size() < 300u));
+                if(ref.size() < 300u) {
+                    ref.push_back(value);
+                }
+        }
+        REQUIRE(vec.size() == ref.size());
+        REQUIRE(vec.count() == static_cast<std::size_t>(std::count(ref.begin(), ref.end(), true)));
+        if(step % 50 == 0) {
+            REQUIRE(same(vec, ref));
+            std::size_t rank = 0u;
+            for(std::size_t i = 0u; i < ref.size(); i++) {
+                REQUIRE(vec.rank(i) == rank);
+                if(ref[i]) {
+                    REQUIRE(vec.select(rank) == i);
+                    ++rank;
+                }
+            }
+            REQUIRE(vec.select(rank) == vec.size());
+
+            std::vector<std::size_t> set_bits{};
+            for(auto i = vec.find_first(); i != vec.size(); i = vec.find_next(i)) {
+                set_bits.push_back(i);
+            }
+            REQUIRE(set_bits.size() == rank);
+            std::vector<std::size_t> visited{};
+            vec.for_each_set([&visited](std::size_t i) {
+                visited.push_back(i);
+            });
+            REQUIRE(visited == set_bits);
+            REQUIRE(std::all_of(set_bits.begin(), set_bits.end(), [&ref](std::size_t i) { return ref[i]; }));
+            auto const unset = std::find(ref.begin(), ref.end(), false) - ref.begin();
+            REQUIRE(vec.find_first_unset() == static_cast<std::size_t>(unset));
+        }
+    }
+}
+
+TEST_CASE("Bitvec Word Operations", "[bitvec]") {
+    static_bitvec<200> lhs{};
+    static_bitvec<200> rhs{};
+    for(std::size_t i = 0u; i < 150u; i++) {
+        lhs.push_back(i % 3u == 0u);
+    }
+    for(std::size_t i = 0u; i < 180u; i++) {
+        rhs.push_back(i % 2u == 0u);
+    }
+
+    auto const both = lhs & rhs;
+    auto const either = lhs | rhs;
+    auto const one = lhs ^ rhs;
+    auto const inverse = ~lhs;
+    REQUIRE(both.size() == 150u);
+    REQUIRE(either.size() == 150u);
+    for(std::size_t i = 0u; i < 150u; i++) {
+        REQUIRE(both[i] == (i % 6u == 0u));
+        REQUIRE(either[i] == (i % 3u == 0u || i % 2u == 0u));
+        REQUIRE(one[i] == ((i % 3u == 0u) != (i % 2u == 0u)));
+        REQUIRE(inverse[i] == (i % 3u != 0u));
+    }
+    REQUIRE(both.count() == 25u);
+    REQUIRE(either.count() == 100u);
+    REQUIRE(inverse.count() == 100u);
+    REQUIRE(either.find_next(150u) == 150u);
+
+    lhs.set();
+    REQUIRE(lhs.all());
+    REQUIRE(lhs.find_first_unset() == lhs.size());
+    lhs.reset();
+    REQUIRE(lhs.none());
+    REQUIRE(lhs.find_first() == lhs.size());
+    REQUIRE(lhs.word_count() == 3u);
+    REQUIRE(lhs != rhs);
+    lhs.assign(rhs.begin(), rhs.end());
+    REQUIRE(lhs == rhs);
+}
+
+TEST_CASE("Bitvec Interface", "[bitvec]") {
+    static_bitvec<70> vec{};
+    REQUIRE(vec.empty());
+    REQUIRE(vec.assign(70u, true));
+    REQUIRE(vec.full());
+    REQUIRE(!vec.push_back(false));
+    REQUIRE(vec.data()[1] == 0x3fu);
+
+    vec[3] = false;
+    vec.at(68) = vec[3];
+    REQUIRE(!vec.test(68));
+    REQUIRE(~vec[3]);
+    REQUIRE_THROWS_AS(vec.at(70), std::out_of_range);
+    REQUIRE(vec.count() == 68u);
+
+    auto it = vec.begin();
+    *it = false;
+    it[1].flip();
+    REQUIRE(!vec.front());
+    REQUIRE(vec.find_first() == 2u);
+    REQUIRE(vec.find_first_unset() == 0u);
+
+    static_bitvec<70> other{};
+    other.push_back(true);
+    vec.swap(other);
+    REQUIRE(vec.size() == 1u);
+    REQUIRE(vec.back());
+    REQUIRE(other.size() == 70u);
+    REQUIRE(!vec.assign(71u, false));
+    REQUIRE(vec.size() == 70u);
+    REQUIRE(vec.none());
+    vec.clear();
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("Bitvec Constexpr", "[bitvec]") {
+    constexpr auto vec = [] {
+        static_bitvec<128> v{};
+        for(int i = 0; i < 100; i++) {
+            v.push_back(i % 7 == 0);
+        }
+        v.insert(v.cbegin() + 3, 5u, true);
+        v.erase(v.cbegin(), v.cbegin() + 2);
+        return v;
+    }();
+    static_assert(vec.size() == 103u);
+    static_assert(vec.count() == 19u);
+    static_assert(vec.find_first() == 1u);
+    static_assert(vec.select(6) == 17u);
+    static_assert(vec.rank(13) == 6u);
+}
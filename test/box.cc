@@ -0,0 +1,65 @@
+#include <catch.hpp>
+
+#include "statvec_box.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+TEST_CASE("Box Construction", "[box]") {
+    SECTION("Huge Page Alignment") {
+        using box_type = statvec_box<float, 1u << 20>;
+        REQUIRE(box_type::alignment == detail::huge_page_size);
+        REQUIRE(box_type::allocation_size % box_type::alignment == 0u);
+
+        box_type box{};
+        REQUIRE(box);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(box.get()) % box_type::alignment == 0u);
+        REQUIRE(box->empty());
+        REQUIRE(box->capacity() == 1u << 20);
+    }
+    SECTION("Cache Line Alignment") {
+        using box_type = statvec_box<int, 16>;
+        REQUIRE(box_type::alignment == detail::cache_line_size);
+
+        box_type box{};
+        REQUIRE(reinterpret_cast<std::uintptr_t>(box.get()) % box_type::alignment == 0u);
+        REQUIRE(box->empty());
+    }
+    SECTION("Non-Trivial Elements") {
+        statvec_box<std::string, 16> box{};
+        REQUIRE(box->empty());
+        REQUIRE((*box)[15].empty());
+        REQUIRE(box->push_back("statvec"));
+        REQUIRE(box->front() == "statvec");
+    }
+}
+
+TEST_CASE("Box Access", "[box]") {
+    statvec_box<int, 1u << 20> box{};
+    for(int i = 0; i < 1024; i++) {
+        REQUIRE(box->push_back(i));
+    }
+    REQUIRE(box->size() == 1024u);
+    REQUIRE((*box)[512] == 512);
+
+    auto const& cbox = box;
+    REQUIRE(cbox->back() == 1023);
+    REQUIRE(cbox.get() == box.get());
+}
+
+TEST_CASE("Box Move", "[box]") {
+    statvec_box<int, 64> box0{};
+    box0->push_back(12);
+    auto* vec = box0.get();
+
+    statvec_box<int, 64> box1{std::move(box0)};
+    REQUIRE(!box0);
+    REQUIRE(box1.get() == vec);
+
+    statvec_box<int, 64> box2{};
+    box2 = std::move(box1);
+    REQUIRE(!box1);
+    REQUIRE(box2.get() == vec);
+    REQUIRE(box2->front() == 12);
+}
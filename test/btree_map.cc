@@ -0,0 +1,185 @@
+#include <catch.hpp>
+
+#include "static_btree_map.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <typename Map, typename Ref>
+bool same(Map const& map, Ref const& ref) {
+    auto const equal = [](auto const& lhs, auto const& rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    };
+    return map.size() == ref.size() &&
+           std::equal(map.begin(), map.end(), ref.begin(), ref.end(), equal) &&
+           std::equal(std::make_reverse_iterator(map.end()), std::make_reverse_iterator(map.begin()), ref.rbegin(), ref.rend(), equal);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("B+Tree Map Matches std::map", "[btree_map]", ((std::size_t B), B), 4, 5, 16) {
+    static_btree_map<int, int, 500, std::less<int>, B> map{};
+    std::map<int, int> ref{};
+    unsigned state = 7u;
+    for(int step = 0; step < 20000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const key = static_cast<int>((state >> 8) % 700u);
+        switch(state % 6u) {
+            case 0u:
+                REQUIRE(map.erase(key) == ref.erase(key));
+                break;
+            case 1u: {
+                auto const it = map.lower_bound(key);
+                auto const ref_it = ref.lower_bound(key);
+                if(ref_it == ref.end()) {
+                    REQUIRE(it == map.end());
+                }
+                else {
+                    REQUIRE(it->first == ref_it->first);
+                    auto const next = map.erase(it);
+                    auto const ref_next = ref.erase(ref_it);
+                    REQUIRE((next == map.end()) == (ref_next == ref.end()));
+                    if(ref_next != ref.end()) {
+                        REQUIRE(next->first == ref_next->first);
+                    }
+                }
+                break;
+            }
+            case 2u: {
+                auto const it = map.upper_bound(key);
+                auto const ref_it = ref.upper_bound(key);
+                REQUIRE((it == map.end()) == (ref_it == ref.end()));
+                auto const [pos, inserted] = map.insert_or_assign(key, step);
+                REQUIRE(pos->second == step);
+                REQUIRE(inserted == (ref.size() < 500u && ref.count(key) == 0u));
+                if(ref.size() < 500u || ref.count(key)) {
+                    ref[key] = step;
+                }
+                break;
+            }
+            default: {
+                auto const [pos, inserted] = map.try_emplace(key, step);
+                auto const ref_inserted = ref.size() < 500u && ref.count(key) == 0u;
+                REQUIRE(inserted == ref_inserted);
+                if(ref_inserted || ref.count(key)) {
+                    REQUIRE(pos->first == key);
+                    ref.try_emplace(key, step);
+                }
+                else {
+                    REQUIRE(pos == map.end());
+                }
+            }
+        }
+        REQUIRE(map.size() == ref.size());
+        REQUIRE(map.contains(key) == (ref.count(key) == 1u));
+        if(step % 500 == 0) {
+            REQUIRE(same(map, ref));
+        }
+    }
+    while(!ref.empty()) {
+        auto const key = std::next(ref.begin(), static_cast<std::ptrdiff_t>(ref.size() / 2u))->first;
+        REQUIRE(map.erase(key) == 1u);
+        ref.erase(key);
+    }
+    REQUIRE(map.empty());
+    REQUIRE(map.height() == 0u);
+    REQUIRE(map.begin() == map.end());
+}
+
+TEST_CASE("B+Tree Map Bulk Load", "[btree_map]") {
+    std::vector<std::pair<int, int>> values{};
+    for(int i = 0; i < 1000; i++) {
+        values.emplace_back(2 * i, i);
+    }
+    static_btree_map<int, int, 1000, std::less<int>, 8> map{};
+    REQUIRE(map.assign_sorted(values.begin(), values.end()));
+    REQUIRE(map.size() == 1000u);
+    REQUIRE(map.height() == 3u);
+    REQUIRE(same(map, std::map<int, int>(values.begin(), values.end())));
+
+    std::vector<int> scan{};
+    for(auto it = map.lower_bound(199), last = map.upper_bound(300); it != last; ++it) {
+        scan.push_back(it->second);
+    }
+    REQUIRE(scan.size() == 51u);
+    REQUIRE(scan.front() == 100);
+    REQUIRE(scan.back() == 150);
+
+    REQUIRE(map.erase(0) == 1u);
+    REQUIRE(map.insert({1, -1}).second);
+    REQUIRE(map.at(1) == -1);
+    REQUIRE(!map.insert({3, -3}).second);
+
+    values.emplace_back(2000, 1000);
+    REQUIRE(!map.assign_sorted(values.begin(), values.end()));
+    REQUIRE(map.full());
+    REQUIRE(std::prev(map.end())->first == 1998);
+
+    for(std::size_t n : {0u, 1u, 8u, 9u, 72u, 73u}) {
+        REQUIRE(map.assign_sorted(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n)));
+        REQUIRE(same(map, std::map<int, int>(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n))));
+        for(std::size_t i = 0u; i < n; i++) {
+            REQUIRE(map.erase(values[i].first) == 1u);
+        }
+        REQUIRE(map.empty());
+    }
+}
+
+TEST_CASE("B+Tree Map Interface", "[btree_map]") {
+    static_btree_map<std::string, int, 64, std::greater<std::string>> map{};
+    for(int i = 0; i < 40; i++) {
+        REQUIRE(map.insert({std::to_string(i), i}).second);
+    }
+    REQUIRE(map.begin()->first == "9");
+    REQUIRE(std::prev(map.end())->first == "0");
+    REQUIRE(map.count("17") == 1u);
+    REQUIRE(map.find("40") == map.end());
+    REQUIRE_THROWS_AS(map.at("40"), std::out_of_range);
+
+    for(auto [key, value] : map) {
+        value *= 2;
+    }
+    REQUIRE(map.at("21") == 42);
+    auto const& cmap = map;
+    REQUIRE(cmap.find("5")->second == 10);
+    REQUIRE(cmap.lower_bound("35")->first == "35");
+    REQUIRE(cmap.upper_bound("35")->first == "34");
+
+    auto copy = map;
+    REQUIRE(copy == map);
+    copy.insert_or_assign("3", 0);
+    REQUIRE(copy != map);
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.try_emplace("a", 1).second);
+    REQUIRE(map.size() == 1u);
+}
+
+TEST_CASE("B+Tree Map Constexpr", "[btree_map]") {
+    constexpr auto map = [] {
+        static_btree_map<int, int, 32, std::less<int>, 4> m{};
+        for(int i = 0; i < 20; i++) {
+            m.try_emplace((i * 7) % 20, i);
+        }
+        for(int i = 0; i < 20; i += 3) {
+            m.erase(i);
+        }
+        return m;
+    }();
+    static_assert(map.size() == 13u);
+    static_assert(map.height() >= 1u);
+    static_assert(map.begin()->first == 1);
+    static_assert(!map.contains(9) && map.contains(10));
+    static_assert(map.at(7) == 1);
+}
@@ -0,0 +1,205 @@
+#include <catch.hpp>
+
+#include "detectors.h"
+#include "static_deque.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+TEST_CASE("Deque Construction", "[deque]") {
+    SECTION("Default") {
+        static_deque<int, 8> deq{};
+        REQUIRE(deq.empty());
+        REQUIRE(deq.capacity() == 8);
+    }
+    SECTION("Variadic") {
+        static_deque deq{1, 2, 3};
+        REQUIRE(deq.size() == 3);
+        REQUIRE(deq.capacity() == 3);
+        REQUIRE(deq.front() == 1);
+        REQUIRE(deq.back() == 3);
+    }
+}
+
+TEST_CASE("Deque Push and Pop", "[deque]") {
+    static_deque<int, 4> deq{};
+    REQUIRE(deq.push_back(1));
+    REQUIRE(deq.push_front(0));
+    REQUIRE(deq.push_back(2));
+    REQUIRE(deq.emplace_front(-1));
+    REQUIRE(deq.full());
+    REQUIRE(!deq.push_back(3));
+    REQUIRE(!deq.push_front(3));
+    REQUIRE(!deq.emplace_back(3));
+
+    REQUIRE(deq[0] == -1);
+    REQUIRE(deq[3] == 2);
+    REQUIRE(deq.pop_front() == -1);
+    REQUIRE(deq.pop_back() == 2);
+    REQUIRE(deq.size() == 2);
+    REQUIRE(deq.front() == 0);
+    REQUIRE(deq.back() == 1);
+    REQUIRE(deq.pop_front() == 0);
+    REQUIRE(deq.pop_front() == 1);
+    REQUIRE(deq.empty());
+}
+
+TEST_CASE("Deque as Bounded FIFO", "[deque]") {
+    static_deque<int, 5> deq{};
+    int next = 0;
+    int expected = 0;
+    for(int round = 0; round < 32; round++) {
+        while(deq.push_back(next)) {
+            ++next;
+        }
+        for(int i = 0; i < 3; i++) {
+            REQUIRE(deq.pop_front() == expected++);
+        }
+        REQUIRE(std::is_sorted(deq.begin(), deq.end()));
+        REQUIRE(deq.front() == expected);
+    }
+}
+
+TEST_CASE("Deque Move Semantics", "[deque]") {
+    static_deque<move_detector, 4> deq{};
+    REQUIRE(deq.push_back(move_detector{}));
+    REQUIRE(deq.push_front(move_detector{}));
+    REQUIRE(deq[0].move_assignments == 1);
+    REQUIRE(deq[1].move_assignments == 1);
+    REQUIRE(deq.pop_front().move_constructions == 1);
+}
+
+TEST_CASE("Deque Element Access", "[deque]") {
+    static_deque<int, 4> deq{};
+    deq.push_back(2);
+    deq.push_front(1);
+    REQUIRE(deq.at(0) == 1);
+    REQUIRE(deq.at(1) == 2);
+    REQUIRE_THROWS_AS(deq.at(2), std::out_of_range);
+    auto const& cdeq = deq;
+    REQUIRE(cdeq.at(1) == 2);
+    REQUIRE(cdeq.front() == 1);
+    REQUIRE(cdeq.back() == 2);
+}
+
+TEST_CASE("Deque Iterators", "[deque]") {
+    using deque_type = static_deque<int, 8>;
+    REQUIRE(std::is_same_v<std::iterator_traits<deque_type::iterator>::iterator_category, std::random_access_iterator_tag>);
+    REQUIRE(std::is_convertible_v<deque_type::iterator, deque_type::const_iterator>);
+    REQUIRE(!std::is_convertible_v<deque_type::const_iterator, deque_type::iterator>);
+
+    deque_type deq{};
+    for(int i = 0; i < 5; i++) {
+        deq.push_back(i + 1);
+    }
+    for(int i = 0; i > -3; i--) {
+        deq.push_front(i);
+    }
+    REQUIRE(!deq.is_contiguous());
+
+    SECTION("Traversal") {
+        int expected = -2;
+        for(auto v : deq) {
+            REQUIRE(v == expected++);
+        }
+        REQUIRE(std::distance(deq.begin(), deq.end()) == 8);
+        REQUIRE(*std::prev(deq.end()) == 5);
+        REQUIRE(*deq.rbegin() == 5);
+        REQUIRE(*std::prev(deq.crend()) == -2);
+    }
+    SECTION("Random Access") {
+        auto it = deq.begin();
+        REQUIRE(it[2] == 0);
+        REQUIRE(*(it + 7) == 5);
+        it += 6;
+        REQUIRE(*it == 4);
+        it -= 4;
+        REQUIRE(*it == 0);
+        REQUIRE(deq.end() - it == 6);
+        REQUIRE(it < deq.end());
+        REQUIRE(deq.cbegin() + 2 == deque_type::const_iterator{it});
+    }
+    SECTION("Mutation") {
+        std::transform(deq.begin(), deq.end(), deq.begin(), [](int i) { return i * 2; });
+        REQUIRE(deq.front() == -4);
+        REQUIRE(deq.back() == 10);
+        std::sort(deq.begin(), deq.end(), std::greater<>{});
+        REQUIRE(deq.front() == 10);
+        REQUIRE(deq.back() == -4);
+    }
+}
+
+TEST_CASE("Deque Linearization", "[deque]") {
+    static_deque<int, 8> deq{};
+    for(int i = 0; i < 6; i++) {
+        deq.push_back(i);
+    }
+    SECTION("Already Contiguous") {
+        deq.pop_front();
+        REQUIRE(deq.is_contiguous());
+        auto* p = deq.as_contiguous();
+        REQUIRE(p == &deq.front());
+        REQUIRE(std::equal(p, p + deq.size(), deq.begin()));
+    }
+    SECTION("Wrapped") {
+        for(int i = 0; i < 5; i++) {
+            deq.pop_front();
+            deq.push_back(6 + i);
+        }
+        REQUIRE(!deq.is_contiguous());
+        auto* p = deq.as_contiguous();
+        REQUIRE(deq.is_contiguous());
+        REQUIRE(p == &deq.front());
+        for(int i = 0; i < 6; i++) {
+            REQUIRE(p[i] == 5 + i);
+        }
+        REQUIRE(deq.push_front(4));
+        REQUIRE(deq.front() == 4);
+    }
+}
+
+TEST_CASE("Deque Comparison", "[deque]") {
+    static_deque<int, 4> deq0{};
+    deq0.push_front(2);
+    deq0.push_front(1);
+    REQUIRE(deq0 == static_deque{1, 2});
+    REQUIRE(deq0 != static_deque{1, 2, 3});
+    REQUIRE(deq0 < static_deque{1, 3});
+    REQUIRE(deq0 > static_deque{1});
+    REQUIRE(deq0 <= static_deque{1, 2});
+    REQUIRE(deq0 >= static_deque{0, 5});
+}
+
+TEST_CASE("Deque Swapping and Clearing", "[deque]") {
+    static_deque deq0{1, 2, 3};
+    static_deque deq1{4, 5, 6};
+    deq0.swap(deq1);
+    REQUIRE(deq0 == static_deque{4, 5, 6});
+    REQUIRE(deq1 == static_deque{1, 2, 3});
+    deq0.clear();
+    REQUIRE(deq0.empty());
+    REQUIRE(deq0.push_front(7));
+    REQUIRE(deq0.back() == 7);
+}
+
+TEST_CASE("Deque Constant Evaluation", "[deque]") {
+    constexpr auto deq = [] {
+        static_deque<int, 4> d{};
+        d.push_back(2);
+        d.push_front(1);
+        d.push_back(3);
+        d.pop_front();
+        d.push_back(4);
+        d.push_back(5);
+        d.pop_front();
+        d.push_back(6);
+        return d;
+    }();
+    static_assert(deq.size() == 4);
+    static_assert(deq.front() == 3);
+    static_assert(deq.back() == 6);
+    static_assert(!deq.is_contiguous());
+}
@@ -0,0 +1,234 @@
+#include <catch.hpp>
+
+#include "static_devector.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("Devector Construction", "[devector]") {
+    SECTION("Default") {
+        static_devector<int, 8> vec{};
+        REQUIRE(vec.empty());
+        REQUIRE(vec.capacity() == 8);
+        REQUIRE(vec.front_headroom() == 4);
+        REQUIRE(vec.back_headroom() == 4);
+    }
+    SECTION("Variadic") {
+        static_devector vec{1, 2, 3};
+        REQUIRE(vec.size() == 3);
+        REQUIRE(vec.capacity() == 3);
+        REQUIRE(vec.front() == 1);
+        REQUIRE(vec.back() == 3);
+        REQUIRE(vec.front_headroom() == 0);
+    }
+    SECTION("Array") {
+        std::array<int, 3> const arr{4, 5, 6};
+        static_devector<int, 5> copied{arr};
+        REQUIRE(copied.size() == 3);
+        REQUIRE(copied.front_headroom() == 0);
+        REQUIRE(copied.back() == 6);
+
+        static_devector moved{std::array<std::string, 2>{"a", "b"}};
+        STATIC_REQUIRE(std::is_same_v<decltype(moved), static_devector<std::string, 2>>);
+        REQUIRE(moved.front() == "a");
+        REQUIRE(moved.back() == "b");
+    }
+}
+
+TEST_CASE("Devector Reserve", "[devector]") {
+    static_devector<int, 4> vec{1, 2, 3};
+    auto const larger = vec.reserve<8>();
+    REQUIRE(larger.capacity() == 8);
+    REQUIRE(std::equal(std::begin(larger), std::end(larger), std::begin(vec), std::end(vec)));
+    REQUIRE(larger.front_headroom() == 4);
+
+    auto const smaller = statvec_reserve<2>(vec);
+    REQUIRE(smaller.size() == 2);
+    REQUIRE(smaller.back() == 2);
+
+    static_devector<std::string, 2> strings{"x", "y"};
+    auto const moved = std::move(strings).reserve<3>();
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved.front() == "x");
+    REQUIRE(moved.front_headroom() == 1);
+}
+
+TEST_CASE("Devector Push and Pop at Both Ends", "[devector]") {
+    static_devector<int, 6> vec{};
+    for(int i = 0; i < 3; i++) {
+        REQUIRE(vec.push_front(-i));
+        REQUIRE(vec.push_back(i + 1));
+    }
+    REQUIRE(vec.size() == 6);
+    REQUIRE(!vec.push_front(0));
+    REQUIRE(!vec.emplace_back(0));
+    REQUIRE(std::is_sorted(std::begin(vec), std::end(vec)));
+    REQUIRE(vec.front() == -2);
+    REQUIRE(vec.back() == 3);
+
+    REQUIRE(vec.pop_front() == -2);
+    REQUIRE(vec.pop_back() == 3);
+    REQUIRE(vec.front_headroom() == 1);
+    REQUIRE(vec.back_headroom() == 1);
+    REQUIRE(vec.data() == &vec[0]);
+    REQUIRE(std::distance(vec.data(), &vec.back()) == 3);
+}
+
+TEST_CASE("Devector Front Insertion Relocates When Headroom Exhausted", "[devector]") {
+    static_devector<int, 8> vec{};
+    REQUIRE(vec.set_front_headroom(0));
+    for(int i = 0; i < 4; i++) {
+        REQUIRE(vec.push_back(i));
+    }
+    REQUIRE(vec.front_headroom() == 0);
+    REQUIRE(vec.push_front(-1));
+    REQUIRE(vec.front_headroom() > 0);
+    REQUIRE(vec.back_headroom() > 0);
+    REQUIRE(std::vector<int>(std::begin(vec), std::end(vec)) == std::vector<int>{-1, 0, 1, 2, 3});
+}
+
+TEST_CASE("Devector Headroom Control", "[devector]") {
+    static_devector<int, 10> vec{};
+    vec.assign(4u, 7);
+    REQUIRE(vec.set_front_headroom(6));
+    REQUIRE(vec.front_headroom() == 6);
+    REQUIRE(vec.back_headroom() == 0);
+    REQUIRE(!vec.set_front_headroom(7));
+    vec.recenter();
+    REQUIRE(vec.front_headroom() == 3);
+    REQUIRE(vec.back_headroom() == 3);
+    REQUIRE(std::all_of(std::begin(vec), std::end(vec), [](int i) { return i == 7; }));
+}
+
+TEST_CASE("Devector Matches Reference Under Mixed Operations", "[devector]") {
+    static_devector<int, 16> vec{};
+    std::vector<int> ref{};
+    int next = 0;
+
+    for(unsigned step = 0; step < 2000; step++) {
+        auto const op = (step * 2654435761u) >> 28;
+        auto const pos = ref.empty() ? 0u : (step * 40503u) % (ref.size() + 1u);
+        switch(op % 6u) {
+            case 0:
+                if(vec.push_front(next)) {
+                    ref.insert(std::begin(ref), next);
+                }
+                break;
+            case 1:
+                if(vec.push_back(next)) {
+                    ref.push_back(next);
+                }
+                break;
+            case 2:
+                if(vec.size() < vec.capacity()) {
+                    vec.insert(std::cbegin(vec) + pos, next);
+                    ref.insert(std::begin(ref) + pos, next);
+                }
+                break;
+            case 3:
+                if(vec.size() + 3u <= vec.capacity()) {
+                    vec.insert(std::cbegin(vec) + pos, 3u, next);
+                    ref.insert(std::begin(ref) + pos, 3u, next);
+                }
+                break;
+            case 4:
+                if(pos < ref.size()) {
+                    vec.erase(std::cbegin(vec) + pos);
+                    ref.erase(std::begin(ref) + pos);
+                }
+                break;
+            default:
+                if(pos + 2u <= ref.size()) {
+                    vec.erase(std::cbegin(vec) + pos, std::cbegin(vec) + pos + 2);
+                    ref.erase(std::begin(ref) + pos, std::begin(ref) + pos + 2);
+                }
+                break;
+        }
+        ++next;
+        REQUIRE(vec.size() == ref.size());
+        REQUIRE(vec.front_headroom() + vec.size() + vec.back_headroom() == vec.capacity());
+        REQUIRE(std::equal(std::begin(vec), std::end(vec), std::begin(ref), std::end(ref)));
+    }
+}
+
+TEST_CASE("Devector Insert and Erase Return Values", "[devector]") {
+    static_devector<int, 8> vec{};
+    std::array<int, 3> const src{4, 5, 6};
+    auto it = vec.insert(std::cend(vec), std::begin(src), std::end(src));
+    REQUIRE(it == std::begin(vec));
+    it = vec.emplace(std::cbegin(vec) + 1, 9);
+    REQUIRE(*it == 9);
+    REQUIRE(vec.insert(std::cbegin(vec), 5u, 0) == std::end(vec));
+
+    it = vec.erase(std::cbegin(vec) + 1);
+    REQUIRE(*it == 5);
+    it = vec.erase(std::cbegin(vec), std::cend(vec));
+    REQUIRE(it == std::end(vec));
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("Devector Input Iterators", "[devector]") {
+    static_devector<int, 6> vec{};
+    std::istringstream in{"1 2 3 4"};
+    REQUIRE(vec.assign(std::istream_iterator<int>{in}, std::istream_iterator<int>{}));
+    REQUIRE(vec == static_devector<int, 6>{1, 2, 3, 4});
+
+    std::istringstream more{"7 8"};
+    auto it = vec.insert(std::cbegin(vec) + 1, std::istream_iterator<int>{more}, std::istream_iterator<int>{});
+    REQUIRE(it == std::begin(vec) + 1);
+    REQUIRE(vec == static_devector<int, 6>{1, 7, 8, 2, 3, 4});
+
+    std::istringstream overflow{"5"};
+    it = vec.insert(std::cbegin(vec), std::istream_iterator<int>{overflow}, std::istream_iterator<int>{});
+    REQUIRE(it == std::end(vec));
+    REQUIRE(vec == static_devector<int, 6>{1, 7, 8, 2, 3, 4});
+
+    std::istringstream many{"9 8 7 6 5 4 3"};
+    REQUIRE(!vec.assign(std::istream_iterator<int>{many}, std::istream_iterator<int>{}));
+    REQUIRE(vec == static_devector<int, 6>{9, 8, 7, 6, 5, 4});
+}
+
+TEST_CASE("Devector Accessors and Comparison", "[devector]") {
+    static_devector<int, 4> vec{};
+    REQUIRE(vec.resize(3));
+    std::iota(std::begin(vec), std::end(vec), 1);
+    REQUIRE(vec.at(2) == 3);
+    REQUIRE_THROWS_AS(vec.at(3), std::out_of_range);
+    REQUIRE(!vec.resize(5));
+    REQUIRE(vec.size() == 4);
+    REQUIRE(vec.front_headroom() == 0);
+
+    static_devector<int, 4> other{};
+    other.assign(std::begin(vec), std::end(vec));
+    REQUIRE(vec == other);
+    other.back() = 10;
+    REQUIRE(vec < other);
+    REQUIRE(*std::crbegin(other) == 10);
+    vec.swap(other);
+    REQUIRE(vec.back() == 10);
+}
+
+TEST_CASE("Devector Constexpr", "[devector]") {
+    constexpr auto vec = [] {
+        static_devector<int, 6> v{};
+        v.push_back(2);
+        v.push_back(3);
+        v.push_front(1);
+        v.push_front(0);
+        v.push_front(-1);
+        v.pop_front();
+        return v;
+    }();
+    static_assert(vec.size() == 4);
+    static_assert(vec.front() == 0);
+    static_assert(vec[1] == 1);
+    static_assert(vec.back() == 3);
+    static_assert(vec.front_headroom() == 1);
+}
@@ -0,0 +1,173 @@
+#include <catch.hpp>
+
+#include "static_gap_buffer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+template <std::size_t N>
+std::string text(static_gap_buffer<char, N> const& buf) {
+    return std::string(std::begin(buf), std::end(buf));
+}
+
+struct tracked {
+    std::string value{};
+};
+
+} // namespace
+
+TEST_CASE("Gap Buffer Construction", "[gap_buffer]") {
+    SECTION("Default") {
+        static_gap_buffer<char, 16> buf{};
+        REQUIRE(buf.empty());
+        REQUIRE(buf.cursor() == 0);
+        REQUIRE(buf.capacity() == 16);
+    }
+    SECTION("Variadic") {
+        static_gap_buffer buf{'a', 'b', 'c'};
+        REQUIRE(buf.size() == 3);
+        REQUIRE(buf.full());
+        REQUIRE(buf.cursor() == 3);
+        REQUIRE(text(buf) == "abc");
+    }
+}
+
+TEST_CASE("Gap Buffer Cursor Editing", "[gap_buffer]") {
+    static_gap_buffer<char, 16> buf{};
+    std::string const hello = "hello world";
+    REQUIRE(buf.insert(std::begin(hello), std::end(hello)));
+    REQUIRE(buf.cursor() == hello.size());
+
+    buf.move_cursor(5);
+    REQUIRE(buf.insert(','));
+    REQUIRE(text(buf) == "hello, world");
+    REQUIRE(buf.cursor() == 6);
+
+    buf.erase_before(6);
+    buf.erase_after();
+    REQUIRE(text(buf) == "world");
+    REQUIRE(buf.cursor() == 0);
+
+    buf.move_cursor(buf.size());
+    REQUIRE(buf.insert(3u, '!'));
+    REQUIRE(text(buf) == "world!!!");
+    REQUIRE(buf.front() == 'w');
+    REQUIRE(buf.back() == '!');
+    REQUIRE(buf.at(4) == 'd');
+    REQUIRE_THROWS_AS(buf.at(8), std::out_of_range);
+
+    REQUIRE(buf.insert(8u, '?'));
+    REQUIRE(buf.full());
+    REQUIRE(!buf.insert('?'));
+    REQUIRE(!buf.emplace('?'));
+}
+
+TEST_CASE("Gap Buffer Spans and Linearization", "[gap_buffer]") {
+    static_gap_buffer<char, 8> buf{};
+    std::string const abcdef = "abcdef";
+    buf.insert(std::begin(abcdef), std::end(abcdef));
+    buf.move_cursor(2);
+
+    auto const before = buf.before_cursor();
+    auto const after = std::as_const(buf).after_cursor();
+    REQUIRE(std::string(std::begin(before), std::end(before)) == "ab");
+    REQUIRE(std::string(std::begin(after), std::end(after)) == "cdef");
+    REQUIRE(after.size() == 4);
+    REQUIRE(buf[2] == 'c');
+
+    auto const data = buf.linearize();
+    REQUIRE(std::string(data, data + buf.size()) == abcdef);
+    REQUIRE(buf.cursor() == buf.size());
+    REQUIRE(buf.after_cursor().empty());
+}
+
+TEST_CASE("Gap Buffer Random Editing Matches std::string", "[gap_buffer]") {
+    static_gap_buffer<char, 64> buf{};
+    std::string ref{};
+    std::size_t cursor = 0u;
+
+    for(unsigned step = 0; step < 4000; step++) {
+        auto const r = step * 2654435761u;
+        switch((r >> 24) % 5u) {
+            case 0:
+            case 1:
+                if(!buf.full()) {
+                    char const c = 'a' + step % 26u;
+                    REQUIRE(buf.insert(c));
+                    ref.insert(cursor++, 1u, c);
+                }
+                break;
+            case 2:
+                if(cursor) {
+                    buf.erase_before();
+                    ref.erase(--cursor, 1u);
+                }
+                break;
+            case 3:
+                if(cursor < ref.size()) {
+                    buf.erase_after();
+                    ref.erase(cursor, 1u);
+                }
+                break;
+            default:
+                cursor = (r >> 8) % (ref.size() + 1u);
+                buf.move_cursor(cursor);
+                break;
+        }
+        REQUIRE(buf.cursor() == cursor);
+        REQUIRE(text(buf) == ref);
+    }
+}
+
+TEST_CASE("Gap Buffer Non-Trivial Elements", "[gap_buffer]") {
+    static_gap_buffer<tracked, 4> buf{};
+    buf.insert(tracked{"a"});
+    buf.insert(tracked{"b"});
+    buf.emplace(tracked{"c"});
+    buf.move_cursor(0);
+    buf.insert(tracked{"z"});
+    REQUIRE(buf[0].value == "z");
+    REQUIRE(buf[1].value == "a");
+    REQUIRE(buf[3].value == "c");
+    buf.move_cursor(4);
+    REQUIRE(buf.before_cursor()[2].value == "b");
+    REQUIRE(std::rbegin(buf)->value == "c");
+}
+
+TEST_CASE("Gap Buffer Comparison and Swap", "[gap_buffer]") {
+    static_gap_buffer<char, 4> lhs{};
+    static_gap_buffer<char, 4> rhs{};
+    lhs.insert('b');
+    lhs.move_cursor(0);
+    lhs.insert('a');
+    rhs.insert('a');
+    rhs.insert('b');
+    REQUIRE(lhs == rhs);
+    rhs.insert('c');
+    REQUIRE(lhs < rhs);
+    lhs.swap(rhs);
+    REQUIRE(lhs.size() == 3);
+    lhs.clear();
+    REQUIRE(lhs.empty());
+}
+
+TEST_CASE("Gap Buffer Constexpr", "[gap_buffer]") {
+    constexpr auto buf = [] {
+        static_gap_buffer<int, 8> b{};
+        b.insert(1);
+        b.insert(3);
+        b.move_cursor(1);
+        b.insert(2);
+        b.erase_after();
+        return b;
+    }();
+    static_assert(buf.size() == 2);
+    static_assert(buf[0] == 1);
+    static_assert(buf[1] == 2);
+    static_assert(buf.cursor() == 2);
+}
@@ -0,0 +1,243 @@
+#include <catch.hpp>
+
+#include "half_statvec.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/* Every bit pattern except NaNs converts back to itself */
+template <half_format Format>
+void check_round_trip() {
+    for(std::uint32_t bits = 0u; bits <= 0xffffu; bits++) {
+        auto const value = detail::from_half<Format>(static_cast<std::uint16_t>(bits));
+        if(std::isnan(value)) {
+            REQUIRE(std::isnan(detail::from_half<Format>(detail::to_half<Format>(value))));
+        }
+        else {
+            REQUIRE(detail::to_half<Format>(value) == bits);
+        }
+    }
+}
+
+template <half_format Format>
+statvec<float, 1000> random_floats(float scale) {
+    statvec<float, 1000> values{};
+    std::uint32_t state = 17u;
+    for(std::size_t i = 0u; i < values.capacity(); i++) {
+        state = state * 1103515245u + 12345u;
+        values.push_back((static_cast<float>(state >> 8) / 16777216.f - 0.5f) * scale);
+    }
+    return values;
+}
+
+template <half_format Format>
+void check_kernels() {
+    for(float scale : {1e-6f, 1.f, 3e4f}) {
+        auto const values = random_floats<Format>(scale);
+        for(std::size_t size : {0u, 7u, 8u, 16u, 33u, 1000u}) {
+            statvec<float, 1000> prefix{};
+            for(std::size_t i = 0u; i < size; i++) {
+                prefix.push_back(values[i]);
+            }
+            half_statvec<Format, 1000> vec{};
+            REQUIRE(vec.pack(prefix));
+            REQUIRE(vec.size() == size);
+
+            statvec<float, 1000> unpacked{};
+            REQUIRE(vec.unpack(unpacked));
+            REQUIRE(unpacked.size() == size);
+            double sum = 0.0;
+            double dot = 0.0;
+            double self = 0.0;
+            for(std::size_t i = 0u; i < size; i++) {
+                REQUIRE(vec.data()[i] == detail::to_half<Format>(values[i]));
+                REQUIRE(unpacked[i] == vec[i]);
+                sum += vec[i];
+                dot += static_cast<double>(vec[i]) * values[i];
+                self += static_cast<double>(vec[i]) * vec[i];
+            }
+            auto const tolerance = 1e-4 * scale * scale * static_cast<double>(size);
+            REQUIRE(vec.sum() == Approx(sum).margin(1e-4 * scale * static_cast<double>(size)));
+            REQUIRE(vec.dot(prefix) == Approx(dot).margin(tolerance));
+            REQUIRE(vec.dot(vec) == Approx(self).margin(tolerance));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("Half Statvec Matches std::vector", "[half]") {
+    fp16_statvec<150> vec{};
+    std::vector<float> ref{};
+    unsigned state = 23u;
+    for(int step = 0; step < 5000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const value = detail::from_half<half_format::fp16>(static_cast<std::uint16_t>((state >> 8) & 0x7bffu));
+        auto const pos = ref.empty() ? 0u : (state >> 4) % ref.size();
+        switch(state % 6u) {
+            case 0u:
+                if(!ref.empty()) {
+                    vec[pos] = value;
+                    ref[pos] = value;
+                }
+                break;
+            case 1u: {
+                auto const size = (state >> 6) % 160u;
+                REQUIRE(vec.resize(size, value) == (size <= 150u));
+                ref.resize(std::min(size, 150u), value);
+                break;
+            }
+            case 2u:
+                if(!ref.empty()) {
+                    REQUIRE(vec.pop_back() == ref.back());
+                    ref.pop_back();
+                }
+                break;
+            default:
+                REQUIRE(vec.push_back(value) == (ref.size() < 150u));
+                if(ref.size() < 150u) {
+                    ref.push_back(value);
+                }
+        }
+        REQUIRE(vec.size() == ref.size());
+        if(step % 50 == 0) {
+            REQUIRE(std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()));
+            REQUIRE(std::equal(vec.rbegin(), vec.rend(), ref.rbegin(), ref.rend()));
+        }
+    }
+}
+
+TEST_CASE("Half Statvec Conversion", "[half]") {
+    check_round_trip<half_format::fp16>();
+    check_round_trip<half_format::bf16>();
+
+    using detail::to_half;
+    auto const inf = std::numeric_limits<float>::infinity();
+    REQUIRE(to_half<half_format::fp16>(1.f) == 0x3c00u);
+    REQUIRE(to_half<half_format::fp16>(-2.f) == 0xc000u);
+    REQUIRE(to_half<half_format::fp16>(1.f / 3.f) == 0x3555u);
+    REQUIRE(to_half<half_format::fp16>(65504.f) == 0x7bffu);
+    REQUIRE(to_half<half_format::fp16>(65519.f) == 0x7bffu);
+    REQUIRE(to_half<half_format::fp16>(65520.f) == 0x7c00u);
+    REQUIRE(to_half<half_format::fp16>(-inf) == 0xfc00u);
+    REQUIRE(to_half<half_format::fp16>(std::ldexp(1.f, -24)) == 0x0001u);
+    REQUIRE(to_half<half_format::fp16>(std::ldexp(1.f, -25)) == 0x0000u);
+    REQUIRE(to_half<half_format::fp16>(std::ldexp(3.f, -26)) == 0x0001u);
+    REQUIRE(to_half<half_format::fp16>(std::ldexp(3.f, -25)) == 0x0002u);
+    REQUIRE(to_half<half_format::fp16>(std::ldexp(1023.5f, -24)) == 0x0400u);
+    REQUIRE(to_half<half_format::fp16>(-0.f) == 0x8000u);
+    REQUIRE(std::isnan(detail::from_half<half_format::fp16>(to_half<half_format::fp16>(std::nanf("")))));
+
+    REQUIRE(to_half<half_format::bf16>(1.f) == 0x3f80u);
+    REQUIRE(to_half<half_format::bf16>(1.f / 3.f) == 0x3eabu);
+    REQUIRE(to_half<half_format::bf16>(std::numeric_limits<float>::max()) == 0x7f80u);
+    REQUIRE(to_half<half_format::bf16>(detail::bits_float(0x3f808000u)) == 0x3f80u);
+    REQUIRE(to_half<half_format::bf16>(detail::bits_float(0x3f818000u)) == 0x3f82u);
+    REQUIRE(to_half<half_format::bf16>(detail::bits_float(0x7f800001u)) == 0x7fc0u);
+
+    statvec<float, 16> specials{};
+    for(auto value : {0.f, -0.f, inf, -inf, std::nanf(""), detail::bits_float(0x7f800001u), 65520.f, 1e-8f,
+                      std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min(), 1.f / 3.f,
+                      detail::bits_float(0x3f808000u), detail::bits_float(0x3f818000u), -1e5f, 5.96e-8f, 0.1f}) {
+        specials.push_back(value);
+    }
+    bf16_statvec<16> bf16{};
+    bf16.pack(specials);
+    fp16_statvec<16> fp16{};
+    fp16.pack(specials);
+    for(std::size_t i = 0u; i < specials.size(); i++) {
+        auto const bf16_bits = to_half<half_format::bf16>(specials[i]);
+        auto const fp16_bits = to_half<half_format::fp16>(specials[i]);
+        if(std::isnan(specials[i])) {
+            REQUIRE(std::isnan(bf16[i]));
+            REQUIRE(std::isnan(fp16[i]));
+        }
+        else {
+            REQUIRE(bf16.data()[i] == bf16_bits);
+            REQUIRE(fp16.data()[i] == fp16_bits);
+        }
+    }
+}
+
+TEST_CASE("Half Statvec Kernels", "[half]") {
+    check_kernels<half_format::fp16>();
+    check_kernels<half_format::bf16>();
+
+    statvec<float, 20> values{};
+    for(int i = 0; i < 20; i++) {
+        values.push_back(static_cast<float>(i));
+    }
+    bf16_statvec<10> vec{};
+    REQUIRE(!vec.pack(values));
+    REQUIRE(vec.full());
+    REQUIRE(vec.sum() == 45.f);
+    REQUIRE(vec.dot(values) == 285.f);
+    statvec<float, 5> small{};
+    REQUIRE(!vec.unpack(small));
+    REQUIRE(small.size() == 5u);
+    REQUIRE(small.back() == 4.f);
+}
+
+TEST_CASE("Half Statvec Interface", "[half]") {
+    fp16_statvec<20> vec{};
+    static_assert(sizeof(vec) == 20u * sizeof(std::uint16_t) + 8u);
+    static_assert(decltype(vec)::format == half_format::fp16);
+    REQUIRE(vec.empty());
+    REQUIRE(vec.assign(20u, 0.1f));
+    REQUIRE(vec.full());
+    REQUIRE(vec.front() == detail::from_half<half_format::fp16>(0x2e66u));
+    REQUIRE(!vec.push_back(1.f));
+
+    vec[3] = 2.5f;
+    vec.at(19) = vec[3];
+    REQUIRE(vec.back() == 2.5f);
+    REQUIRE_THROWS_AS(vec.at(20), std::out_of_range);
+
+    auto it = vec.begin();
+    *it = -1.f;
+    it[1] = 0.5f;
+    REQUIRE(vec.cbegin()[1] == 0.5f);
+    REQUIRE(vec.end() - vec.begin() == 20);
+
+    std::vector<double> const doubles{1.0, 2.0, 3.0};
+    fp16_statvec<20> other{};
+    REQUIRE(other.assign(doubles.begin(), doubles.end()));
+    other.swap(vec);
+    REQUIRE(vec.size() == 3u);
+    REQUIRE(other.size() == 20u);
+    REQUIRE(vec[2] == 3.f);
+    REQUIRE(vec != other);
+    other = vec;
+    REQUIRE(vec == other);
+    vec.clear();
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("Half Statvec Constexpr", "[half]") {
+    constexpr auto vec = [] {
+        statvec<float, 32> values{};
+        for(int i = 0; i < 32; i++) {
+            values.push_back(static_cast<float>(i) * 0.25f);
+        }
+        bf16_statvec<32> v{};
+        v.pack(values);
+        v[31] = 1000.f;
+        return v;
+    }();
+    static_assert(vec.size() == 32u);
+    static_assert(vec[5] == 1.25f);
+    static_assert(vec.back() == 1000.f);
+    static_assert(vec.sum() == 1000.f + 0.25f * 465.f);
+
+    static_assert(detail::to_half<half_format::fp16>(0.333251953125f) == 0x3555u);
+    static_assert(detail::from_half<half_format::fp16>(0x0001u) == 5.9604644775390625e-8f);
+    static_assert(detail::from_half<half_format::fp16>(0xfbffu) == -65504.f);
+}
@@ -0,0 +1,180 @@
+#include <catch.hpp>
+
+#include "static_hash_map.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+
+struct constant_hash {
+    constexpr std::size_t operator()(int) const noexcept {
+        return 0u;
+    }
+};
+
+struct identity_hash {
+    constexpr std::size_t operator()(int key) const noexcept {
+        return static_cast<std::size_t>(key);
+    }
+};
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Hash Map Matches std::unordered_map", "[hash_map]", std::uint8_t, std::int32_t, std::uint64_t, std::string) {
+    static_hash_map<TestType, int, 100> map{};
+    std::unordered_map<TestType, int> ref{};
+
+    auto const make_key = [](unsigned i) {
+        if constexpr(std::is_same_v<TestType, std::string>) {
+            return std::to_string(i % 157u);
+        }
+        else {
+            return static_cast<TestType>(i % 157u);
+        }
+    };
+
+    for(unsigned step = 0; step < 3000; step++) {
+        auto const key = make_key(step * 2654435761u >> 9);
+        if(step % 3u == 0u) {
+            REQUIRE(map.erase(key) == ref.erase(key));
+        }
+        else if(map.full() && !map.contains(key)) {
+            REQUIRE(map.insert_or_assign(key, static_cast<int>(step)) == std::pair{map.end(), false});
+        }
+        else {
+            auto const [it, inserted] = map.insert_or_assign(key, static_cast<int>(step));
+            REQUIRE(inserted == ref.insert_or_assign(key, static_cast<int>(step)).second);
+            REQUIRE(it->first == key);
+            REQUIRE(it->second == static_cast<int>(step));
+        }
+        REQUIRE(map.size() == ref.size());
+        if(step % 50u == 0u) {
+            for(unsigned i = 0; i < 157u; i++) {
+                auto const k = make_key(i);
+                auto const it = ref.find(k);
+                auto const found = map.find(k);
+                REQUIRE((it == ref.end()) == (found == map.end()));
+                if(found != map.end()) {
+                    REQUIRE(found->second == it->second);
+                }
+            }
+        }
+    }
+    REQUIRE(static_cast<std::size_t>(std::distance(map.begin(), map.end())) == ref.size());
+}
+
+TEST_CASE("Hash Map Slot Count", "[hash_map]") {
+    STATIC_REQUIRE(static_hash_set<int, 1>::slot_count == 16u);
+    STATIC_REQUIRE(static_hash_set<int, 14>::slot_count == 16u);
+    STATIC_REQUIRE(static_hash_set<int, 15>::slot_count == 32u);
+    STATIC_REQUIRE(static_hash_set<int, 112>::slot_count == 128u);
+    STATIC_REQUIRE(static_hash_set<int, 113>::slot_count == 256u);
+}
+
+TEST_CASE("Hash Set Survives Churn With Colliding Hashes", "[hash_map]") {
+    static_hash_set<int, 40, constant_hash> set{};
+    std::unordered_set<int> ref{};
+    for(int step = 0; step < 2000; step++) {
+        auto const key = step * 7 % 53;
+        if(step % 2 == 0) {
+            REQUIRE(set.erase(key) == ref.erase(key));
+        }
+        else if(!set.full() || set.contains(key)) {
+            REQUIRE(set.insert(key).second == ref.insert(key).second);
+        }
+        REQUIRE(set.size() == ref.size());
+    }
+    for(int key = 0; key < 53; key++) {
+        REQUIRE(set.contains(key) == (ref.count(key) == 1u));
+    }
+}
+
+TEST_CASE("Hash Set Reuses Deleted Slots When Full", "[hash_map]") {
+    static_hash_set<int, 14, identity_hash> set{};
+    for(int round = 0; round < 20; round++) {
+        for(int i = 0; i < 14; i++) {
+            REQUIRE(set.insert(round * 14 + i).second);
+        }
+        REQUIRE(set.full());
+        auto const full = set.insert(-1);
+        REQUIRE(full.first == set.end());
+        REQUIRE(!full.second);
+        auto const present = set.insert(round * 14);
+        REQUIRE(present.first != set.end());
+        REQUIRE(*present.first == round * 14);
+        REQUIRE(!present.second);
+        for(auto it = set.begin(); it != set.end();) {
+            it = set.erase(it);
+        }
+        REQUIRE(set.empty());
+    }
+}
+
+TEST_CASE("Hash Map Interface", "[hash_map]") {
+    static_hash_map<std::string, int, 3> map{};
+    auto [it, inserted] = map.try_emplace("one", 1);
+    REQUIRE(inserted);
+    REQUIRE(it->first == "one");
+    REQUIRE(it->second == 1);
+    auto const again = map.try_emplace("one", 10);
+    REQUIRE(!again.second);
+    REQUIRE(again.first->second == 1);
+
+    REQUIRE(map.insert({"two", 2}).second);
+    auto const present = map.insert({"two", 20});
+    REQUIRE(!present.second);
+    REQUIRE(present.first->second == 2);
+    REQUIRE(map.at("two") == 2);
+    REQUIRE(map.insert_or_assign("three", 30).second);
+    auto const assigned = map.insert_or_assign("three", 3);
+    REQUIRE(!assigned.second);
+    REQUIRE(assigned.first->second == 3);
+    REQUIRE(map.full());
+    REQUIRE(map.insert({"four", 4}) == std::pair{map.end(), false});
+    auto const full = map.try_emplace("four", 4);
+    REQUIRE(full.first == map.end());
+    REQUIRE(!full.second);
+    REQUIRE_THROWS_AS(map.at("four"), std::out_of_range);
+
+    STATIC_REQUIRE(std::is_const_v<std::remove_reference_t<decltype(map.begin()->first)>>);
+    STATIC_REQUIRE(std::is_const_v<std::remove_reference_t<decltype((*map.begin()).first)>>);
+    for(auto [key, value] : map) {
+        value *= 2;
+    }
+    REQUIRE(map.at("three") == 6);
+    REQUIRE(map.count("one") == 1u);
+    REQUIRE(map.erase("one") == 1u);
+    REQUIRE(map.erase("one") == 0u);
+    REQUIRE(map.size() == 2u);
+
+    static_hash_map<std::string, int, 3> other{};
+    other.insert_or_assign("three", 6);
+    other.insert_or_assign("two", 4);
+    REQUIRE(map == other);
+    other.clear();
+    REQUIRE(map != other);
+    map.swap(other);
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+}
+
+TEST_CASE("Hash Map Constexpr", "[hash_map]") {
+    constexpr auto map = [] {
+        static_hash_map<int, int, 8, identity_hash> m{};
+        m.insert_or_assign(1, 10);
+        m.insert_or_assign(2, 20);
+        m.insert_or_assign(3, 30);
+        m.erase(1);
+        return m;
+    }();
+    static_assert(map.size() == 2u);
+    static_assert(map.at(3) == 30);
+    static_assert(!map.contains(1));
+}
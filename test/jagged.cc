@@ -0,0 +1,197 @@
+#include <catch.hpp>
+
+#include "static_jagged.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T, std::size_t TotalCap, std::size_t RowCap>
+bool same(static_jagged<T, TotalCap, RowCap> const& jagged, std::vector<std::vector<T>> const& ref) {
+    if(jagged.rows() != ref.size()) {
+        return false;
+    }
+    std::vector<T> flat{};
+    for(std::size_t r = 0u; r < ref.size(); r++) {
+        auto const row = jagged[r];
+        if(jagged.row_size(r) != ref[r].size() || !std::equal(row.begin(), row.end(), ref[r].begin(), ref[r].end())) {
+            return false;
+        }
+        flat.insert(flat.end(), ref[r].begin(), ref[r].end());
+    }
+    auto const elements = jagged.elements();
+    return std::equal(elements.begin(), elements.end(), flat.begin(), flat.end());
+}
+
+} // namespace
+
+TEST_CASE("Jagged Matches std::vector<std::vector>", "[jagged]") {
+    static_jagged<std::string, 200, 40> jagged{};
+    std::vector<std::vector<std::string>> ref{};
+    std::size_t total = 0u;
+    unsigned state = 41u;
+    for(int step = 0; step < 5000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const count = (state >> 8) % 12u;
+        std::vector<std::string> values(count);
+        for(std::size_t i = 0u; i < count; i++) {
+            values[i] = std::to_string(state % 1000u + i);
+        }
+        auto const fits = ref.size() < 40u && total + count <= 200u;
+        switch(state % 6u) {
+            case 0u:
+                REQUIRE(jagged.push_row(values.begin(), values.end()) == fits);
+                if(fits) {
+                    ref.push_back(values);
+                    total += count;
+                }
+                break;
+            case 1u: {
+                auto const appends = !ref.empty() && total + count <= 200u;
+                REQUIRE(jagged.append_to_last_row(values.begin(), values.end()) == appends);
+                if(appends) {
+                    ref.back().insert(ref.back().end(), values.begin(), values.end());
+                    total += count;
+                }
+                break;
+            }
+            case 2u: {
+                auto const appends = !ref.empty() && total < 200u;
+                REQUIRE(jagged.append_to_last_row(values.empty() ? std::string{"x"} : values[0]) == appends);
+                if(appends) {
+                    ref.back().push_back(values.empty() ? std::string{"x"} : values[0]);
+                    ++total;
+                }
+                break;
+            }
+            case 3u:
+                if(!ref.empty()) {
+                    auto const r = (state >> 4) % ref.size();
+                    total -= ref[r].size();
+                    jagged.erase_row(r);
+                    ref.erase(ref.begin() + static_cast<std::ptrdiff_t>(r));
+                }
+                break;
+            case 4u:
+                if(!ref.empty()) {
+                    total -= ref.back().size();
+                    jagged.pop_row();
+                    ref.pop_back();
+                }
+                break;
+            default:
+                REQUIRE(jagged.push_row() == (ref.size() < 40u));
+                if(ref.size() < 40u) {
+                    ref.emplace_back();
+                }
+        }
+        REQUIRE(jagged.rows() == ref.size());
+        REQUIRE(jagged.size() == total);
+        if(step % 25 == 0) {
+            REQUIRE(same(jagged, ref));
+        }
+    }
+}
+
+TEST_CASE("Jagged Row Access", "[jagged]") {
+    static_jagged<int, 16, 4> jagged{};
+    std::vector<int> const first{1, 2, 3};
+    std::vector<int> const second{4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+    REQUIRE(jagged.push_row(first.begin(), first.end()));
+    REQUIRE(jagged.push_row());
+    REQUIRE(jagged.push_row(second.begin(), second.end()));
+    REQUIRE(!jagged.push_row(first.begin(), first.end()));
+    REQUIRE(jagged.rows() == 3u);
+    REQUIRE(jagged.size() == 14u);
+    REQUIRE(jagged.append_to_last_row(15));
+    REQUIRE(!jagged.append_to_last_row(first.begin(), first.end()));
+    REQUIRE(jagged.size() == 15u);
+
+    auto const offsets = jagged.offsets();
+    REQUIRE(std::vector<std::size_t>(offsets.begin(), offsets.end()) == std::vector<std::size_t>{0u, 3u, 3u, 15u});
+    REQUIRE(jagged[1].empty());
+    REQUIRE(jagged.back().size() == 12u);
+    REQUIRE(jagged.back()[11] == 15);
+    REQUIRE(jagged.front().data() == jagged.elements().data());
+
+    auto const elements = jagged.elements();
+    REQUIRE(std::accumulate(elements.begin(), elements.end(), 0) == 120);
+    for(auto& value : jagged[0]) {
+        value *= 10;
+    }
+    REQUIRE(jagged.elements()[2] == 30);
+
+    std::vector<std::size_t> sizes{};
+    for(auto row : jagged) {
+        sizes.push_back(row.size());
+    }
+    REQUIRE(sizes == std::vector<std::size_t>{3u, 0u, 12u});
+    REQUIRE((*jagged.rbegin()).size() == 12u);
+
+    jagged.erase_row(0);
+    REQUIRE(jagged.rows() == 2u);
+    REQUIRE(jagged[0].empty());
+    REQUIRE(jagged[1][0] == 4);
+    REQUIRE(jagged.size() == 12u);
+    REQUIRE(jagged.push_row(first.begin(), first.end()));
+    REQUIRE(jagged[2][2] == 3);
+}
+
+TEST_CASE("Jagged Interface", "[jagged]") {
+    static_jagged<int, 8, 3> jagged{};
+    REQUIRE(jagged.empty());
+    REQUIRE(jagged.capacity() == 8u);
+    REQUIRE(jagged.row_capacity() == 3u);
+    REQUIRE(!jagged.append_to_last_row(1));
+    REQUIRE(jagged.push_row());
+    REQUIRE(!jagged.empty());
+    REQUIRE(jagged.size() == 0u);
+    REQUIRE(jagged.append_to_last_row(1));
+    REQUIRE(jagged.at(0)[0] == 1);
+    REQUIRE_THROWS_AS(jagged.at(1), std::out_of_range);
+
+    decltype(jagged)::const_iterator it = jagged.begin();
+    REQUIRE((*it)[0] == 1);
+    REQUIRE(jagged.end() - jagged.begin() == 1);
+
+    static_jagged<int, 8, 3> other{};
+    std::vector<int> const values{5, 6, 7};
+    other.push_row(values.begin(), values.end());
+    other.push_row(values.begin(), values.begin() + 1);
+    other.swap(jagged);
+    REQUIRE(jagged.rows() == 2u);
+    REQUIRE(jagged.size() == 4u);
+    REQUIRE(other.rows() == 1u);
+    REQUIRE(other[0][0] == 1);
+    REQUIRE(jagged != other);
+    other = jagged;
+    REQUIRE(jagged == other);
+    jagged.clear();
+    REQUIRE(jagged.empty());
+    REQUIRE(jagged.size() == 0u);
+}
+
+TEST_CASE("Jagged Constexpr", "[jagged]") {
+    constexpr auto jagged = [] {
+        static_jagged<int, 32, 8> j{};
+        for(int r = 0; r < 6; r++) {
+            j.push_row();
+            for(int i = 0; i < r; i++) {
+                j.append_to_last_row(r * 10 + i);
+            }
+        }
+        j.erase_row(2);
+        return j;
+    }();
+    static_assert(jagged.rows() == 5u);
+    static_assert(jagged.size() == 13u);
+    static_assert(jagged[2].size() == 3u);
+    static_assert(jagged[2][0] == 30);
+    static_assert(jagged.back()[4] == 54);
+    static_assert(jagged.offsets()[5] == 13u);
+}
@@ -0,0 +1,145 @@
+#include <catch.hpp>
+
+#include "static_list.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <string>
+
+namespace {
+
+template <typename List, typename Ref>
+bool same(List const& list, Ref const& ref) {
+    return list.size() == ref.size() &&
+           std::equal(list.begin(), list.end(), ref.begin(), ref.end()) &&
+           std::equal(list.rbegin(), list.rend(), ref.rbegin(), ref.rend());
+}
+
+} // namespace
+
+TEST_CASE("List Matches std::list", "[list]") {
+    static_list<std::string, 48> list{};
+    std::list<std::string> ref{};
+    unsigned state = 11u;
+    for(int step = 0; step < 4000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const offset = ref.empty() ? 0u : (state >> 8) % (ref.size() + 1u);
+        auto pos = std::next(list.begin(), static_cast<std::ptrdiff_t>(offset));
+        auto ref_pos = std::next(ref.begin(), static_cast<std::ptrdiff_t>(offset));
+        auto const value = std::to_string(step);
+        switch(state % 7u) {
+            case 0u:
+            case 1u:
+                if(ref_pos != ref.end()) {
+                    auto const next = list.erase(pos);
+                    ref_pos = ref.erase(ref_pos);
+                    REQUIRE(std::distance(list.begin(), next) == std::distance(ref.begin(), ref_pos));
+                }
+                break;
+            case 2u:
+                if(!ref.empty()) {
+                    auto const it = std::next(list.begin(), static_cast<std::ptrdiff_t>(state % ref.size()));
+                    auto const ref_it = std::next(ref.begin(), static_cast<std::ptrdiff_t>(state % ref.size()));
+                    list.splice(pos, it);
+                    ref.splice(ref_pos, ref, ref_it);
+                }
+                break;
+            case 3u:
+                if(!ref.empty()) {
+                    REQUIRE(list.pop_front() == ref.front());
+                    ref.pop_front();
+                }
+                break;
+            case 4u:
+                REQUIRE(list.push_back(value) == (ref.size() < 48u));
+                if(ref.size() < 48u) {
+                    ref.push_back(value);
+                }
+                break;
+            default: {
+                auto const it = list.insert(pos, value);
+                if(ref.size() < 48u) {
+                    REQUIRE(*it == value);
+                    ref.insert(ref_pos, value);
+                }
+                else {
+                    REQUIRE(it == list.end());
+                }
+            }
+        }
+        if(step % 97 == 0) {
+            list.compact();
+        }
+        REQUIRE(same(list, ref));
+    }
+}
+
+TEST_CASE("List Compact Restores Array Order", "[list]") {
+    static_list<int, 16> list{};
+    for(int i = 0; i < 10; i++) {
+        list.push_front(i);
+    }
+    list.erase(std::next(list.begin(), 3));
+    list.erase(std::next(list.begin(), 5));
+    list.splice(list.begin(), std::prev(list.end()));
+    list.push_back(42);
+    auto const before = std::list<int>(list.begin(), list.end());
+
+    list.compact();
+    REQUIRE(same(list, before));
+    for(std::size_t i = 0u; i < list.size(); i++) {
+        REQUIRE(&*std::next(list.begin(), static_cast<std::ptrdiff_t>(i)) == &list.front() + i);
+    }
+
+    REQUIRE(list.push_back(7));
+    REQUIRE(list.back() == 7);
+    REQUIRE(&list.back() == &list.front() + list.size() - 1u);
+}
+
+TEST_CASE("List Interface", "[list]") {
+    static_list<int, 4> list{};
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(list.emplace_back(2));
+    REQUIRE(list.emplace_front(1));
+    REQUIRE(list.emplace(list.end(), 4) != list.end());
+    REQUIRE(list.push_back(5));
+    REQUIRE(list.full());
+    REQUIRE(!list.push_front(0));
+
+    auto const last = list.erase(std::next(list.cbegin()), std::prev(list.cend()));
+    REQUIRE(*last == 5);
+    REQUIRE(list.size() == 2u);
+    REQUIRE(list.pop_back() == 5);
+    REQUIRE(list.front() == 1);
+
+    static_list<int, 4> other{};
+    other.push_back(1);
+    REQUIRE(list == other);
+    other.push_back(2);
+    REQUIRE(list != other);
+    list.swap(other);
+    REQUIRE(list.size() == 2u);
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.push_back(3));
+    REQUIRE(list.front() == 3);
+}
+
+TEST_CASE("List Constexpr", "[list]") {
+    constexpr auto list = [] {
+        static_list<int, 8> l{};
+        for(int i = 0; i < 6; i++) {
+            l.push_back(i);
+        }
+        l.erase(std::next(l.begin(), 2));
+        l.splice(l.begin(), std::prev(l.end()));
+        l.pop_back();
+        return l;
+    }();
+    static_assert(list.size() == 4u);
+    static_assert(list.front() == 5);
+    static_assert(*std::next(list.begin(), 3) == 3);
+}
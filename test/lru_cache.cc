@@ -0,0 +1,145 @@
+#include <catch.hpp>
+
+#include "static_lru_cache.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct bucketed_hash {
+    std::size_t operator()(int key) const noexcept {
+        return static_cast<std::size_t>(key % 3);
+    }
+};
+
+/* Reference LRU, most recently used first */
+template <typename Key, typename T>
+struct reference_lru {
+    std::size_t capacity;
+    std::list<std::pair<Key, T>> order{};
+    std::unordered_map<Key, typename std::list<std::pair<Key, T>>::iterator> index{};
+    std::vector<Key> evicted{};
+
+    T* get(Key const& key) {
+        auto const it = index.find(key);
+        if(it == index.end()) {
+            return nullptr;
+        }
+        order.splice(order.begin(), order, it->second);
+        return &it->second->second;
+    }
+
+    void put(Key const& key, T const& value) {
+        if(auto const value_ptr = get(key)) {
+            *value_ptr = value;
+            return;
+        }
+        if(order.size() == capacity) {
+            evicted.push_back(order.back().first);
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+        order.emplace_front(key, value);
+        index[key] = order.begin();
+    }
+
+    bool erase(Key const& key) {
+        auto const it = index.find(key);
+        if(it == index.end()) {
+            return false;
+        }
+        order.erase(it->second);
+        index.erase(it);
+        return true;
+    }
+};
+
+} // namespace
+
+TEMPLATE_TEST_CASE("LRU Cache Matches Reference", "[lru_cache]", std::hash<int>, bucketed_hash) {
+    std::vector<int> evicted{};
+    auto const on_evict = [&evicted](int key, std::string&) {
+        evicted.push_back(key);
+    };
+    static_lru_cache<int, std::string, 24, decltype(on_evict), TestType> cache{on_evict};
+    reference_lru<int, std::string> ref{24u};
+    unsigned state = 5u;
+    for(int step = 0; step < 4000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const key = static_cast<int>((state >> 8) % 40u);
+        switch(state % 4u) {
+            case 0u: {
+                auto const value = cache.get(key);
+                auto const ref_value = ref.get(key);
+                REQUIRE(!value == !ref_value);
+                if(value) {
+                    REQUIRE(*value == *ref_value);
+                }
+                break;
+            }
+            case 1u:
+                REQUIRE(cache.erase(key) == ref.erase(key));
+                break;
+            default: {
+                auto const value = std::to_string(step);
+                REQUIRE(cache.put(key, value) == value);
+                ref.put(key, value);
+            }
+        }
+        REQUIRE(cache.size() == ref.order.size());
+        if(step % 100 == 0) {
+            REQUIRE(std::equal(cache.begin(), cache.end(), ref.order.begin(), ref.order.end()));
+        }
+    }
+    REQUIRE(evicted == ref.evicted);
+}
+
+TEST_CASE("LRU Cache Recency", "[lru_cache]") {
+    static_lru_cache<std::string, int, 3> cache{};
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    REQUIRE(cache.full());
+
+    REQUIRE(*cache.get("a") == 1);
+    REQUIRE(*cache.peek("b") == 2);
+    cache.put("d", 4);
+    REQUIRE(!cache.contains("b"));
+    REQUIRE(cache.begin()->first == "d");
+    REQUIRE(std::next(cache.begin(), 2)->first == "c");
+
+    cache.put("c", 30);
+    REQUIRE(cache.begin()->second == 30);
+    REQUIRE(cache.get("z") == nullptr);
+
+    cache.clear();
+    REQUIRE(cache.empty());
+    REQUIRE(!cache.contains("a"));
+    REQUIRE(cache.begin() == cache.end());
+}
+
+TEST_CASE("LRU Cache Constexpr", "[lru_cache]") {
+    struct identity {
+        constexpr std::size_t operator()(int key) const noexcept {
+            return static_cast<std::size_t>(key);
+        }
+    };
+    constexpr auto cache = [] {
+        static_lru_cache<int, int, 2, detail::ignore_eviction, identity> c{};
+        c.put(1, 10);
+        c.put(2, 20);
+        c.get(1);
+        c.put(3, 30);
+        return c;
+    }();
+    static_assert(cache.size() == 2u);
+    static_assert(*cache.peek(1) == 10);
+    static_assert(!cache.contains(2));
+}
@@ -0,0 +1,202 @@
+#include <catch.hpp>
+
+#include "packed_statvec.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <std::size_t Bits, std::size_t N, typename T>
+bool same(packed_statvec<Bits, N> const& vec, std::vector<T> const& ref) {
+    return vec.size() == ref.size() && std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()) &&
+           std::equal(vec.rbegin(), vec.rend(), ref.rbegin(), ref.rend());
+}
+
+template <std::size_t Bits>
+void check_pack_unpack() {
+    statvec<std::uint32_t, 300> values{};
+    std::uint32_t state = 7u;
+    for(std::size_t i = 0u; i < 300u; i++) {
+        state = state * 1103515245u + 12345u;
+        values.push_back(state);
+    }
+    packed_statvec<Bits, 300> vec{};
+    for(std::size_t size : {0u, 1u, 63u, 64u, 65u, 200u, 300u}) {
+        statvec<std::uint32_t, 300> prefix{};
+        for(std::size_t i = 0u; i < size; i++) {
+            prefix.push_back(values[i]);
+        }
+        REQUIRE(vec.pack(prefix));
+        REQUIRE(vec.size() == size);
+        auto decoder = vec.decode();
+        for(std::size_t i = 0u; i < size; i++) {
+            auto const expected = static_cast<std::uint32_t>(values[i] & detail::packed_mask<Bits>);
+            REQUIRE(vec[i] == expected);
+            REQUIRE(decoder.next() == expected);
+        }
+        statvec<std::uint32_t, 300> unpacked{};
+        REQUIRE(vec.unpack(unpacked));
+        REQUIRE(unpacked.size() == size);
+        REQUIRE(std::equal(unpacked.begin(), unpacked.end(), vec.begin(), vec.end()));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Packed Statvec Matches std::vector", "[packed]") {
+    packed_statvec<13, 200> vec{};
+    std::vector<std::uint16_t> ref{};
+    unsigned state = 29u;
+    for(int step = 0; step < 6000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const value = static_cast<std::uint16_t>((state >> 9) & 0x1fffu);
+        auto const pos = ref.empty() ? 0u : (state >> 6) % (ref.size() + 1u);
+        switch(state % 8u) {
+            case 0u:
+                if(pos < ref.size()) {
+                    auto const it = vec.erase(vec.cbegin() + pos);
+                    ref.erase(ref.begin() + pos);
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                }
+                break;
+            case 1u: {
+                auto const it = vec.insert(vec.cbegin() + pos, value);
+                if(ref.size() < 200u) {
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                    ref.insert(ref.begin() + pos, value);
+                }
+                else {
+                    REQUIRE(it == vec.end());
+                }
+                break;
+            }
+            case 2u:
+                if(pos < ref.size()) {
+                    vec[pos] = value;
+                    ref[pos] = value;
+                }
+                break;
+            case 3u: {
+                auto const size = (state >> 4) % 210u;
+                REQUIRE(vec.resize(size, value) == (size <= 200u));
+                ref.resize(std::min(size, 200u), value);
+                break;
+            }
+            case 4u:
+                if(!ref.empty()) {
+                    REQUIRE(vec.pop_back() == ref.back());
+                    ref.pop_back();
+                }
+                break;
+            default:
+                REQUIRE(vec.push_back(value) == (ref.size() < 200u));
+                if(ref.size() < 200u) {
+                    ref.push_back(value);
+                }
+        }
+        REQUIRE(vec.size() == ref.size());
+        if(step % 50 == 0) {
+            REQUIRE(same(vec, ref));
+        }
+    }
+}
+
+TEST_CASE("Packed Statvec Pack Unpack", "[packed]") {
+    check_pack_unpack<1>();
+    check_pack_unpack<3>();
+    check_pack_unpack<7>();
+    check_pack_unpack<12>();
+    check_pack_unpack<17>();
+    check_pack_unpack<31>();
+    check_pack_unpack<32>();
+
+    statvec<std::uint8_t, 100> bytes{};
+    bytes.assign(100u, std::uint8_t{0xffu});
+    packed_statvec<5, 64> vec{};
+    REQUIRE(!vec.pack(bytes));
+    REQUIRE(vec.full());
+    REQUIRE(std::all_of(vec.begin(), vec.end(), [](auto v) { return v == 31u; }));
+    statvec<std::uint8_t, 10> small{};
+    REQUIRE(!vec.unpack(small));
+    REQUIRE(small.size() == 10u);
+
+    auto decoder = vec.decode(40u);
+    vec[40] = 3u;
+    REQUIRE(decoder.next() == 3u);
+    REQUIRE(decoder.next() == 31u);
+}
+
+TEST_CASE("Packed Statvec Interface", "[packed]") {
+    packed_statvec<4, 20> vec{};
+    static_assert(std::is_same_v<decltype(vec)::value_type, std::uint8_t>);
+    static_assert(std::is_same_v<packed_statvec<9, 4>::value_type, std::uint16_t>);
+    static_assert(std::is_same_v<packed_statvec<20, 4>::value_type, std::uint32_t>);
+    static_assert(sizeof(packed_statvec<4, 128>) == 9u * sizeof(std::uint64_t) + sizeof(std::size_t));
+
+    REQUIRE(vec.empty());
+    REQUIRE(vec.assign(20u, 0x1au));
+    REQUIRE(vec.full());
+    REQUIRE(vec.front() == 0xau);
+    REQUIRE(vec.data()[0] == 0xaaaaaaaaaaaaaaaau);
+    REQUIRE(!vec.push_back(1u));
+
+    vec[3] = 5u;
+    vec.at(19) = vec[3];
+    REQUIRE(vec.back() == 5u);
+    REQUIRE_THROWS_AS(vec.at(20), std::out_of_range);
+
+    auto it = vec.begin();
+    *it = 1u;
+    it[1] = 2u;
+    REQUIRE(std::distance(vec.begin(), vec.end()) == 20);
+    REQUIRE(vec.cbegin()[1] == 2u);
+
+    std::vector<int> const ints{1, 2, 3, 4};
+    packed_statvec<4, 20> other{};
+    REQUIRE(other.assign(ints.begin(), ints.end()));
+    other.swap(vec);
+    REQUIRE(vec.size() == 4u);
+    REQUIRE(other.size() == 20u);
+    REQUIRE(vec[2] == 3u);
+    REQUIRE(vec != other);
+    other = vec;
+    REQUIRE(vec == other);
+    vec.clear();
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("Packed Statvec Constexpr", "[packed]") {
+    constexpr auto vec = [] {
+        statvec<std::uint16_t, 100> values{};
+        for(std::uint16_t i = 0u; i < 100u; i++) {
+            values.push_back(static_cast<std::uint16_t>(i * 37u));
+        }
+        packed_statvec<11, 100> v{};
+        v.pack(values);
+        v.erase(v.cbegin());
+        v.insert(v.cbegin() + 5, 2000u);
+        return v;
+    }();
+    static_assert(vec.size() == 100u);
+    static_assert(vec[0] == 37u);
+    static_assert(vec[5] == 2000u);
+    static_assert(vec[99] == (99u * 37u) % 2048u);
+
+    constexpr auto sum = [&] {
+        statvec<std::uint32_t, 100> values{};
+        vec.unpack(values);
+        std::uint32_t total = 0u;
+        auto decoder = vec.decode();
+        for(auto value : values) {
+            total += value - decoder.next();
+        }
+        return total;
+    }();
+    static_assert(sum == 0u);
+}
@@ -0,0 +1,115 @@
+#include <catch.hpp>
+
+#include "static_perfect_hash_map.h"
+#include "statvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace std::string_view_literals;
+
+namespace {
+
+enum class opcode : std::uint8_t { nop, load, store, jump, halt };
+
+constexpr static_perfect_hash_map keywords{statvec{
+    std::pair{"if"sv, 1}, std::pair{"else"sv, 2}, std::pair{"while"sv, 3}, std::pair{"for"sv, 4},
+    std::pair{"return"sv, 5}, std::pair{"break"sv, 6}, std::pair{"continue"sv, 7}, std::pair{"switch"sv, 8},
+    std::pair{"case"sv, 9}, std::pair{"default"sv, 10}, std::pair{"do"sv, 11}, std::pair{"goto"sv, 12}
+}};
+
+constexpr auto make_squares() {
+    /* std::pair is not assignable in constant expressions before C++20 */
+    std::array<std::pair<std::uint32_t, std::uint32_t>, 1000> entries{};
+    for(std::uint32_t i = 0u; i < 1000u; i++) {
+        entries[i].first = i * 7919u;
+        entries[i].second = i * i;
+    }
+    return static_perfect_hash_map{statvec{entries}};
+}
+
+} // namespace
+
+TEST_CASE("Perfect Hash Map Keywords", "[perfect_hash_map]") {
+    STATIC_REQUIRE(keywords.size() == 12u);
+    STATIC_REQUIRE(*keywords.find("while"sv) == 3);
+    STATIC_REQUIRE(!keywords.contains("elif"sv));
+
+    std::string const input = "continue";
+    REQUIRE(keywords.at(input) == 7);
+    REQUIRE(keywords.find("") == nullptr);
+    REQUIRE(keywords.count("goto") == 1u);
+    REQUIRE_THROWS_AS(keywords.at("until"), std::out_of_range);
+
+    int sum = 0;
+    for(auto const& [key, value] : keywords) {
+        REQUIRE(*keywords.find(key) == value);
+        sum += value;
+    }
+    REQUIRE(sum == 78);
+}
+
+TEST_CASE("Perfect Hash Map Large Table", "[perfect_hash_map]") {
+    static constexpr auto squares = make_squares();
+    STATIC_REQUIRE(squares.size() == 1000u);
+    for(std::uint32_t i = 0u; i < 1000u; i++) {
+        REQUIRE(squares.at(i * 7919u) == i * i);
+        REQUIRE(!squares.contains(i * 7919u + 1u));
+    }
+}
+
+TEST_CASE("Perfect Hash Map Partially Filled", "[perfect_hash_map]") {
+    constexpr static_perfect_hash_map<opcode, std::size_t, 8> opcodes{statvec<std::pair<opcode, std::size_t>, 8>{
+        std::pair{opcode::load, std::size_t{2}}, std::pair{opcode::store, std::size_t{2}}, std::pair{opcode::jump, std::size_t{1}}
+    }};
+    STATIC_REQUIRE(opcodes.size() == 3u);
+    STATIC_REQUIRE(opcodes.capacity() == 8u);
+    STATIC_REQUIRE(opcodes.at(opcode::jump) == 1u);
+    STATIC_REQUIRE(!opcodes.contains(opcode::nop));
+    STATIC_REQUIRE(!opcodes.contains(opcode::halt));
+
+    constexpr static_perfect_hash_map<int, int, 4> none{statvec<std::pair<int, int>, 4>{}};
+    STATIC_REQUIRE(none.empty());
+    STATIC_REQUIRE(!none.contains(0));
+}
+
+TEST_CASE("Perfect Hash Map Rejects Duplicate Keys", "[perfect_hash_map]") {
+    statvec<std::pair<int, int>, 4> const entries{std::pair{1, 1}, std::pair{2, 2}, std::pair{1, 3}};
+    REQUIRE_THROWS_AS(static_perfect_hash_map{entries}, std::invalid_argument);
+}
+
+TEST_CASE("Perfect Hash Map Compares Character Pointers By Content", "[perfect_hash_map]") {
+    constexpr static_perfect_hash_map<char const*, int, 4> names{statvec<std::pair<char const*, int>, 4>{
+        std::pair{"alpha", 1}, std::pair{"beta", 2}, std::pair{"gamma", 3}
+    }};
+    std::string const key = "beta";
+    REQUIRE(names.find(key.c_str()) != nullptr);
+    REQUIRE(names.at(key.c_str()) == 2);
+    REQUIRE(!names.contains("delta"));
+
+    std::string const first = "alpha";
+    std::string const second = "alpha";
+    statvec<std::pair<char const*, int>, 4> const entries{std::pair{first.c_str(), 1}, std::pair{second.c_str(), 2}};
+    REQUIRE_THROWS_AS((static_perfect_hash_map<char const*, int, 4>{entries}), std::invalid_argument);
+}
+
+TEST_CASE("Perfect Hash Map String Hash Matches Constant Evaluation", "[perfect_hash_map]") {
+    constexpr detail::constexpr_hash<std::string_view> hash{};
+    constexpr std::string_view text = "the quick brown fox jumps over the lazy dog";
+    constexpr auto hashes = [&] {
+        std::array<std::uint64_t, text.size() + 1u> result{};
+        for(std::size_t i = 0u; i <= text.size(); i++) {
+            result[i] = hash(text.substr(0u, i));
+        }
+        return result;
+    }();
+    for(std::size_t i = 0u; i <= text.size(); i++) {
+        std::string const key{text.substr(0u, i)};
+        REQUIRE(hash(key) == hashes[i]);
+    }
+}
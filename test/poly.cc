@@ -0,0 +1,251 @@
+#include <catch.hpp>
+
+#include "poly_statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int live = 0;
+
+/* No virtual destructor, the container destroys objects through their concrete type */
+struct shape {
+    shape() noexcept { ++live; }
+    shape(shape const&) noexcept { ++live; }
+    shape(shape&&) noexcept { ++live; }
+    ~shape() { --live; }
+
+    virtual std::string describe() const = 0;
+};
+
+struct dot final : shape {
+    std::uint8_t tag;
+
+    explicit dot(std::uint8_t t) noexcept : tag{t} { }
+    std::string describe() const override { return "dot" + std::to_string(tag); }
+};
+
+struct label final : shape {
+    std::string text;
+
+    explicit label(std::string t) noexcept : text{std::move(t)} { }
+    std::string describe() const override { return "label" + text; }
+};
+
+struct alignas(32) block final : shape {
+    double values[5];
+
+    explicit block(double v) noexcept : values{v, v, v, v, v} { }
+    std::string describe() const override { return "block" + std::to_string(static_cast<int>(values[4])); }
+};
+
+template <typename Poly>
+std::vector<std::string> describe(Poly const& poly) {
+    std::vector<std::string> out{};
+    for(auto const& s : poly) {
+        out.push_back(s.describe());
+    }
+    return out;
+}
+
+std::size_t type_of(std::string const& description) {
+    return description[0] == 'd' ? 0u : description[0] == 'l' ? 1u : 2u;
+}
+
+} // namespace
+
+TEST_CASE("Poly Statvec Matches std::vector", "[poly]") {
+    {
+        poly_statvec<shape, 1024, 24, 32> poly{};
+        std::vector<std::string> ref{};
+        unsigned state = 7u;
+        for(int step = 0; step < 5000; step++) {
+            state = state * 1103515245u + 12345u;
+            auto const value = (state >> 8) % 200u;
+            switch(state % 7u) {
+                case 0u:
+                case 1u: {
+                    auto const used = poly.bytes_used();
+                    auto const ok = poly.emplace_back<dot>(static_cast<std::uint8_t>(value));
+                    REQUIRE(ok == (ref.size() < 24u && used + sizeof(dot) <= 1024u));
+                    if(ok) {
+                        ref.push_back("dot" + std::to_string(value));
+                    }
+                    break;
+                }
+                case 2u: {
+                    auto const text = std::string(value % 40u, 'x') + std::to_string(value);
+                    if(poly.push_back(label{text})) {
+                        ref.push_back("label" + text);
+                    }
+                    else {
+                        REQUIRE((ref.size() == 24u || ((poly.bytes_used() + alignof(label) - 1u) & ~(alignof(label) - 1u)) + sizeof(label) > 1024u));
+                    }
+                    break;
+                }
+                case 3u:
+                    if(poly.emplace_back<block>(static_cast<double>(value))) {
+                        ref.push_back("block" + std::to_string(value));
+                    }
+                    else {
+                        REQUIRE((ref.size() == 24u || ((poly.bytes_used() + 31u) & ~std::size_t{31u}) + sizeof(block) > 1024u));
+                    }
+                    break;
+                case 4u:
+                    if(!ref.empty()) {
+                        auto const i = static_cast<std::ptrdiff_t>(value % ref.size());
+                        auto const it = poly.erase(poly.cbegin() + i);
+                        REQUIRE(it - poly.begin() == i);
+                        ref.erase(ref.begin() + i);
+                    }
+                    break;
+                case 5u:
+                    if(!ref.empty()) {
+                        poly.pop_back();
+                        ref.pop_back();
+                    }
+                    break;
+                default:
+                    if(value < 20u) {
+                        poly.sort_by_type();
+                        std::vector<std::string> sorted{};
+                        std::vector<bool> done(ref.size());
+                        for(std::size_t i = 0u; i < ref.size(); i++) {
+                            if(done[i]) {
+                                continue;
+                            }
+                            for(std::size_t j = i; j < ref.size(); j++) {
+                                if(!done[j] && type_of(ref[j]) == type_of(ref[i])) {
+                                    sorted.push_back(ref[j]);
+                                    done[j] = true;
+                                }
+                            }
+                        }
+                        ref = sorted;
+                    }
+                    else if(value < 24u) {
+                        poly.clear();
+                        ref.clear();
+                    }
+            }
+            REQUIRE(poly.size() == ref.size());
+            REQUIRE(live == static_cast<int>(ref.size()));
+            if(step % 20 == 0) {
+                REQUIRE(describe(poly) == ref);
+            }
+        }
+    }
+    REQUIRE(live == 0);
+}
+
+TEST_CASE("Poly Statvec Placement", "[poly]") {
+    auto constexpr block_start = (sizeof(dot) + alignof(block) - 1u) / alignof(block) * alignof(block);
+    poly_statvec<shape, 256, 8, 32> poly{};
+    REQUIRE(poly.emplace_back<dot>(std::uint8_t{1}));
+    REQUIRE(poly.bytes_used() == sizeof(dot));
+    REQUIRE(poly.emplace_back<block>(2.0));
+    REQUIRE(poly.emplace_back<dot>(std::uint8_t{3}));
+    REQUIRE(reinterpret_cast<std::uintptr_t>(&poly[1]) % 32u == 0u);
+    REQUIRE(reinterpret_cast<unsigned char const*>(&poly[1]) - reinterpret_cast<unsigned char const*>(&poly[0]) ==
+            static_cast<std::ptrdiff_t>(block_start));
+    REQUIRE(poly.holds<block>(1));
+    REQUIRE(!poly.holds<dot>(1));
+
+    auto const used = poly.bytes_used();
+    REQUIRE(used == block_start + sizeof(block) + sizeof(dot));
+    poly.erase(poly.begin() + 1);
+    REQUIRE(poly.bytes_used() == used);
+    REQUIRE(describe(poly) == std::vector<std::string>{"dot1", "dot3"});
+    poly.pop_back();
+    REQUIRE(poly.bytes_used() == sizeof(dot));
+    REQUIRE(poly.emplace_back<block>(4.0));
+    REQUIRE(poly.bytes_used() == block_start + sizeof(block));
+
+    auto blocks = 1u;
+    while(poly.emplace_back<block>(5.0)) {
+        ++blocks;
+    }
+    REQUIRE(blocks == (256u - block_start) / sizeof(block));
+    REQUIRE(poly.bytes_used() == block_start + blocks * sizeof(block));
+    while(poly.emplace_back<dot>(std::uint8_t{6})) { }
+    REQUIRE(poly.bytes_used() + sizeof(dot) > 256u);
+    REQUIRE(!poly.full());
+
+    poly_statvec<shape, 256, 2> few{};
+    REQUIRE(few.emplace_back<dot>(std::uint8_t{0}));
+    REQUIRE(few.emplace_back<dot>(std::uint8_t{0}));
+    REQUIRE(few.full());
+    REQUIRE(!few.emplace_back<dot>(std::uint8_t{0}));
+}
+
+TEST_CASE("Poly Statvec Sort By Type", "[poly]") {
+    poly_statvec<shape, 1024, 16, 32> poly{};
+    poly.emplace_back<label>("a");
+    poly.emplace_back<dot>(std::uint8_t{1});
+    poly.emplace_back<block>(2.0);
+    poly.emplace_back<dot>(std::uint8_t{3});
+    poly.emplace_back<label>("b");
+    poly.emplace_back<block>(4.0);
+    poly.emplace_back<dot>(std::uint8_t{5});
+    auto const* const first = &poly[1];
+    poly.sort_by_type();
+    REQUIRE(describe(poly) == std::vector<std::string>{"labela", "labelb", "dot1", "dot3", "dot5", "block2", "block4"});
+    REQUIRE(&poly[2] == first);
+    poly.sort_by_type();
+    REQUIRE(describe(poly) == std::vector<std::string>{"labela", "labelb", "dot1", "dot3", "dot5", "block2", "block4"});
+
+    auto const used = poly.bytes_used();
+    poly.pop_back();
+    poly.pop_back();
+    REQUIRE(poly.bytes_used() == used);
+    poly.pop_back();
+    REQUIRE(reinterpret_cast<unsigned char const*>(&poly[0]) + poly.bytes_used() ==
+            reinterpret_cast<unsigned char const*>(&poly[1]) + sizeof(label));
+}
+
+TEST_CASE("Poly Statvec Interface", "[poly]") {
+    {
+        poly_statvec<shape, 512, 8, 32> poly{};
+        REQUIRE(poly.empty());
+        REQUIRE(poly.capacity() == 8u);
+        REQUIRE(poly.max_size() == 8u);
+        REQUIRE(poly.byte_capacity() == 512u);
+        poly.emplace_back<label>("x");
+        poly.emplace_back<dot>(std::uint8_t{2});
+        REQUIRE(poly.front().describe() == "labelx");
+        REQUIRE(poly.back().describe() == "dot2");
+        REQUIRE(poly.at(1).describe() == "dot2");
+        REQUIRE_THROWS_AS(poly.at(2), std::out_of_range);
+
+        decltype(poly)::const_iterator it = poly.begin();
+        REQUIRE(it->describe() == "labelx");
+        REQUIRE(poly.rbegin()->describe() == "dot2");
+        REQUIRE(poly.end() - poly.begin() == 2);
+
+        poly_statvec<shape, 512, 8, 32> other{};
+        other.emplace_back<block>(7.0);
+        other.swap(poly);
+        REQUIRE(describe(poly) == std::vector<std::string>{"block7"});
+        REQUIRE(describe(other) == std::vector<std::string>{"labelx", "dot2"});
+        REQUIRE(live == 3);
+
+        auto moved{std::move(other)};
+        REQUIRE(other.empty());
+        REQUIRE(other.bytes_used() == 0u);
+        REQUIRE(describe(moved) == std::vector<std::string>{"labelx", "dot2"});
+        REQUIRE(moved.holds<label>(0));
+        poly = std::move(moved);
+        REQUIRE(describe(poly) == std::vector<std::string>{"labelx", "dot2"});
+        REQUIRE(live == 2);
+        poly.clear();
+        REQUIRE(poly.empty());
+        REQUIRE(live == 0);
+        poly.emplace_back<dot>(std::uint8_t{9});
+    }
+    REQUIRE(live == 0);
+}
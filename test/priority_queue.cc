@@ -0,0 +1,115 @@
+#include <catch.hpp>
+
+#include "static_priority_queue.h"
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("Priority Queue Matches std::priority_queue", "[priority_queue]", ((std::size_t Arity), Arity), 2, 3, 4) {
+    static_priority_queue<int, 64, std::less<int>, Arity> queue{};
+    std::priority_queue<int> ref{};
+    unsigned state = 1u;
+    for(int step = 0; step < 2000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const value = static_cast<int>(state >> 16) % 100;
+        switch(state % 4u) {
+            case 0u:
+                if(!queue.empty()) {
+                    REQUIRE(queue.pop() == ref.top());
+                    ref.pop();
+                }
+                break;
+            case 1u:
+                if(!queue.empty()) {
+                    REQUIRE(queue.replace_top(value) == ref.top());
+                    ref.pop();
+                    ref.push(value);
+                }
+                break;
+            case 2u: {
+                ref.push(value);
+                REQUIRE(queue.push_pop(value) == ref.top());
+                ref.pop();
+                break;
+            }
+            default:
+                REQUIRE(queue.push(value) == (ref.size() < 64u));
+                if(ref.size() < 64u) {
+                    ref.push(value);
+                }
+        }
+        REQUIRE(queue.size() == ref.size());
+        if(!ref.empty()) {
+            REQUIRE(queue.top() == ref.top());
+        }
+    }
+}
+
+TEST_CASE("Priority Queue Heapify", "[priority_queue]") {
+    statvec<int, 32> values{5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+    static_priority_queue<int, 32> queue{values};
+    REQUIRE(queue.size() == 10u);
+    REQUIRE(queue.top() == 9);
+
+    std::vector<int> more(30);
+    for(std::size_t i = 0u; i < more.size(); i++) {
+        more[i] = static_cast<int>(i * 37u % 101u);
+    }
+    REQUIRE(!queue.push_range(more.begin(), more.end()));
+    REQUIRE(queue.full());
+    REQUIRE(queue.push_pop(1000) == 1000);
+
+    auto const sorted = queue.take_sorted();
+    REQUIRE(queue.empty());
+    REQUIRE(sorted.size() == 32u);
+    REQUIRE(std::is_sorted(sorted.begin(), sorted.end()));
+    REQUIRE(sorted.back() == *std::max_element(more.begin(), more.begin() + 22));
+}
+
+TEST_CASE("Priority Queue Bounded Top-K", "[priority_queue]") {
+    static_priority_queue<int, 5, std::greater<int>, 4> best{};
+    std::vector<int> all{};
+    for(int i = 0; i < 200; i++) {
+        auto const value = i * 7919 % 211;
+        all.push_back(value);
+        best.offer(value);
+    }
+    REQUIRE(best.full());
+    REQUIRE(!best.offer(-1));
+
+    std::sort(all.begin(), all.end(), std::greater<int>{});
+    auto const top = best.take_sorted();
+    REQUIRE(std::equal(top.begin(), top.end(), all.begin()));
+}
+
+TEST_CASE("Priority Queue Move-Only Elements", "[priority_queue]") {
+    auto const less = [](std::unique_ptr<int> const& lhs, std::unique_ptr<int> const& rhs) {
+        return *lhs < *rhs;
+    };
+    static_priority_queue<std::unique_ptr<int>, 8, decltype(less)> queue{{}, less};
+    for(int i : {4, 1, 6, 3}) {
+        REQUIRE(queue.emplace(new int{i}));
+    }
+    REQUIRE(*queue.pop() == 6);
+    REQUIRE(*queue.replace_top(std::make_unique<int>(0)) == 4);
+    REQUIRE(*queue.top() == 3);
+}
+
+TEST_CASE("Priority Queue Constexpr", "[priority_queue]") {
+    constexpr auto sorted = [] {
+        static_priority_queue<int, 8, std::less<int>, 3> queue{};
+        for(int i : {5, 2, 7, 1, 9, 3}) {
+            queue.push(i);
+        }
+        queue.pop();
+        queue.push_pop(4);
+        return queue.take_sorted();
+    }();
+    static_assert(sorted.size() == 5u);
+    static_assert(sorted[0] == 1 && sorted[1] == 2 && sorted[2] == 3 && sorted[3] == 4 && sorted[4] == 5);
+}
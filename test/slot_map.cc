@@ -0,0 +1,127 @@
+#include <catch.hpp>
+
+#include "static_slot_map.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("Slot Map Handles Survive Erasure Of Others", "[slot_map]") {
+    static_slot_map<std::string, 32> map{};
+    std::vector<std::pair<slot_map_handle, std::string>> live{};
+    std::vector<slot_map_handle> dead{};
+    unsigned state = 7u;
+    for(int step = 0; step < 3000; step++) {
+        state = state * 1103515245u + 12345u;
+        if(state % 3u == 0u && !live.empty()) {
+            auto const victim = (state >> 8) % live.size();
+            REQUIRE(map.erase(live[victim].first));
+            dead.push_back(live[victim].first);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(victim));
+        }
+        else {
+            auto const value = std::to_string(step);
+            auto const h = map.insert(value);
+            REQUIRE(static_cast<bool>(h) == (live.size() < 32u));
+            if(h) {
+                live.emplace_back(h, value);
+            }
+        }
+        REQUIRE(map.size() == live.size());
+        if(step % 100 == 0) {
+            for(auto const& [h, value] : live) {
+                REQUIRE(map.at(h) == value);
+            }
+            for(auto h : dead) {
+                REQUIRE(!map.contains(h));
+                REQUIRE(map.find(h) == nullptr);
+            }
+        }
+    }
+}
+
+TEST_CASE("Slot Map Rejects Invalid Handles", "[slot_map]") {
+    static_slot_map<int, 4> map{};
+    REQUIRE(!map.contains(slot_map_handle{}));
+    REQUIRE(!map.contains(slot_map_handle{0u, 1u}));
+
+    auto const a = map.insert(1);
+    REQUIRE(a);
+    REQUIRE(map.contains(a));
+    REQUIRE(!map.contains(slot_map_handle{a.index, a.generation + 2u}));
+    REQUIRE(!map.contains(slot_map_handle{1000u, a.generation}));
+
+    REQUIRE(map.erase(a));
+    REQUIRE(!map.erase(a));
+    REQUIRE_THROWS_AS(map.at(a), std::out_of_range);
+
+    auto const b = map.insert(2);
+    REQUIRE(b.index == a.index);
+    REQUIRE(b != a);
+    REQUIRE(!map.contains(a));
+    REQUIRE(map[b] == 2);
+
+    for(int i = 0; i < 3; i++) {
+        REQUIRE(map.emplace(i));
+    }
+    REQUIRE(map.full());
+    REQUIRE(!map.insert(5));
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(!map.contains(b));
+    REQUIRE(map.insert(6));
+}
+
+TEST_CASE("Slot Map Iteration And Erasure", "[slot_map]") {
+    static_slot_map<int, 16> map{};
+    slot_map_handle handles[10]{};
+    for(int i = 0; i < 10; i++) {
+        handles[i] = map.insert(i);
+    }
+    for(auto it = map.begin(); it != map.end();) {
+        if(*it % 2) {
+            it = map.erase(it);
+        }
+        else {
+            REQUIRE(map.handle_of(it) == handles[*it]);
+            ++it;
+        }
+    }
+    REQUIRE(map.size() == 5u);
+    for(int i = 0; i < 10; i++) {
+        REQUIRE(map.contains(handles[i]) == (i % 2 == 0));
+        if(i % 2 == 0) {
+            REQUIRE(map[handles[i]] == i);
+        }
+    }
+
+    int sum = 0;
+    for(auto const* it = map.data(); it != map.data() + map.size(); ++it) {
+        sum += *it;
+    }
+    REQUIRE(sum == 20);
+
+    static_slot_map<int, 16> other{};
+    auto const h = other.insert(42);
+    map.swap(other);
+    REQUIRE(map.size() == 1u);
+    REQUIRE(map[h] == 42);
+    REQUIRE(other[handles[4]] == 4);
+}
+
+TEST_CASE("Slot Map Constexpr", "[slot_map]") {
+    constexpr auto result = [] {
+        static_slot_map<int, 4> map{};
+        auto const a = map.insert(1);
+        auto const b = map.insert(2);
+        map.insert(3);
+        map.erase(a);
+        auto const c = map.insert(4);
+        return std::pair{map[b] + map[c], map.contains(a)};
+    }();
+    static_assert(result.first == 6);
+    static_assert(!result.second);
+}
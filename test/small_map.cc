@@ -0,0 +1,118 @@
+#include <catch.hpp>
+
+#include "static_small_map.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+
+enum class attribute : std::uint16_t { host, path, cookie, agent };
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Small Map Matches std::unordered_map", "[small_map]",
+                   std::int8_t, std::uint16_t, std::int32_t, std::uint64_t, std::string) {
+    static_small_map<TestType, int, 37> map{};
+    std::unordered_map<TestType, int> ref{};
+
+    auto const make_key = [](unsigned i) {
+        if constexpr(std::is_same_v<TestType, std::string>) {
+            return std::to_string(i % 61u);
+        }
+        else {
+            return static_cast<TestType>(i % 61u);
+        }
+    };
+
+    for(unsigned step = 0; step < 1000; step++) {
+        auto const key = make_key(step * 2654435761u >> 7);
+        if(step % 3u == 0u) {
+            REQUIRE(map.erase(key) == (ref.erase(key) == 1u));
+        }
+        else if(!map.full() || map.contains(key)) {
+            REQUIRE(map.insert_or_assign(key, static_cast<int>(step)));
+            ref.insert_or_assign(key, static_cast<int>(step));
+        }
+        REQUIRE(map.size() == ref.size());
+        for(unsigned i = 0; i < 61u; i++) {
+            auto const k = make_key(i);
+            auto const it = ref.find(k);
+            auto const value = map.find(k);
+            REQUIRE((it == ref.end()) == !value);
+            if(value) {
+                REQUIRE(*value == it->second);
+            }
+        }
+    }
+}
+
+TEST_CASE("Small Map Ignores Stale Keys Past Size", "[small_map]") {
+    static_small_map<std::uint32_t, int, 16> map{};
+    for(std::uint32_t i = 0u; i < 16u; i++) {
+        map.try_emplace(i, static_cast<int>(i));
+    }
+    while(map.size() > 3u) {
+        map.erase_at(map.size() - 1u);
+    }
+    REQUIRE(!map.contains(7u));
+    REQUIRE(map.find(15u) == nullptr);
+    REQUIRE(map.index_of(2u) == 2u);
+}
+
+TEST_CASE("Small Map Interface", "[small_map]") {
+    static_small_map<attribute, std::string, 3> map{};
+    auto [value, inserted] = map.try_emplace(attribute::host, "example.org");
+    REQUIRE(inserted);
+    REQUIRE(*value == "example.org");
+    std::tie(value, inserted) = map.try_emplace(attribute::host, "other");
+    REQUIRE(!inserted);
+    REQUIRE(*value == "example.org");
+
+    REQUIRE(map.insert_or_assign(attribute::path, "/"));
+    REQUIRE(map.insert_or_assign(attribute::agent, "curl"));
+    REQUIRE(map.full());
+    REQUIRE(!map.insert_or_assign(attribute::cookie, "id=1"));
+    REQUIRE(map.try_emplace(attribute::cookie, "id=1").first == nullptr);
+
+    REQUIRE(map.at(attribute::path) == "/");
+    REQUIRE_THROWS_AS(map.at(attribute::cookie), std::out_of_range);
+
+    REQUIRE(map.erase(attribute::host));
+    REQUIRE(!map.erase(attribute::host));
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.key_at(0) == attribute::agent);
+    REQUIRE(map.value_at(0) == "curl");
+    REQUIRE(map.keys().size() == 2);
+    for(auto& v : map.values()) {
+        v += "!";
+    }
+    REQUIRE(map.at(attribute::agent) == "curl!");
+
+    static_small_map<attribute, std::string, 3> other{};
+    other.insert_or_assign(attribute::agent, "curl!");
+    other.insert_or_assign(attribute::path, "/!");
+    REQUIRE(map == other);
+    other.clear();
+    REQUIRE(map != other);
+    map.swap(other);
+    REQUIRE(map.empty());
+}
+
+TEST_CASE("Small Map Constexpr", "[small_map]") {
+    constexpr auto map = [] {
+        static_small_map<int, int, 4> m{};
+        m.insert_or_assign(1, 10);
+        m.insert_or_assign(2, 20);
+        m.insert_or_assign(3, 30);
+        m.erase(1);
+        return m;
+    }();
+    static_assert(map.size() == 2);
+    static_assert(*map.find(3) == 30);
+    static_assert(!map.contains(1));
+}
@@ -0,0 +1,227 @@
+#include <catch.hpp>
+
+#include "small_vector.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T, std::size_t N>
+bool same(small_vector<T, N> const& vec, std::vector<T> const& ref) {
+    return vec.size() == ref.size() && std::equal(std::begin(vec), std::end(vec), std::begin(ref));
+}
+
+} // namespace
+
+TEST_CASE("Small Vector Matches std::vector", "[small_vector]") {
+    small_vector<std::string, 8> vec{};
+    std::vector<std::string> ref{};
+    unsigned state = 7u;
+    for(int step = 0; step < 20000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const pos = ref.empty() ? 0u : (state >> 4) % (ref.size() + 1u);
+        auto const count = (state >> 10) % 6u;
+        auto const value = std::to_string(state >> 16);
+        switch(state % 10u) {
+            case 0u:
+            case 1u:
+                REQUIRE(vec.push_back(value));
+                ref.push_back(value);
+                break;
+            case 2u:
+                REQUIRE(*vec.insert(std::begin(vec) + pos, value) == value);
+                ref.insert(std::begin(ref) + pos, value);
+                break;
+            case 3u: {
+                auto const it = vec.insert(std::begin(vec) + pos, count, value);
+                REQUIRE(it == std::begin(vec) + pos);
+                ref.insert(std::begin(ref) + pos, count, value);
+                break;
+            }
+            case 4u: {
+                std::vector<std::string> const range(count, value + "r");
+                vec.insert(std::begin(vec) + pos, std::begin(range), std::end(range));
+                ref.insert(std::begin(ref) + pos, std::begin(range), std::end(range));
+                break;
+            }
+            case 5u:
+                if(!ref.empty()) {
+                    REQUIRE(vec.pop_back() == ref.back());
+                    ref.pop_back();
+                }
+                break;
+            case 6u:
+                if(pos < ref.size()) {
+                    auto const last = std::min<std::size_t>(pos + count, ref.size());
+                    vec.erase(std::begin(vec) + pos, std::begin(vec) + last);
+                    ref.erase(std::begin(ref) + pos, std::begin(ref) + last);
+                }
+                break;
+            case 7u:
+                if(!ref.empty()) {
+                    /* Pushing one of its own elements must survive the reallocation */
+                    REQUIRE(vec.push_back(vec.front()));
+                    ref.push_back(ref.front());
+                }
+                break;
+            case 8u:
+                if((state >> 8) % 8u == 0u) {
+                    vec.shrink_to_fit();
+                    REQUIRE(vec.is_inline() == (ref.size() <= 8u));
+                    REQUIRE(vec.capacity() == std::max<std::size_t>(ref.size(), 8u));
+                }
+                else if((state >> 8) % 8u == 1u) {
+                    vec.clear();
+                    ref.clear();
+                }
+                break;
+            default:
+                REQUIRE(*vec.emplace(std::begin(vec) + pos, 3u, 'e') == "eee");
+                ref.emplace(std::begin(ref) + pos, 3u, 'e');
+        }
+        REQUIRE(same(vec, ref));
+        REQUIRE(vec.capacity() >= vec.size());
+        REQUIRE(vec.is_inline() == (vec.capacity() == 8u));
+    }
+}
+
+TEST_CASE("Small Vector Spills And Returns Inline", "[small_vector]") {
+    small_vector<int, 4> vec{1, 2, 3};
+    auto const* const inline_data = vec.data();
+    REQUIRE(vec.is_inline());
+    REQUIRE(vec.capacity() == 4u);
+    REQUIRE(vec.inline_capacity() == 4u);
+
+    REQUIRE(vec.push_back(4));
+    REQUIRE(vec.is_inline());
+    REQUIRE(vec.data() == inline_data);
+    REQUIRE(vec.push_back(5));
+    REQUIRE(!vec.is_inline());
+    REQUIRE(vec.data() != inline_data);
+    REQUIRE(vec.capacity() == 8u);
+    REQUIRE(vec == small_vector<int, 4>{1, 2, 3, 4, 5});
+
+    /* Clearing keeps the heap buffer, shrinking gives it back */
+    vec.clear();
+    REQUIRE(!vec.is_inline());
+    REQUIRE(vec.capacity() == 8u);
+    REQUIRE(vec.push_back(6));
+    vec.shrink_to_fit();
+    REQUIRE(vec.is_inline());
+    REQUIRE(vec.data() == inline_data);
+    REQUIRE(vec.capacity() == 4u);
+    REQUIRE(vec.front() == 6);
+
+    REQUIRE(vec.resize(20u));
+    REQUIRE(vec.capacity() == 20u);
+    REQUIRE(vec.front() == 6);
+    vec.erase(std::begin(vec) + 10, std::end(vec));
+    vec.shrink_to_fit();
+    REQUIRE(!vec.is_inline());
+    REQUIRE(vec.capacity() == 10u);
+    vec.reserve(100u);
+    REQUIRE(vec.capacity() == 100u);
+    REQUIRE(vec.size() == 10u);
+    REQUIRE(vec.front() == 6);
+}
+
+TEST_CASE("Small Vector Counters", "[small_vector]") {
+    small_vector<int, 4> vec{};
+    REQUIRE(vec.spill_count() == 0u);
+    REQUIRE(vec.peak_size() == 0u);
+    for(int round = 1; round <= 3; round++) {
+        for(int i = 0; i < 10; i++) {
+            vec.push_back(i);
+        }
+        /* Growing on the heap is not a spill, only leaving the inline buffer is */
+        REQUIRE(vec.spill_count() == static_cast<std::size_t>(round));
+        vec.erase(std::begin(vec) + 2, std::end(vec));
+        vec.shrink_to_fit();
+        REQUIRE(vec.is_inline());
+    }
+    REQUIRE(vec.peak_size() == 12u);
+    vec.reset_stats();
+    REQUIRE(vec.spill_count() == 0u);
+    REQUIRE(vec.peak_size() == 2u);
+
+    small_vector<int, 4> copy{vec};
+    REQUIRE(copy.spill_count() == 0u);
+    REQUIRE(copy.peak_size() == 2u);
+    vec.assign(6u, 1);
+    REQUIRE(vec.spill_count() == 1u);
+    REQUIRE(vec.peak_size() == 6u);
+    small_vector<int, 4> moved{std::move(vec)};
+    REQUIRE(moved.spill_count() == 1u);
+    REQUIRE(moved.peak_size() == 6u);
+    REQUIRE(vec.empty());
+    REQUIRE(vec.is_inline());
+    REQUIRE(vec.spill_count() == 0u);
+}
+
+TEST_CASE("Small Vector Copy And Move", "[small_vector]") {
+    small_vector<std::unique_ptr<int>, 2> owners{};
+    for(int i = 0; i < 5; i++) {
+        REQUIRE(owners.emplace_back(std::make_unique<int>(i)));
+    }
+    auto const* const heap = owners.data();
+    small_vector<std::unique_ptr<int>, 2> stolen{std::move(owners)};
+    REQUIRE(stolen.data() == heap);
+    REQUIRE(*stolen.back() == 4);
+    REQUIRE(owners.empty());
+
+    small_vector<std::string, 3> small{"a", "b"};
+    small_vector<std::string, 3> large{"c", "d", "e", "f", "g"};
+    small.swap(large);
+    REQUIRE(small == small_vector<std::string, 3>{"c", "d", "e", "f", "g"});
+    REQUIRE(large == small_vector<std::string, 3>{"a", "b"});
+    REQUIRE(large.is_inline());
+    REQUIRE(!small.is_inline());
+
+    large = small;
+    REQUIRE(large == small);
+    REQUIRE(!large.is_inline());
+    large = small_vector<std::string, 3>{"h"};
+    REQUIRE(large.size() == 1u);
+    REQUIRE(large.front() == "h");
+    large = large;
+    REQUIRE(large.front() == "h");
+}
+
+TEST_CASE("Small Vector Interface", "[small_vector]") {
+    small_vector<int, 4> vec{5, 3, 8, 1, 9, 2};
+    REQUIRE(vec.at(4) == 9);
+    REQUIRE_THROWS_AS(vec.at(6), std::out_of_range);
+    REQUIRE(vec.back() == 2);
+    std::sort(std::begin(vec), std::end(vec));
+    REQUIRE(std::vector<int>(vec.rbegin(), vec.rend()) == std::vector<int>{9, 8, 5, 3, 2, 1});
+    REQUIRE(*vec.erase(std::cbegin(vec)) == 2);
+    REQUIRE(vec.size() == 5u);
+
+    small_vector<int, 16> const other{2, 3, 5, 8, 9};
+    REQUIRE(vec == other);
+    REQUIRE(!(vec != other));
+    REQUIRE(vec <= other);
+    REQUIRE(vec < small_vector<int, 2>{2, 4});
+    REQUIRE(small_vector<int, 2>{2, 4} > vec);
+    REQUIRE(vec >= small_vector<int, 8>{});
+
+    std::vector<int> const source(40u, 7);
+    REQUIRE(vec.assign(std::begin(source), std::end(source)));
+    REQUIRE(vec.size() == 40u);
+    REQUIRE(std::count(std::cbegin(vec), std::cend(vec), 7) == 40);
+    REQUIRE(vec.max_size() >= vec.capacity());
+
+    std::istringstream in{"1 2 3"};
+    REQUIRE(vec.assign(std::istream_iterator<int>{in}, std::istream_iterator<int>{}));
+    REQUIRE(same(vec, {1, 2, 3}));
+    std::istringstream more{"4 5 6 7"};
+    auto const it = vec.insert(std::cbegin(vec) + 1, std::istream_iterator<int>{more}, std::istream_iterator<int>{});
+    REQUIRE(it == std::begin(vec) + 1);
+    REQUIRE(same(vec, {1, 4, 5, 6, 7, 2, 3}));
+}
@@ -0,0 +1,211 @@
+#include <catch.hpp>
+
+#include "statvec_soa.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <typename Vec>
+bool same(Vec const& vec, std::vector<std::tuple<int, double, std::string>> const& ref) {
+    return vec.size() == ref.size() && std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()) &&
+           std::equal(vec.rbegin(), vec.rend(), ref.rbegin(), ref.rend());
+}
+
+template <typename Vec>
+void check_random_ops() {
+    Vec vec{};
+    std::vector<std::tuple<int, double, std::string>> ref{};
+    unsigned state = 31u;
+    for(int step = 0; step < 5000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const value = static_cast<int>((state >> 10) % 1000u);
+        auto const pos = ref.empty() ? 0u : (state >> 6) % (ref.size() + 1u);
+        switch(state % 8u) {
+            case 0u:
+                if(pos < ref.size()) {
+                    auto const it = vec.erase(vec.cbegin() + pos);
+                    ref.erase(ref.begin() + pos);
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                }
+                break;
+            case 1u: {
+                auto const last = std::min<std::size_t>(pos + (state >> 20) % 5u, ref.size());
+                vec.erase(vec.cbegin() + pos, vec.cbegin() + last);
+                ref.erase(ref.begin() + pos, ref.begin() + last);
+                break;
+            }
+            case 2u:
+                if(pos < ref.size()) {
+                    auto const it = vec.swap_remove(vec.cbegin() + pos);
+                    ref[pos] = ref.back();
+                    ref.pop_back();
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                }
+                break;
+            case 3u: {
+                auto const it = vec.insert(vec.cbegin() + pos, value, value * 0.5, std::to_string(value));
+                if(ref.size() < 120u) {
+                    REQUIRE(it - vec.begin() == static_cast<std::ptrdiff_t>(pos));
+                    ref.emplace(ref.begin() + pos, value, value * 0.5, std::to_string(value));
+                }
+                else {
+                    REQUIRE(it == vec.end());
+                }
+                break;
+            }
+            case 4u:
+                if(!ref.empty()) {
+                    REQUIRE(vec.pop_back() == ref.back());
+                    ref.pop_back();
+                }
+                break;
+            case 5u:
+                if(pos < ref.size()) {
+                    std::get<1>(vec[pos]) = -value;
+                    vec.template get<2>(pos) += "!";
+                    std::get<1>(ref[pos]) = -value;
+                    std::get<2>(ref[pos]) += "!";
+                }
+                break;
+            default:
+                REQUIRE(vec.push_back(value, value * 0.5, std::to_string(value)) == (ref.size() < 120u));
+                if(ref.size() < 120u) {
+                    ref.emplace_back(value, value * 0.5, std::to_string(value));
+                }
+        }
+        REQUIRE(vec.size() == ref.size());
+        if(step % 50 == 0) {
+            REQUIRE(same(vec, ref));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("SoA Statvec Matches std::vector", "[soa]") {
+    check_random_ops<statvec_soa<120, int, double, std::string>>();
+    check_random_ops<statvec_aosoa<120, 8, int, double, std::string>>();
+    check_random_ops<statvec_aosoa<120, 50, int, double, std::string>>();
+}
+
+TEST_CASE("SoA Statvec Field Spans", "[soa]") {
+    statvec_soa<64, int, float> soa{};
+    statvec_aosoa<64, 16, int, float> aosoa{};
+    for(int i = 0; i < 40; i++) {
+        soa.push_back(i, static_cast<float>(i) * 2.f);
+        aosoa.push_back(i, static_cast<float>(i) * 2.f);
+    }
+
+    auto const ids = soa.field<0>();
+    auto const values = soa.field<1>();
+    REQUIRE(ids.size() == 40u);
+    REQUIRE(values.data() + 39 == &soa.get<1>(39));
+    REQUIRE(std::accumulate(ids.begin(), ids.end(), 0) == 780);
+    for(auto& value : soa.field<1>()) {
+        value += 1.f;
+    }
+    REQUIRE(soa.get<1>(10) == 21.f);
+    REQUIRE(soa.block_count() == 1u);
+
+    REQUIRE(aosoa.block_count() == 3u);
+    REQUIRE(decltype(aosoa)::block_size == 16u);
+    int sum = 0;
+    for(std::size_t block = 0u; block < aosoa.block_count(); block++) {
+        auto const block_ids = aosoa.field<0>(block);
+        auto const block_values = aosoa.field<1>(block);
+        REQUIRE(block_ids.size() == (block < 2u ? 16u : 8u));
+        REQUIRE(block_values.size() == block_ids.size());
+        for(std::size_t lane = 0u; lane < block_ids.size(); lane++) {
+            REQUIRE(block_ids[lane] == static_cast<int>(block * 16u + lane));
+            block_values[lane] += 1.f;
+        }
+        sum += std::accumulate(block_ids.begin(), block_ids.end(), 0);
+    }
+    REQUIRE(sum == 780);
+    REQUIRE(aosoa.get<1>(33) == 67.f);
+    REQUIRE(&aosoa.get<0>(17) == aosoa.field<0>(1).data() + 1);
+    static_assert(std::is_same_v<decltype(aosoa.lanes<1>(0)), std::array<float, 16>&>);
+    REQUIRE(aosoa.lanes<0>(2).data() == aosoa.field<0>(2).data());
+    for(auto& id : aosoa.lanes<0>(2)) {
+        id *= 2;
+    }
+    REQUIRE(aosoa.get<0>(39) == 78);
+
+    aosoa.resize(32u);
+    REQUIRE(aosoa.block_count() == 2u);
+    REQUIRE(aosoa.field<0>(2).empty());
+    REQUIRE(std::as_const(aosoa).field<1>(3).size() == 0u);
+    aosoa.clear();
+    REQUIRE(aosoa.block_count() == 0u);
+}
+
+TEST_CASE("SoA Statvec Interface", "[soa]") {
+    statvec_soa<4, int, std::string> vec{};
+    static_assert(std::is_same_v<decltype(vec)::value_type, std::tuple<int, std::string>>);
+    static_assert(std::is_same_v<decltype(vec)::reference, std::tuple<int&, std::string&>>);
+    static_assert(std::is_same_v<decltype(vec)::field_type<1>, std::string>);
+    static_assert(std::is_same_v<decltype(std::as_const(vec).begin())::reference, std::tuple<int const&, std::string const&>>);
+
+    REQUIRE(vec.empty());
+    REQUIRE(vec.push_back(1, "one"));
+    REQUIRE(vec.push_back(2, "two"));
+    REQUIRE(vec.push_back(3, "three"));
+    REQUIRE(vec.push_back(4, "four"));
+    REQUIRE(vec.full());
+    REQUIRE(!vec.push_back(5, "five"));
+    REQUIRE(vec.insert(vec.cbegin(), 0, "zero") == vec.end());
+
+    auto [id, name] = vec.front();
+    id = 10;
+    name = "ten";
+    REQUIRE(vec.get<0>(0) == 10);
+    REQUIRE(std::get<1>(vec.back()) == "four");
+    REQUIRE(std::get<1>(vec.at(1)) == "two");
+    REQUIRE_THROWS_AS(vec.at(4), std::out_of_range);
+
+    decltype(vec)::const_iterator it = vec.begin();
+    REQUIRE(std::get<0>(it[2]) == 3);
+    REQUIRE(std::get<0>(*(vec.end() - 1)) == 4);
+
+    statvec_soa<4, int, std::string> other{};
+    other.push_back(7, "seven");
+    other.swap(vec);
+    REQUIRE(vec.size() == 1u);
+    REQUIRE(other.size() == 4u);
+    REQUIRE(std::get<1>(vec[0]) == "seven");
+    REQUIRE(vec != other);
+    other = vec;
+    REQUIRE(vec == other);
+    REQUIRE(!vec.resize(5u));
+    REQUIRE(vec.size() == 4u);
+    vec.clear();
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("SoA Statvec Constexpr", "[soa]") {
+    constexpr auto vec = [] {
+        statvec_aosoa<32, 8, int, char> v{};
+        for(int i = 0; i < 20; i++) {
+            v.push_back(i, static_cast<char>('a' + i));
+        }
+        v.erase(v.cbegin() + 2);
+        v.swap_remove(v.cbegin());
+        v.insert(v.cbegin() + 10, 100, 'z');
+        return v;
+    }();
+    static_assert(vec.size() == 19u);
+    static_assert(vec.get<0>(0) == 19);
+    static_assert(vec.get<1>(1) == 'b');
+    static_assert(vec.get<0>(10) == 100);
+    static_assert(std::get<1>(vec[2]) == 'd');
+    static_assert(vec.field<0>(2).size() == 3u);
+    static_assert(vec.field<1>(2)[2] == 's');
+}
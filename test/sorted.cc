@@ -0,0 +1,220 @@
+#include <catch.hpp>
+
+#include "sorted_statvec.h"
+#include "static_flat_map.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEMPLATE_TEST_CASE("Sorted Statvec Lower Bound Matches std::lower_bound", "[sorted]",
+                   std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t,
+                   std::int64_t, float, double) {
+    for(std::size_t size = 0u; size <= 96u; size += 7u) {
+        sorted_statvec<TestType, 128> vec{};
+        std::vector<TestType> ref{};
+        for(std::size_t i = 0u; i < size; i++) {
+            auto const value = static_cast<TestType>((i * 37u) % 101u);
+            vec.insert(value);
+            ref.insert(std::upper_bound(std::begin(ref), std::end(ref), value), value);
+        }
+        REQUIRE(std::equal(std::begin(vec), std::end(vec), std::begin(ref), std::end(ref)));
+
+        for(int key = -1; key <= 102; key++) {
+            auto const k = static_cast<TestType>(key);
+            auto const expected = std::lower_bound(std::begin(ref), std::end(ref), k) - std::begin(ref);
+            REQUIRE(std::distance(std::cbegin(vec), vec.lower_bound(k)) == expected);
+            auto const upper = std::upper_bound(std::begin(ref), std::end(ref), k) - std::begin(ref);
+            REQUIRE(std::distance(std::cbegin(vec), vec.upper_bound(k)) == upper);
+            REQUIRE(vec.contains(k) == std::binary_search(std::begin(ref), std::end(ref), k));
+        }
+    }
+}
+
+TEST_CASE("Sorted Statvec Unsigned Keys Use Unsigned Order", "[sorted]") {
+    static_flat_set<std::uint32_t, 64> set{};
+    for(std::uint32_t i = 0u; i < 32u; i++) {
+        set.insert(0x7ffffff0u + i * 0x10u);
+    }
+    REQUIRE(set.contains(0x80000000u));
+    REQUIRE(*set.lower_bound(0x80000001u) == 0x80000010u);
+    REQUIRE(set.lower_bound(0xffffffffu) == std::cend(set));
+}
+
+TEST_CASE("Sorted Statvec Duplicates", "[sorted]") {
+    sorted_statvec<int, 8> vec{};
+    auto const it = vec.insert(2);
+    REQUIRE(it != std::cend(vec));
+    vec.insert(1);
+    vec.insert(2);
+    vec.emplace(3);
+    REQUIRE(vec.count(2) == 2);
+    auto const [first, last] = vec.equal_range(2);
+    REQUIRE(std::distance(first, last) == 2);
+    REQUIRE(vec.erase(2) == 2);
+    REQUIRE(vec.size() == 2);
+    REQUIRE(vec.find(2) == std::cend(vec));
+    REQUIRE(vec.at(1) == 3);
+    REQUIRE_THROWS_AS(vec.at(2), std::out_of_range);
+}
+
+TEST_CASE("Sorted Statvec Capacity", "[sorted]") {
+    static_flat_set<int, 2> set{};
+    REQUIRE(set.insert(1).second);
+    REQUIRE(set.insert(3).second);
+    auto const [it, inserted] = set.insert(2);
+    REQUIRE(!inserted);
+    REQUIRE(it == std::cend(set));
+    REQUIRE(set.insert(3).first == std::cbegin(set) + 1);
+
+    sorted_statvec<int, 2> vec{};
+    vec.insert(1);
+    vec.insert(1);
+    REQUIRE(vec.insert(1) == std::cend(vec));
+}
+
+TEST_CASE("Static Flat Set Hinted Insertion", "[sorted]") {
+    static_flat_set<int, 8> set{};
+    auto it = set.insert(std::cend(set), 1);
+    it = set.insert(std::cend(set), 3);
+    REQUIRE(*it == 3);
+    it = set.insert(it, 2);
+    REQUIRE(*it == 2);
+    it = set.insert(std::cbegin(set), 5);
+    REQUIRE(*it == 5);
+    it = set.insert(std::cend(set), 2);
+    REQUIRE(*it == 2);
+    REQUIRE(set.size() == 4);
+    REQUIRE(std::is_sorted(std::begin(set), std::end(set)));
+}
+
+TEST_CASE("Sorted Statvec Custom Comparator", "[sorted]") {
+    static_flat_set<std::string, 8, std::greater<std::string>> set{};
+    set.insert("b");
+    set.insert("c");
+    set.insert("a");
+    REQUIRE(set.front() == "c");
+    REQUIRE(set.back() == "a");
+    REQUIRE(set.find("b") == std::cbegin(set) + 1);
+}
+
+TEST_CASE("Sorted Statvec Insert Sorted Range", "[sorted]") {
+    SECTION("Multiset") {
+        sorted_statvec<int, 16> vec{};
+        std::vector<int> const lhs{1, 3, 5, 7};
+        std::vector<int> const rhs{0, 3, 3, 8, 9};
+        REQUIRE(vec.insert_sorted_range(std::begin(lhs), std::end(lhs)));
+        REQUIRE(vec.insert_sorted_range(std::begin(rhs), std::end(rhs)));
+        REQUIRE(std::vector<int>(std::begin(vec), std::end(vec)) == std::vector<int>{0, 1, 3, 3, 3, 5, 7, 8, 9});
+    }
+    SECTION("Set") {
+        static_flat_set<int, 8> set{};
+        std::vector<int> const lhs{1, 3, 5, 7};
+        std::vector<int> const rhs{0, 3, 3, 5, 8, 8};
+        REQUIRE(set.insert_sorted_range(std::begin(lhs), std::end(lhs)));
+        REQUIRE(set.insert_sorted_range(std::begin(rhs), std::end(rhs)));
+        REQUIRE(std::vector<int>(std::begin(set), std::end(set)) == std::vector<int>{0, 1, 3, 5, 7, 8});
+    }
+    SECTION("Overflow") {
+        static_flat_set<int, 4> set{};
+        std::vector<int> const src{1, 2, 3, 4, 5};
+        set.insert(2);
+        REQUIRE(!set.insert_sorted_range(std::begin(src), std::end(src)));
+        REQUIRE(set.size() == 1);
+        REQUIRE(set.insert_sorted_range(std::begin(src) + 1, std::end(src)));
+        REQUIRE(set.size() == 4);
+    }
+    SECTION("Iterator Category") {
+        STATIC_REQUIRE(detail::is_bidirectional_iterator_v<std::vector<int>::const_iterator>);
+        STATIC_REQUIRE(detail::is_bidirectional_iterator_v<int const*>);
+        STATIC_REQUIRE(!detail::is_bidirectional_iterator_v<std::istream_iterator<int>>);
+        STATIC_REQUIRE(!detail::is_bidirectional_iterator_v<int>);
+    }
+    SECTION("Matches std::multiset") {
+        sorted_statvec<int, 256> vec{};
+        std::multiset<int> ref{};
+        for(int round = 0; round < 8; round++) {
+            std::vector<int> src{};
+            for(int i = 0; i < 24; i++) {
+                src.push_back((round * 131 + i * 71) % 53);
+            }
+            std::sort(std::begin(src), std::end(src));
+            REQUIRE(vec.insert_sorted_range(std::begin(src), std::end(src)));
+            ref.insert(std::begin(src), std::end(src));
+            REQUIRE(std::equal(std::begin(vec), std::end(vec), std::begin(ref), std::end(ref)));
+        }
+    }
+}
+
+TEST_CASE("Static Flat Map", "[sorted]") {
+    static_flat_map<std::string, int, 4> map{};
+    REQUIRE(map.insert({"b", 2}).second);
+    REQUIRE(map.try_emplace("a", 1).second);
+    REQUIRE(!map.insert({"a", 3}).second);
+    REQUIRE(map.at("a") == 1);
+    auto const [it, inserted] = map.insert_or_assign("a", 4);
+    REQUIRE(!inserted);
+    REQUIRE(it->second == 4);
+    REQUIRE(map.at("a") == 4);
+    REQUIRE(map.insert_or_assign("c", 5).second);
+    REQUIRE(map.at("c") == 5);
+    REQUIRE(map.erase("c") == 1u);
+    REQUIRE_THROWS_AS(map.at("z"), std::out_of_range);
+
+    map.find("b")->second = 20;
+    REQUIRE(map.at("b") == 20);
+    REQUIRE(map.count("b") == 1);
+    REQUIRE(map.lower_bound("aa")->first == "b");
+    REQUIRE(map.upper_bound("b") == std::end(map));
+
+    std::vector<std::pair<std::string, int>> const src{{"a", 0}, {"c", 3}, {"d", 4}};
+    REQUIRE(map.insert_sorted_range(std::begin(src), std::end(src)));
+    REQUIRE(map.size() == 4);
+    REQUIRE(map.at("a") == 4);
+    REQUIRE(!map.try_emplace("e", 5).second);
+
+    REQUIRE(map.erase("c") == 1);
+    REQUIRE(map.erase("c") == 0);
+    REQUIRE(std::begin(map)->first == "a");
+    REQUIRE(std::rbegin(map)->first == "d");
+}
+
+TEST_CASE("Static Flat Map Matches std::map", "[sorted]") {
+    static_flat_map<int, int, 64> map{};
+    std::map<int, int> ref{};
+    for(int step = 0; step < 1000; step++) {
+        int const key = (step * 7919) % 97;
+        if(step % 3 == 0) {
+            REQUIRE(map.erase(key) == ref.erase(key));
+        }
+        else if(map.size() < map.capacity()) {
+            REQUIRE(map.insert_or_assign(key, step).second == ref.insert_or_assign(key, step).second);
+        }
+        REQUIRE(std::equal(std::begin(map), std::end(map), std::begin(ref), std::end(ref),
+                           [](auto const& lhs, auto const& rhs) {
+                               return lhs.first == rhs.first && lhs.second == rhs.second;
+                           }));
+    }
+}
+
+TEST_CASE("Sorted Statvec Constexpr", "[sorted]") {
+    constexpr auto set = [] {
+        static_flat_set<int, 8> s{};
+        s.insert(3);
+        s.insert(1);
+        s.insert(2);
+        s.insert(2);
+        return s;
+    }();
+    static_assert(set.size() == 3);
+    static_assert(set.front() == 1);
+    static_assert(*set.lower_bound(2) == 2);
+    static_assert(set.contains(3));
+    static_assert(!set.contains(4));
+}
@@ -0,0 +1,98 @@
+#include <catch.hpp>
+
+#include "static_sparse_set.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <type_traits>
+
+TEST_CASE("Sparse Set Matches std::set", "[sparse_set]") {
+    static_sparse_set<200> set{};
+    std::set<std::size_t> ref{};
+    unsigned state = 3u;
+    for(int step = 0; step < 5000; step++) {
+        state = state * 1103515245u + 12345u;
+        std::size_t const key = (state >> 8) % 220u;
+        switch(state % 5u) {
+            case 0u:
+                REQUIRE(set.erase(key) == (ref.erase(key) == 1u));
+                break;
+            case 1u:
+                if(step % 400 == 1) {
+                    set.clear();
+                    ref.clear();
+                }
+                break;
+            default:
+                REQUIRE(set.insert(key) == (key < 200u && ref.insert(key).second));
+        }
+        REQUIRE(set.size() == ref.size());
+        REQUIRE(set.contains(key) == (ref.count(key) == 1u));
+        if(step % 250 == 0) {
+            for(std::size_t k = 0u; k < 220u; k++) {
+                REQUIRE(set.contains(k) == (ref.count(k) == 1u));
+            }
+            REQUIRE(std::set<std::size_t>(set.begin(), set.end()) == ref);
+        }
+    }
+}
+
+TEST_CASE("Sparse Set Value Type", "[sparse_set]") {
+    STATIC_REQUIRE(std::is_same_v<static_sparse_set<256>::value_type, std::uint8_t>);
+    STATIC_REQUIRE(std::is_same_v<static_sparse_set<257>::value_type, std::uint16_t>);
+    STATIC_REQUIRE(std::is_same_v<static_sparse_set<65537>::value_type, std::uint32_t>);
+
+    static_sparse_set<256> set{};
+    for(std::size_t i = 0u; i < 256u; i++) {
+        REQUIRE(set.insert(255u - i));
+    }
+    REQUIRE(set.full());
+    REQUIRE(set.index_of(0u) == 255u);
+    REQUIRE(set.contains(128u));
+}
+
+TEST_CASE("Sparse Set Interface", "[sparse_set]") {
+    static_sparse_set<16> set{};
+    for(std::size_t key : {3u, 9u, 4u, 15u, 0u}) {
+        REQUIRE(set.insert(key));
+    }
+    REQUIRE(!set.insert(9u));
+    REQUIRE(set.index_of(4u) == 2u);
+    REQUIRE(set.index_of(5u) == set.size());
+    REQUIRE(set.count(15u) == 1u);
+
+    for(auto it = set.begin(); it != set.end();) {
+        it = *it % 3u == 0u ? set.erase(it) : it + 1;
+    }
+    REQUIRE(set.size() == 1u);
+    REQUIRE(*set.data() == 4u);
+
+    static_sparse_set<16> other{};
+    other.insert(4u);
+    REQUIRE(set == other);
+    other.insert(5u);
+    REQUIRE(set != other);
+    set.swap(other);
+    REQUIRE(set.size() == 2u);
+
+    set.clear();
+    REQUIRE(set.empty());
+    REQUIRE(!set.contains(4u));
+    REQUIRE(set.insert(5u));
+    REQUIRE(!set.contains(4u));
+}
+
+TEST_CASE("Sparse Set Constexpr", "[sparse_set]") {
+    constexpr auto set = [] {
+        static_sparse_set<32> s{};
+        s.insert(7u);
+        s.insert(21u);
+        s.insert(3u);
+        s.erase(7u);
+        return s;
+    }();
+    static_assert(set.size() == 2u);
+    static_assert(set.contains(21u) && set.contains(3u));
+    static_assert(!set.contains(7u));
+}
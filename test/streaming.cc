@@ -0,0 +1,70 @@
+#include <catch.hpp>
+
+#include "statvec.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using large_vec = statvec<float, detail::streaming_threshold / sizeof(float) + 64u>;
+
+TEST_CASE("Streaming Selection", "[streaming]") {
+#ifdef __SSE2__
+    REQUIRE(detail::is_streamable_v<float, detail::streaming_threshold / sizeof(float)>);
+#endif
+    REQUIRE(!detail::is_streamable_v<float, 1024>);
+    REQUIRE(!detail::is_streamable_v<std::string, detail::streaming_threshold>);
+}
+
+TEST_CASE("Streaming assign", "[streaming]") {
+    auto vec = std::make_unique<large_vec>();
+    SECTION("Within Capacity") {
+        REQUIRE(vec->assign(vec->capacity() - 3u, 1.5f));
+        REQUIRE(vec->size() == vec->capacity() - 3u);
+        REQUIRE(std::all_of(vec->begin(), vec->end(), [](float f) { return f == 1.5f; }));
+    }
+    SECTION("Exceeding Capacity") {
+        REQUIRE(!vec->assign(vec->capacity() + 1u, 2.5f));
+        REQUIRE(vec->size() == vec->capacity());
+        REQUIRE(std::all_of(vec->begin(), vec->end(), [](float f) { return f == 2.5f; }));
+    }
+}
+
+TEST_CASE("Streaming Copy Assignment", "[streaming]") {
+    auto src = std::make_unique<large_vec>();
+    auto dst = std::make_unique<large_vec>();
+    for(std::size_t i = 0u; i < src->capacity() - 5u; i++) {
+        src->push_back(static_cast<float>(i));
+    }
+    SECTION("Copy") {
+        *dst = *src;
+        REQUIRE(*dst == *src);
+    }
+    SECTION("Move") {
+        *dst = std::move(*src);
+        REQUIRE(dst->size() == src->capacity() - 5u);
+        REQUIRE(dst->back() == static_cast<float>(src->capacity() - 6u));
+    }
+}
+
+#ifdef __SSE2__
+TEST_CASE("Unaligned Streaming Stores", "[streaming]") {
+    for(std::size_t offset = 0u; offset < 4u; offset++) {
+        for(std::size_t count : {1u, 3u, 4u, 5u, 17u, 1000u}) {
+            std::vector<std::uint16_t> dst(count + 8u, 0u);
+            detail::stream_fill(dst.data() + offset, count, std::uint16_t{0xabcdu});
+            REQUIRE(std::count(dst.begin(), dst.end(), std::uint16_t{0xabcdu}) == static_cast<std::ptrdiff_t>(count));
+            REQUIRE(std::all_of(dst.begin() + offset, dst.begin() + offset + count, [](auto v) { return v == 0xabcdu; }));
+
+            std::vector<std::uint16_t> src(count);
+            for(std::size_t i = 0u; i < count; i++) {
+                src[i] = static_cast<std::uint16_t>(i);
+            }
+            detail::stream_copy(dst.data() + offset, src.data(), count);
+            REQUIRE(std::equal(src.begin(), src.end(), dst.begin() + offset));
+        }
+    }
+}
+#endif
@@ -0,0 +1,257 @@
+#include <catch.hpp>
+
+#include "static_string.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+
+template <std::size_t N>
+bool same(static_string<N> const& str, std::string const& ref) {
+    return str.view() == ref && str.size() == ref.size() && str.c_str()[str.size()] == '\0';
+}
+
+} // namespace
+
+TEST_CASE("String Matches std::string", "[string]") {
+    static_string<100> str{};
+    std::string ref{};
+    unsigned state = 11u;
+    auto const random_text = [&](std::size_t max) {
+        state = state * 1103515245u + 12345u;
+        std::string text((state >> 8) % (max + 1u), 'a');
+        for(auto& ch : text) {
+            state = state * 1103515245u + 12345u;
+            ch = static_cast<char>('a' + (state >> 12) % 3u);
+        }
+        return text;
+    };
+    for(int step = 0; step < 20000; step++) {
+        state = state * 1103515245u + 12345u;
+        auto const pos = ref.empty() ? 0u : (state >> 4) % (ref.size() + 1u);
+        auto const count = (state >> 10) % 12u;
+        auto const before = ref;
+        switch(state % 11u) {
+            case 0u: {
+                auto const text = random_text(20u);
+                auto const fits = ref.size() + text.size() <= 100u;
+                REQUIRE(str.append(text) == fits);
+                if(fits) {
+                    ref += text;
+                }
+                break;
+            }
+            case 1u: {
+                auto const text = random_text(20u);
+                auto const fits = ref.size() + text.size() <= 100u;
+                REQUIRE(str.insert(pos, text) == fits);
+                if(fits) {
+                    ref.insert(pos, text);
+                }
+                break;
+            }
+            case 2u: {
+                auto const text = random_text(20u);
+                auto const replaced = std::min<std::size_t>(count, ref.size() - pos);
+                auto const fits = ref.size() - replaced + text.size() <= 100u;
+                REQUIRE(str.replace(pos, count, text) == fits);
+                if(fits) {
+                    ref.replace(pos, count, text);
+                }
+                break;
+            }
+            case 3u: {
+                /* Replace with a view of the string itself */
+                auto const from = ref.empty() ? 0u : (state >> 14) % ref.size();
+                auto const length = std::min<std::size_t>((state >> 18) % 30u, ref.size() - from);
+                auto const replaced = std::min<std::size_t>(count, ref.size() - pos);
+                auto const fits = ref.size() - replaced + length <= 100u;
+                REQUIRE(str.replace(pos, count, str.view().substr(from, length)) == fits);
+                if(fits) {
+                    ref.replace(pos, count, before.substr(from, length));
+                }
+                break;
+            }
+            case 4u:
+                str.erase(pos, count);
+                ref.erase(pos, count);
+                break;
+            case 5u:
+                REQUIRE(str.append(count, 'z') == (ref.size() + count <= 100u));
+                if(ref.size() + count <= 100u) {
+                    ref.append(count, 'z');
+                }
+                break;
+            case 6u:
+                if(!ref.empty()) {
+                    str.pop_back();
+                    ref.pop_back();
+                }
+                else {
+                    REQUIRE(str.push_back('q'));
+                    ref.push_back('q');
+                }
+                break;
+            case 7u: {
+                auto const size = (state >> 6) % 110u;
+                REQUIRE(str.resize(size, 'r') == (size <= 100u));
+                if(size <= 100u) {
+                    ref.resize(size, 'r');
+                }
+                break;
+            }
+            case 8u: {
+                auto const needle = random_text(4u);
+                REQUIRE(str.find(needle, pos) == ref.find(needle, pos));
+                REQUIRE(str.rfind(needle, pos) == ref.rfind(needle, pos));
+                REQUIRE(str.contains(needle) == (ref.find(needle) != std::string::npos));
+                break;
+            }
+            case 9u: {
+                auto const other = random_text(8u);
+                auto const sign = [](int c) { return (c > 0) - (c < 0); };
+                REQUIRE(sign(str.compare(other)) == sign(ref.compare(other)));
+                REQUIRE(str.starts_with(other) == (ref.compare(0u, other.size(), other) == 0 && ref.size() >= other.size()));
+                break;
+            }
+            default: {
+                auto const text = random_text(100u);
+                REQUIRE(str.assign(text));
+                ref = text;
+            }
+        }
+        REQUIRE(same(str, ref));
+    }
+}
+
+TEST_CASE("String Find", "[string]") {
+    static_string<200> str{};
+    for(int i = 0; i < 200; i++) {
+        str.push_back(static_cast<char>('a' + (i * 7 + i / 13) % 5));
+    }
+    std::string const ref{str.view()};
+    for(std::string_view needle : {"a", "e", "x", "ab", "ea", "bcd", "cdeab", "aaaa", "deabcdea", ""}) {
+        for(std::size_t pos = 0u; pos <= 201u; pos++) {
+            REQUIRE(str.find(needle, pos) == ref.find(needle, pos));
+        }
+    }
+    for(std::size_t pos = 0u; pos < 200u; pos += 17u) {
+        auto const needle = ref.substr(pos, 9u);
+        REQUIRE(str.find(needle) == ref.find(needle));
+        REQUIRE(str.find(ref[pos], pos) == pos);
+    }
+    str[199] = 'x';
+    REQUIRE(str.find('x') == 199u);
+    REQUIRE(str.find("ex") == (str[198] == 'e' ? 198u : static_string<200>::npos));
+    REQUIRE(str.ends_with("x"));
+}
+
+TEST_CASE("String Numbers", "[string]") {
+    static_string<40> str{"id="};
+    REQUIRE(str.append_number(-1234));
+    REQUIRE(str.append(", hex="));
+    REQUIRE(str.append_number(255u, 16));
+    REQUIRE(str.append(", x="));
+    REQUIRE(str.append_number(0.1));
+    REQUIRE(str == "id=-1234, hex=ff, x=0.1");
+
+    long value = 0;
+    auto const parsed = str.parse_number(value, 3u);
+    REQUIRE(parsed.ec == std::errc{});
+    REQUIRE(value == -1234);
+    REQUIRE(parsed.ptr == str.data() + 8);
+    double x = 0.0;
+    REQUIRE(str.parse_number(x, str.find("0.1")).ec == std::errc{});
+    REQUIRE(x == 0.1);
+    REQUIRE(str.parse_number(value, 0u).ec == std::errc::invalid_argument);
+
+    static_string<10> small{"12345678"};
+    REQUIRE(!small.append_number(std::numeric_limits<std::uint64_t>::max()));
+    REQUIRE(small == "12345678");
+    REQUIRE(small.c_str()[8] == '\0');
+    REQUIRE(small.append_number(42));
+    REQUIRE(small.full());
+    REQUIRE(!small.append_number(1.5));
+}
+
+TEST_CASE("String Interface", "[string]") {
+    static_string str{"hello"};
+    static_assert(std::is_same_v<decltype(str), static_string<5>>);
+    REQUIRE(str.full());
+    REQUIRE(!str.push_back('!'));
+    REQUIRE(std::string_view{str} == "hello");
+    REQUIRE(std::string{str.c_str()} == "hello");
+    REQUIRE(str.at(1) == 'e');
+    REQUIRE_THROWS_AS(str.at(5), std::out_of_range);
+    REQUIRE_THROWS_AS(static_string<3>{std::string_view{"toolong"}}, std::length_error);
+    REQUIRE(static_string<8>{std::string_view{"fits"}} == "fits");
+
+    static_string<16> other{"world"};
+    REQUIRE(other != str);
+    REQUIRE(str < other);
+    REQUIRE(other >= str);
+    REQUIRE("world" == other);
+
+    static_string<16> copy{"a much longer"};
+    copy.swap(other);
+    REQUIRE(other == "a much longer");
+    REQUIRE(copy == "world");
+    REQUIRE(copy.c_str()[5] == '\0');
+    REQUIRE(std::string(copy.rbegin(), copy.rend()) == "dlrow");
+    for(auto& ch : copy) {
+        ch = static_cast<char>(ch - 32);
+    }
+    REQUIRE(copy == "WORLD");
+    REQUIRE(copy.erase(1, 3) == "WD");
+    copy.clear();
+    REQUIRE(copy.empty());
+    REQUIRE(*copy.c_str() == '\0');
+    REQUIRE(copy.capacity() == 16u);
+}
+
+TEST_CASE("String Assignment Keeps Terminator", "[string]") {
+    static_string<100> str{"hello world, this is long"};
+    static_string<100> const other{"hi"};
+    str = other;
+    REQUIRE(str.size() == 2u);
+    REQUIRE(std::strlen(str.c_str()) == str.size());
+    REQUIRE(str.view() == str.c_str());
+
+    str = static_string<100>{"hello world, this is long"};
+    str = static_string<100>{"z"};
+    REQUIRE(std::strlen(str.c_str()) == 1u);
+    REQUIRE(str == "z");
+
+    auto const& self = str;
+    str = self;
+    REQUIRE(str == "z");
+
+    static_string<100> const copy{other};
+    REQUIRE(std::strlen(copy.c_str()) == copy.size());
+}
+
+TEST_CASE("String Constexpr", "[string]") {
+    constexpr auto str = [] {
+        static_string<32> s{"key"};
+        s.push_back(':');
+        s.append("value");
+        s.insert(0u, "my_");
+        s.replace(3u, 3u, "long_key");
+        s.replace(0u, 2u, s.view().substr(3u, 4u));
+        return s;
+    }();
+    static_assert(str == "long_long_key:value");
+    static_assert(str.size() == 19u);
+    static_assert(str.c_str()[19] == '\0');
+    static_assert(str.find("key") == 10u);
+    static_assert(str.find(':') == 13u);
+    static_assert(str.rfind("long") == 5u);
+    static_assert(str.starts_with("long_"));
+    static_assert(str.ends_with(":value"));
+}
@@ -0,0 +1,181 @@
+#include <catch.hpp>
+
+#include "static_task_queue.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+int live = 0;
+
+/* Appends its id to a log when run, padded to Pad bytes and aligned to Align */
+template <std::size_t Pad, std::size_t Align = alignof(int)>
+struct alignas(Align) logger {
+    std::vector<int>* log;
+    int id;
+    std::array<unsigned char, Pad> pad{};
+
+    logger(std::vector<int>& l, int i) noexcept : log{&l}, id{i} { ++live; }
+    logger(logger const& other) noexcept : log{other.log}, id{other.id}, pad{other.pad} { ++live; }
+    ~logger() { --live; }
+
+    void operator()() const { log->push_back(id); }
+};
+
+} // namespace
+
+TEST_CASE("Task Queue Matches std::deque", "[task_queue]") {
+    {
+        static_task_queue<1024> queue{};
+        std::deque<int> ref{};
+        std::vector<int> log{};
+        std::vector<int> expected{};
+        unsigned state = 3u;
+        int id = 0;
+        for(int step = 0; step < 20000; step++) {
+            state = state * 1103515245u + 12345u;
+            auto const used = queue.bytes_used();
+            auto const size = queue.size();
+            auto emplaced = false;
+            switch(state % 9u) {
+                case 0u:
+                case 1u:
+                    emplaced = queue.emplace(logger<1>{log, id});
+                    break;
+                case 2u:
+                case 3u:
+                    emplaced = queue.emplace(logger<40>{log, id});
+                    break;
+                case 4u:
+                    emplaced = queue.emplace(logger<100, 16>{log, id});
+                    break;
+                case 5u:
+                case 6u:
+                    REQUIRE(queue.run_one() == !ref.empty());
+                    if(!ref.empty()) {
+                        expected.push_back(ref.front());
+                        ref.pop_front();
+                    }
+                    break;
+                case 7u:
+                    REQUIRE(queue.run_all() == ref.size());
+                    expected.insert(expected.end(), ref.begin(), ref.end());
+                    ref.clear();
+                    break;
+                default:
+                    if((state >> 8) % 16u == 0u) {
+                        queue.clear();
+                        ref.clear();
+                    }
+            }
+            if(state % 9u < 5u) {
+                if(emplaced) {
+                    ref.push_back(id++);
+                    REQUIRE(queue.bytes_used() > used);
+                }
+                else {
+                    REQUIRE(size);
+                    REQUIRE(queue.bytes_used() == used);
+                }
+            }
+            REQUIRE(queue.size() == ref.size());
+            REQUIRE(queue.empty() == ref.empty());
+            REQUIRE(live == static_cast<int>(ref.size()));
+            REQUIRE(log == expected);
+        }
+    }
+    REQUIRE(live == 0);
+}
+
+TEST_CASE("Task Queue Wraps Around", "[task_queue]") {
+    using task = logger<24>;
+    std::vector<int> log{};
+    static_task_queue<512> probe{};
+    probe.emplace(task{log, 0});
+    auto const record = probe.bytes_used();
+    probe.clear();
+
+    static_task_queue<512> queue{};
+    int count = 0;
+    while(queue.emplace(task{log, count})) {
+        ++count;
+    }
+    REQUIRE(count == static_cast<int>(512u / record));
+    REQUIRE(queue.bytes_used() == static_cast<std::size_t>(count) * record);
+
+    /* Freeing the front makes room at offset 0, so the next record wraps */
+    REQUIRE(queue.run_one());
+    REQUIRE(queue.run_one());
+    REQUIRE(queue.emplace(task{log, 100}));
+    REQUIRE(queue.emplace(task{log, 101}));
+    REQUIRE(!queue.emplace(task{log, 102}));
+    REQUIRE(queue.size() == static_cast<std::size_t>(count));
+
+    REQUIRE(queue.run_all() == static_cast<std::size_t>(count));
+    REQUIRE(log.size() == static_cast<std::size_t>(count) + 2u);
+    for(int i = 0; i < count; i++) {
+        REQUIRE(log[static_cast<std::size_t>(i)] == i);
+    }
+    REQUIRE(log[log.size() - 2u] == 100);
+    REQUIRE(log.back() == 101);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.bytes_used() == 0u);
+}
+
+TEST_CASE("Task Queue Reentrancy And Exceptions", "[task_queue]") {
+    static_task_queue<1024> queue{};
+    std::vector<int> log{};
+    REQUIRE(queue.emplace([&] {
+        log.push_back(1);
+        queue.emplace([&] { log.push_back(3); });
+    }));
+    REQUIRE(queue.emplace([&] { log.push_back(2); }));
+    REQUIRE(queue.run_all() == 2u);
+    REQUIRE(log == std::vector<int>{1, 2});
+    REQUIRE(queue.size() == 1u);
+    REQUIRE(queue.run_all() == 1u);
+    REQUIRE(log == std::vector<int>{1, 2, 3});
+
+    {
+        logger<8> const counted{log, 4};
+        REQUIRE(queue.emplace([counted] {
+            counted();
+            throw std::runtime_error{"task failed"};
+        }));
+    }
+    REQUIRE(queue.emplace(logger<8>{log, 5}));
+    REQUIRE(live == 2);
+    REQUIRE_THROWS_AS(queue.run_all(), std::runtime_error);
+    REQUIRE(live == 1);
+    REQUIRE(queue.size() == 1u);
+    REQUIRE(queue.run_all() == 1u);
+    REQUIRE(log == std::vector<int>{1, 2, 3, 4, 5});
+    REQUIRE(live == 0);
+}
+
+TEST_CASE("Task Queue Interface", "[task_queue]") {
+    std::vector<int> log{};
+    {
+        static_task_queue<256, 32> queue{};
+        REQUIRE(queue.empty());
+        REQUIRE(queue.size() == 0u);
+        REQUIRE(queue.byte_capacity() == 256u);
+        REQUIRE(!queue.run_one());
+        REQUIRE(queue.run_all() == 0u);
+
+        auto owned = std::make_unique<int>(7);
+        REQUIRE(queue.emplace([&log, p = std::move(owned)] { log.push_back(*p); }));
+        REQUIRE(queue.emplace(logger<8, 32>{log, 8}));
+        REQUIRE(queue.run_one());
+        REQUIRE(log == std::vector<int>{7});
+        REQUIRE(live == 1);
+    }
+    REQUIRE(live == 0);
+    REQUIRE(log == std::vector<int>{7});
+}
@@ -0,0 +1,178 @@
+#include <catch.hpp>
+
+#include "statvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class tiny_enum : std::uint8_t { a, b, c, d };
+
+template <std::size_t S>
+struct blob {
+    blob() = default;
+    blob(int i) {
+        for(auto& b : bytes) {
+            b = static_cast<unsigned char>(i++);
+        }
+    }
+
+    friend bool operator==(blob const& lhs, blob const& rhs) {
+        return std::equal(std::begin(lhs.bytes), std::end(lhs.bytes), std::begin(rhs.bytes));
+    }
+
+    unsigned char bytes[S]{};
+};
+
+TEST_CASE("Tiny Kernel Selection", "[tiny]") {
+    REQUIRE(detail::is_tiny_v<int, 16>);
+    REQUIRE(detail::is_tiny_v<char, 64>);
+    REQUIRE(!detail::is_tiny_v<int, 17>);
+    REQUIRE(!detail::is_tiny_v<std::string, 1>);
+    REQUIRE(detail::is_tiny_comparable_v<tiny_enum, 4>);
+    REQUIRE(!detail::is_tiny_comparable_v<float, 4>);
+}
+
+TEST_CASE("Tiny Copy Assignment", "[tiny]") {
+    statvec<int, 8> vec0{1, 2, 3};
+    statvec<int, 8> vec1{4, 5, 6, 7, 8};
+    vec1 = vec0;
+    REQUIRE(vec1.size() == 3);
+    REQUIRE(vec1 == statvec{1, 2, 3});
+    vec1 = std::move(vec0);
+    REQUIRE(vec1 == statvec{1, 2, 3});
+}
+
+TEST_CASE("Tiny Insertion", "[tiny]") {
+    SECTION("Front, Middle and Back") {
+        statvec<int, 8> vec{1, 2, 3};
+        REQUIRE(*vec.insert(vec.cbegin(), 0) == 0);
+        REQUIRE(*vec.insert(vec.cbegin() + 2, 10) == 10);
+        REQUIRE(*vec.insert(vec.cend(), 4) == 4);
+        REQUIRE(vec == statvec{0, 1, 10, 2, 3, 4});
+    }
+    SECTION("Aliased Lvalue") {
+        statvec<int, 8> vec{1, 2, 3};
+        vec.insert(vec.cbegin(), vec[2]);
+        REQUIRE(vec == statvec{3, 1, 2, 3});
+    }
+    SECTION("Capacity Reached") {
+        statvec<int, 4> vec{1, 2, 3, 4};
+        auto it = vec.insert(vec.cbegin(), 0);
+        REQUIRE(it == vec.end());
+        REQUIRE(vec == statvec{1, 2, 3, 4});
+    }
+    SECTION("Fill to Capacity") {
+        statvec<char, 16> vec{};
+        for(char c = 0; c < 16; c++) {
+            REQUIRE(*vec.insert(vec.cbegin(), c) == c);
+        }
+        REQUIRE(vec.size() == 16);
+        for(unsigned i = 0; i < 16; i++) {
+            REQUIRE(vec[i] == 15 - static_cast<char>(i));
+        }
+    }
+}
+
+TEST_CASE("Tiny Erasure", "[tiny]") {
+    SECTION("Single Element") {
+        statvec<int, 8> vec{1, 2, 3, 4, 5};
+        REQUIRE(*vec.erase(vec.cbegin() + 1) == 3);
+        REQUIRE(vec == statvec{1, 3, 4, 5});
+        auto it = vec.erase(vec.cend() - 1);
+        REQUIRE(it == vec.end());
+        REQUIRE(vec == statvec{1, 3, 4});
+    }
+    SECTION("Full Vector") {
+        statvec vec{1, 2, 3, 4};
+        REQUIRE(*vec.erase(vec.cbegin()) == 2);
+        REQUIRE(vec == statvec{2, 3, 4});
+    }
+    SECTION("Range") {
+        statvec<int, 8> vec{1, 2, 3, 4, 5, 6, 7, 8};
+        REQUIRE(*vec.erase(vec.cbegin() + 2, vec.cbegin() + 5) == 6);
+        REQUIRE(vec == statvec{1, 2, 6, 7, 8});
+        auto it = vec.erase(vec.cbegin(), vec.cend());
+        REQUIRE(it == vec.end());
+        REQUIRE(vec.empty());
+    }
+}
+
+TEST_CASE("Tiny Comparison", "[tiny]") {
+    statvec<int, 8> vec0{1, 2, 3};
+    statvec<int, 8> vec1{1, 2, 3, 4};
+    REQUIRE(vec0 != vec1);
+    vec1.pop_back();
+    REQUIRE(vec0 == vec1);
+    REQUIRE(!(vec0 < vec1));
+    vec1.push_back(0);
+    REQUIRE(vec0 < vec1);
+    REQUIRE(vec1 > vec0);
+    vec1[1] = 1;
+    REQUIRE(vec1 < vec0);
+    REQUIRE(vec0 >= vec1);
+
+    statvec<tiny_enum, 4> e0{tiny_enum::a, tiny_enum::c};
+    statvec<tiny_enum, 4> e1{tiny_enum::a, tiny_enum::d};
+    REQUIRE(e0 < e1);
+    REQUIRE(e0 != e1);
+}
+
+TEST_CASE("Tiny Constant Evaluation", "[tiny]") {
+    constexpr auto vec = [] {
+        statvec<int, 4> v{1, 2, 3};
+        v.insert(v.cbegin(), 0);
+        v.erase(v.cbegin() + 1);
+        return v;
+    }();
+    static_assert(vec == statvec<int, 4>{0, 2, 3});
+    static_assert(statvec<int, 4>{1, 2} < statvec<int, 4>{1, 3});
+}
+
+TEMPLATE_TEST_CASE_SIG("Tiny Insertion and Erasure Against Reference", "[tiny]", ((std::size_t S, std::size_t N), S, N),
+                       (1, 16), (1, 64), (2, 4), (3, 2), (4, 3), (4, 16), (8, 2), (12, 4), (16, 2), (24, 2), (32, 2)) {
+    using value_type = blob<S>;
+    static_assert(detail::is_tiny_v<value_type, N>);
+
+    for(std::size_t pos = 0u; pos < N; pos++) {
+        statvec<value_type, N> vec{};
+        std::vector<value_type> ref{};
+        for(std::size_t i = 0u; i + 1u < N; i++) {
+            vec.push_back(value_type{static_cast<int>(i)});
+            ref.push_back(value_type{static_cast<int>(i)});
+        }
+        value_type const value{100};
+        REQUIRE(vec.insert(vec.cbegin() + pos, value) == vec.begin() + pos);
+        ref.insert(ref.begin() + pos, value);
+        REQUIRE(std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()));
+
+        vec.erase(vec.cbegin() + pos);
+        ref.erase(ref.begin() + pos);
+        REQUIRE(std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()));
+
+        std::size_t const count = std::min<std::size_t>(2u, vec.size() - std::min(pos, vec.size()));
+        vec.erase(vec.cbegin() + pos, vec.cbegin() + pos + count);
+        ref.erase(ref.begin() + pos, ref.begin() + pos + count);
+        REQUIRE(std::equal(vec.begin(), vec.end(), ref.begin(), ref.end()));
+    }
+}
+
+TEMPLATE_TEST_CASE("Tiny Comparison Against Reference", "[tiny]", std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t) {
+    statvec<TestType, 64u / sizeof(TestType)> lhs{};
+    for(std::size_t i = 0u; i < lhs.capacity(); i++) {
+        lhs.push_back(static_cast<TestType>(i));
+    }
+    for(std::size_t size = 0u; size <= lhs.capacity(); size++) {
+        for(std::size_t i = 0u; i < size; i++) {
+            auto rhs = lhs;
+            rhs.resize(size);
+            auto trimmed = lhs;
+            trimmed.resize(size);
+            REQUIRE(rhs == trimmed);
+            rhs[i] = static_cast<TestType>(rhs[i] + 1u);
+            REQUIRE(rhs != trimmed);
+            REQUIRE(trimmed < rhs);
+            REQUIRE(!(rhs < trimmed));
+        }
+    }
+}